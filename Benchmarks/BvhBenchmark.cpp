@@ -0,0 +1,92 @@
+#include <random>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Bvh.h"
+
+using namespace BSMath;
+
+namespace
+{
+	std::vector<AABB> MakeBoxes(size_t size)
+	{
+		std::mt19937 engine{ 0 };
+		std::uniform_real_distribution<float> pos{ -1000.0f, 1000.0f };
+		std::uniform_real_distribution<float> extent{ 0.1f, 2.0f };
+
+		std::vector<AABB> boxes(size);
+		for (auto& box : boxes)
+		{
+			const Vector3 center{ pos(engine), pos(engine), pos(engine) };
+			const Vector3 half{ extent(engine), extent(engine), extent(engine) };
+			box.Set(center - half, center + half);
+		}
+		return boxes;
+	}
+
+	std::vector<Ray> MakeRays(size_t size)
+	{
+		std::mt19937 engine{ 1 };
+		std::uniform_real_distribution<float> dist{ -1.0f, 1.0f };
+
+		std::vector<Ray> rays(size);
+		for (auto& ray : rays)
+			ray.Set(Vector3{ dist(engine), dist(engine), dist(engine) } * 1000.0f,
+				Vector3{ dist(engine), dist(engine), dist(engine) });
+		return rays;
+	}
+}
+
+static void BM_BvhBuild(benchmark::State& state)
+{
+	const auto boxes = MakeBoxes(static_cast<size_t>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		Bvh bvh{ boxes.data(), boxes.size() };
+		benchmark::DoNotOptimize(bvh.GetNodes().data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_BvhRaycast(benchmark::State& state)
+{
+	const auto boxes = MakeBoxes(static_cast<size_t>(state.range(0)));
+	const auto rays = MakeRays(1024);
+	const Bvh bvh{ boxes.data(), boxes.size() };
+
+	for (auto _ : state)
+	{
+		for (const auto& ray : rays)
+		{
+			const float dist = bvh.Raycast(ray, [&](uint32 idx) { return ray.Intersect(boxes[idx]); });
+			benchmark::DoNotOptimize(dist);
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * rays.size());
+}
+
+static void BM_BvhQuery(benchmark::State& state)
+{
+	const auto boxes = MakeBoxes(static_cast<size_t>(state.range(0)));
+	const Bvh bvh{ boxes.data(), boxes.size() };
+
+	std::vector<AABB> queries = MakeBoxes(1024);
+	for (auto& query : queries)
+		query.Set(query.min - Vector3::One * 10.0f, query.max + Vector3::One * 10.0f);
+
+	for (auto _ : state)
+	{
+		size_t count = 0;
+		for (const auto& query : queries)
+			bvh.Query(query, [&](uint32) { ++count; });
+		benchmark::DoNotOptimize(count);
+	}
+
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK(BM_BvhBuild)->Arg(1 << 20)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BvhRaycast)->Arg(1 << 20)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BvhQuery)->Arg(1 << 20)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
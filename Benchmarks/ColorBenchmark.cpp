@@ -0,0 +1,88 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Color.h"
+
+using namespace BSMath;
+
+constexpr size_t PixelNum = 1 << 20;
+
+static std::vector<Color> MakePixels(uint32 seed)
+{
+	std::vector<Color> pixels(PixelNum);
+	Pcg32 engine{ seed };
+	for (auto& pixel : pixels)
+		pixel = Color{ engine() };
+	return pixels;
+}
+
+static void BM_AddScalar(benchmark::State& state)
+{
+	const auto lhs = MakePixels(1u), rhs = MakePixels(2u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+			out[i] = lhs[i] + rhs[i];
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_AlphaBlendScalar(benchmark::State& state)
+{
+	const auto src = MakePixels(1u), dst = MakePixels(2u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const float alpha = src[i].a / 255.0f, inv = 1.0f - alpha;
+			const auto blend = [=](uint8 s, uint8 d) { return static_cast<uint8>(s * alpha + d * inv + 0.5f); };
+			out[i] = Color{ blend(src[i].r, dst[i].r), blend(src[i].g, dst[i].g), blend(src[i].b, dst[i].b),
+				static_cast<uint8>(src[i].a + dst[i].a * inv + 0.5f) };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+template <void(*Func)(const Color*, const Color*, size_t, Color*)>
+static void BM_Batch(benchmark::State& state)
+{
+	const auto lhs = MakePixels(1u), rhs = MakePixels(2u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		Func(lhs.data(), rhs.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_Lerp(benchmark::State& state)
+{
+	const auto lhs = MakePixels(1u), rhs = MakePixels(2u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		Lerp(lhs.data(), rhs.data(), 0.3f, PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+BENCHMARK(BM_AddScalar);
+BENCHMARK_TEMPLATE(BM_Batch, AddSaturate);
+BENCHMARK_TEMPLATE(BM_Batch, SubSaturate);
+BENCHMARK_TEMPLATE(BM_Batch, Multiply);
+BENCHMARK(BM_Lerp);
+BENCHMARK(BM_AlphaBlendScalar);
+BENCHMARK_TEMPLATE(BM_Batch, AlphaBlend);
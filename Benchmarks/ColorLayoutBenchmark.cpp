@@ -0,0 +1,77 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/ColorLayout.h"
+
+using namespace BSMath;
+
+constexpr size_t PixelNum = 1 << 14;
+
+static std::vector<RGBA8> MakePixels()
+{
+	std::vector<RGBA8> pixels(PixelNum);
+	Pcg32 engine{ 1u };
+	for (auto& pixel : pixels)
+		pixel = RGBA8{ Color{ engine() } };
+	return pixels;
+}
+
+static void BM_ConvertLayoutScalar(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	std::vector<BGRA8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+			out[i] = BGRA8{ pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a };
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * PixelNum * sizeof(RGBA8));
+}
+
+static void BM_ConvertLayout(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	std::vector<BGRA8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		ConvertLayout(pixels.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * PixelNum * sizeof(RGBA8));
+}
+
+static void BM_ConvertLayoutInPlace(benchmark::State& state)
+{
+	auto pixels = MakePixels();
+
+	for (auto _ : state)
+	{
+		ConvertLayout(pixels.data(), PixelNum, reinterpret_cast<BGRA8*>(pixels.data()));
+		benchmark::DoNotOptimize(pixels.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * PixelNum * sizeof(RGBA8));
+}
+
+static void BM_CopyLayout(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	std::vector<RGBA8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		std::copy(pixels.cbegin(), pixels.cend(), out.begin());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * PixelNum * sizeof(RGBA8));
+}
+
+BENCHMARK(BM_CopyLayout);
+BENCHMARK(BM_ConvertLayoutScalar);
+BENCHMARK(BM_ConvertLayout);
+BENCHMARK(BM_ConvertLayoutInPlace);
@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/ColorSpace.h"
+
+using namespace BSMath;
+
+constexpr size_t PixelNum = 1 << 20;
+
+static std::vector<Color> MakePixels(uint32 seed)
+{
+	std::vector<Color> pixels(PixelNum);
+	Pcg32 engine{ seed };
+	for (auto& pixel : pixels)
+		pixel = Color{ engine() };
+	return pixels;
+}
+
+static uint8 RoundByte(float n)
+{
+	return static_cast<uint8>(Clamp(n + 0.5f, 0.0f, 255.0f));
+}
+
+// Float reference of limited range BT.601.
+static void BM_RGBToYCbCrScalar(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<YCbCrColor> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const float r = colors[i].r, g = colors[i].g, b = colors[i].b;
+			const float y = 16.0f + 0.256788f * r + 0.504129f * g + 0.0979059f * b;
+			const float cb = 128.0f - 0.148223f * r - 0.290993f * g + 0.439216f * b;
+			const float cr = 128.0f + 0.439216f * r - 0.367788f * g - 0.0714274f * b;
+			out[i] = YCbCrColor{ RoundByte(y), RoundByte(cb), RoundByte(cr), colors[i].a };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_RGBToYCbCr(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<YCbCrColor> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		RGBToYCbCr(colors.data(), YCbCrFormat::BT601, PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_RGBToYCbCrPlanar(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<uint8> y(PixelNum), cb(PixelNum), cr(PixelNum);
+
+	for (auto _ : state)
+	{
+		RGBToYCbCr(colors.data(), YCbCrFormat::BT601, PixelNum, y.data(), cb.data(), cr.data());
+		benchmark::DoNotOptimize(y.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_YCbCrToRGBScalar(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const auto& yCbCr = reinterpret_cast<const YCbCrColor&>(colors[i]);
+			const float y = 1.16438f * (yCbCr.y - 16.0f), cb = yCbCr.cb - 128.0f, cr = yCbCr.cr - 128.0f;
+			out[i] = Color{ RoundByte(y + 1.59603f * cr), RoundByte(y - 0.391762f * cb - 0.812968f * cr),
+				RoundByte(y + 2.01723f * cb), yCbCr.a };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_YCbCrToRGB(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		YCbCrToRGB(reinterpret_cast<const YCbCrColor*>(colors.data()), YCbCrFormat::BT601, PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_YCbCrToRGBPlanar(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	const auto* planes = reinterpret_cast<const uint8*>(colors.data());
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		YCbCrToRGB(planes, planes + PixelNum, planes + PixelNum * 2, YCbCrFormat::BT601, PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_RGBToHSVScalar(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<HSVColor> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const float r = colors[i].r / 255.0f, g = colors[i].g / 255.0f, b = colors[i].b / 255.0f;
+			const float max = std::max({ r, g, b }), delta = max - std::min({ r, g, b });
+
+			float hue = 0.0f;
+			if (delta > 0.0f)
+			{
+				if (max == r) hue = (g - b) / delta;
+				else if (max == g) hue = (b - r) / delta + 2.0f;
+				else hue = (r - g) / delta + 4.0f;
+				hue = hue < 0.0f ? hue * 60.0f + 360.0f : hue * 60.0f;
+			}
+
+			out[i] = HSVColor{ hue, max > 0.0f ? delta / max : 0.0f, max, colors[i].a / 255.0f };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_RGBToHSV(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<HSVColor> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		RGBToHSV(colors.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_HSVToRGB(benchmark::State& state)
+{
+	std::vector<HSVColor> colors(PixelNum);
+	RGBToHSV(MakePixels(1u).data(), PixelNum, colors.data());
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		HSVToRGB(colors.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_RGBToHSL(benchmark::State& state)
+{
+	const auto colors = MakePixels(1u);
+	std::vector<HSLColor> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		RGBToHSL(colors.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_HSLToRGB(benchmark::State& state)
+{
+	std::vector<HSLColor> colors(PixelNum);
+	RGBToHSL(MakePixels(1u).data(), PixelNum, colors.data());
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		HSLToRGB(colors.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+BENCHMARK(BM_RGBToYCbCrScalar);
+BENCHMARK(BM_RGBToYCbCr);
+BENCHMARK(BM_RGBToYCbCrPlanar);
+BENCHMARK(BM_YCbCrToRGBScalar);
+BENCHMARK(BM_YCbCrToRGB);
+BENCHMARK(BM_YCbCrToRGBPlanar);
+BENCHMARK(BM_RGBToHSVScalar);
+BENCHMARK(BM_RGBToHSV);
+BENCHMARK(BM_HSVToRGB);
+BENCHMARK(BM_RGBToHSL);
+BENCHMARK(BM_HSLToRGB);
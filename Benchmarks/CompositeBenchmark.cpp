@@ -0,0 +1,117 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Composite.h"
+
+using namespace BSMath;
+
+constexpr size_t PixelNum = 1 << 20;
+
+static std::vector<Color> MakePremultiplied(uint32 seed)
+{
+	std::vector<Color> pixels(PixelNum);
+	Pcg32 engine{ seed };
+	for (auto& pixel : pixels)
+		pixel = Color{ engine() };
+
+	Premultiply(pixels.data(), pixels.size(), pixels.data());
+	return pixels;
+}
+
+// Float reference of src over dst on premultiplied colors.
+static void BM_OverScalar(benchmark::State& state)
+{
+	const auto src = MakePremultiplied(1u), dst = MakePremultiplied(2u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const float inv = 1.0f - src[i].a / 255.0f;
+			const auto over = [=](uint8 s, uint8 d) { return static_cast<uint8>(s + d * inv + 0.5f); };
+			out[i] = Color{ over(src[i].r, dst[i].r), over(src[i].g, dst[i].g), over(src[i].b, dst[i].b), over(src[i].a, dst[i].a) };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_PremultiplyScalar(benchmark::State& state)
+{
+	const auto colors = MakePremultiplied(1u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const float alpha = colors[i].a / 255.0f;
+			const auto scale = [=](uint8 c) { return static_cast<uint8>(c * alpha + 0.5f); };
+			out[i] = Color{ scale(colors[i].r), scale(colors[i].g), scale(colors[i].b), colors[i].a };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_UnpremultiplyScalar(benchmark::State& state)
+{
+	const auto colors = MakePremultiplied(1u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const float scale = colors[i].a == 0 ? 0.0f : 255.0f / colors[i].a;
+			const auto divide = [=](uint8 c) { return static_cast<uint8>(Min(c * scale + 0.5f, 255.0f)); };
+			out[i] = Color{ divide(colors[i].r), divide(colors[i].g), divide(colors[i].b), colors[i].a };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+template <void(*Func)(const Color*, size_t, Color*)>
+static void BM_Convert(benchmark::State& state)
+{
+	const auto colors = MakePremultiplied(1u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		Func(colors.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+template <void(*Func)(const Color*, const Color*, size_t, Color*)>
+static void BM_Composite(benchmark::State& state)
+{
+	const auto src = MakePremultiplied(1u), dst = MakePremultiplied(2u);
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		Func(src.data(), dst.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+BENCHMARK(BM_PremultiplyScalar);
+BENCHMARK_TEMPLATE(BM_Convert, Premultiply);
+BENCHMARK(BM_UnpremultiplyScalar);
+BENCHMARK_TEMPLATE(BM_Convert, Unpremultiply);
+BENCHMARK(BM_OverScalar);
+BENCHMARK_TEMPLATE(BM_Composite, CompositeOver);
+BENCHMARK_TEMPLATE(BM_Composite, CompositeIn);
+BENCHMARK_TEMPLATE(BM_Composite, CompositeOut);
+BENCHMARK_TEMPLATE(BM_Composite, CompositeAtop);
+BENCHMARK_TEMPLATE(BM_Composite, CompositeXor);
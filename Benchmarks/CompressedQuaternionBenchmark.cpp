@@ -0,0 +1,97 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/CompressedQuaternion.h"
+#include "BSMath/Sampling.h"
+
+using namespace BSMath;
+
+constexpr size_t QuaternionNum = 1 << 14;
+
+static std::vector<Quaternion> MakeQuaternions()
+{
+	std::vector<Quaternion> quats(QuaternionNum);
+	Pcg32 engine{ 1u };
+	QuaternionDistribution dist;
+	for (auto& quat : quats)
+		quat = dist(engine);
+	return quats;
+}
+
+template <size_t ComponentBits>
+static void BM_CompressScalar(benchmark::State& state)
+{
+	const auto quats = MakeQuaternions();
+	std::vector<CompressedQuaternion<ComponentBits>> out(QuaternionNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < QuaternionNum; ++i)
+			out[i] = CompressedQuaternion<ComponentBits>{ quats[i] };
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * QuaternionNum);
+}
+
+template <size_t ComponentBits>
+static void BM_Compress(benchmark::State& state)
+{
+	const auto quats = MakeQuaternions();
+	std::vector<CompressedQuaternion<ComponentBits>> out(QuaternionNum);
+
+	for (auto _ : state)
+	{
+		Compress(quats.data(), QuaternionNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * QuaternionNum);
+
+	const auto error = MeasureCompressionError<ComponentBits>(quats.data(), QuaternionNum);
+	state.counters["MaxDegree"] = Rad2Deg(error.maxAngle);
+	state.counters["MeanDegree"] = Rad2Deg(error.meanAngle);
+}
+
+template <size_t ComponentBits>
+static void BM_DecompressScalar(benchmark::State& state)
+{
+	const auto quats = MakeQuaternions();
+	std::vector<CompressedQuaternion<ComponentBits>> compressed(QuaternionNum);
+	Compress(quats.data(), QuaternionNum, compressed.data());
+	std::vector<Quaternion> out(QuaternionNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < QuaternionNum; ++i)
+			out[i] = compressed[i].ToQuaternion();
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * QuaternionNum);
+}
+
+template <size_t ComponentBits>
+static void BM_Decompress(benchmark::State& state)
+{
+	const auto quats = MakeQuaternions();
+	std::vector<CompressedQuaternion<ComponentBits>> compressed(QuaternionNum);
+	Compress(quats.data(), QuaternionNum, compressed.data());
+	std::vector<Quaternion> out(QuaternionNum);
+
+	for (auto _ : state)
+	{
+		Decompress(compressed.data(), QuaternionNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * QuaternionNum);
+}
+
+BENCHMARK_TEMPLATE(BM_CompressScalar, 10);
+BENCHMARK_TEMPLATE(BM_Compress, 10);
+BENCHMARK_TEMPLATE(BM_Compress, 15);
+BENCHMARK_TEMPLATE(BM_Compress, 20);
+BENCHMARK_TEMPLATE(BM_DecompressScalar, 10);
+BENCHMARK_TEMPLATE(BM_Decompress, 10);
+BENCHMARK_TEMPLATE(BM_Decompress, 15);
+BENCHMARK_TEMPLATE(BM_Decompress, 20);
@@ -0,0 +1,103 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/DualQuaternion.h"
+#include "BSMath/Sampling.h"
+
+using namespace BSMath;
+
+constexpr size_t BoneNum = 64;
+constexpr size_t VertexNum = 1 << 16;
+
+namespace
+{
+	struct Mesh final
+	{
+		std::vector<DualQuaternion> bones;
+		std::vector<uint16> indices;
+		std::vector<Vector4> weights;
+		std::vector<Vector3> positions;
+		std::vector<Vector3> normals;
+	};
+
+	Mesh MakeMesh()
+	{
+		Mesh mesh;
+		Pcg32 engine{ 1u };
+		std::uniform_real_distribution<float> dist{ 0.0f, 1.0f };
+		std::uniform_int_distribution<int> indexDist{ 0, BoneNum - 1 };
+		QuaternionDistribution rotationDist;
+
+		mesh.bones.resize(BoneNum);
+		for (auto& bone : mesh.bones)
+			bone = DualQuaternion{ rotationDist(engine), Vector3{ dist(engine), dist(engine), dist(engine) } };
+
+		mesh.indices.resize(VertexNum * 4);
+		for (auto& index : mesh.indices)
+			index = static_cast<uint16>(indexDist(engine));
+
+		mesh.weights.resize(VertexNum);
+		mesh.positions.resize(VertexNum);
+		mesh.normals.resize(VertexNum);
+		for (size_t i = 0; i < VertexNum; ++i)
+		{
+			mesh.weights[i] = Vector4{ dist(engine), dist(engine), dist(engine), dist(engine) };
+			mesh.weights[i] /= mesh.weights[i].x + mesh.weights[i].y + mesh.weights[i].z + mesh.weights[i].w;
+			mesh.positions[i] = Vector3{ dist(engine), dist(engine), dist(engine) };
+			mesh.normals[i] = Vector3::GetNormal(mesh.positions[i] - Vector3{ 0.5f });
+		}
+
+		return mesh;
+	}
+}
+
+static void BM_SkinVerticesScalar(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	std::vector<Vector3> out(VertexNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < VertexNum; ++i)
+		{
+			const auto* index = mesh.indices.data() + i * 4;
+			const DualQuaternion influences[]{ mesh.bones[index[0]], mesh.bones[index[1]], mesh.bones[index[2]], mesh.bones[index[3]] };
+			out[i] = Blend(influences, mesh.weights[i].data, 4).TransformPoint(mesh.positions[i]);
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+static void BM_SkinVertices(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	std::vector<Vector3> out(VertexNum);
+
+	for (auto _ : state)
+	{
+		SkinVertices(mesh.bones.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), VertexNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+static void BM_SkinVerticesWithNormals(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	std::vector<Vector3> out(VertexNum), outNormals(VertexNum);
+
+	for (auto _ : state)
+	{
+		SkinVertices(mesh.bones.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), mesh.normals.data(), VertexNum, out.data(), outNormals.data());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::DoNotOptimize(outNormals.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+BENCHMARK(BM_SkinVerticesScalar);
+BENCHMARK(BM_SkinVertices);
+BENCHMARK(BM_SkinVerticesWithNormals);
@@ -0,0 +1,104 @@
+#include <random>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Creator.h"
+#include "BSMath/Frustum.h"
+
+using namespace BSMath;
+
+namespace
+{
+	Frustum MakeFrustum()
+	{
+		using namespace Creator::Matrix;
+		const auto view = FromLookAt(Vector3::Zero, Vector3::Forward, Vector3::Up);
+		const auto proj = FromPerspective(Vector2{ 16.0f, 9.0f }, 0.1f, 500.0f, Pi / 3.0f);
+		return Frustum{ view * proj };
+	}
+
+	std::vector<float> MakeStream(size_t size, float min, float max)
+	{
+		std::mt19937 engine{ 0 };
+		std::uniform_real_distribution<float> dist{ min, max };
+
+		std::vector<float> ret(size);
+		for (auto& value : ret)
+			value = dist(engine);
+		return ret;
+	}
+}
+
+static void BM_CullSpheres(benchmark::State& state)
+{
+	const auto size = static_cast<size_t>(state.range(0));
+	const auto frustum = MakeFrustum();
+	const auto x = MakeStream(size, -500.0f, 500.0f);
+	const auto y = MakeStream(size, -500.0f, 500.0f);
+	const auto z = MakeStream(size, -500.0f, 500.0f);
+	const auto radii = MakeStream(size, 0.5f, 10.0f);
+	std::vector<uint8> mask((size + 7) / 8);
+
+	for (auto _ : state)
+	{
+		CullSpheres(frustum, VectorSoA<const float, 3>{ x.data(), y.data(), z.data() }, radii.data(), size, mask.data());
+		benchmark::DoNotOptimize(mask.data());
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * size);
+}
+
+static void BM_CullSpheresScalar(benchmark::State& state)
+{
+	const auto size = static_cast<size_t>(state.range(0));
+	const auto frustum = MakeFrustum();
+	const auto x = MakeStream(size, -500.0f, 500.0f);
+	const auto y = MakeStream(size, -500.0f, 500.0f);
+	const auto z = MakeStream(size, -500.0f, 500.0f);
+	const auto radii = MakeStream(size, 0.5f, 10.0f);
+	std::vector<uint8> visible(size);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < size; ++i)
+			visible[i] = frustum.Intersect(Vector3{ x[i], y[i], z[i] }, radii[i]);
+
+		benchmark::DoNotOptimize(visible.data());
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * size);
+}
+
+static void BM_CullBoxes(benchmark::State& state)
+{
+	const auto size = static_cast<size_t>(state.range(0));
+	const auto frustum = MakeFrustum();
+	const auto minX = MakeStream(size, -500.0f, 500.0f);
+	const auto minY = MakeStream(size, -500.0f, 500.0f);
+	const auto minZ = MakeStream(size, -500.0f, 500.0f);
+
+	std::vector<float> maxX(size), maxY(size), maxZ(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		maxX[i] = minX[i] + 5.0f;
+		maxY[i] = minY[i] + 5.0f;
+		maxZ[i] = minZ[i] + 5.0f;
+	}
+
+	std::vector<uint8> mask((size + 7) / 8);
+
+	for (auto _ : state)
+	{
+		CullBoxes(frustum, VectorSoA<const float, 3>{ minX.data(), minY.data(), minZ.data() },
+			VectorSoA<const float, 3>{ maxX.data(), maxY.data(), maxZ.data() }, size, mask.data());
+		benchmark::DoNotOptimize(mask.data());
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK(BM_CullSpheres)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_CullSpheresScalar)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_CullBoxes)->Arg(1 << 16)->Arg(1 << 20);
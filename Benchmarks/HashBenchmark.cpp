@@ -0,0 +1,46 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Hash.h"
+#include "BSMath/Matrix.h"
+#include "BSMath/Vector.h"
+
+using namespace BSMath;
+
+template <class T, class Hasher>
+static void BM_Hash(benchmark::State& state)
+{
+	std::vector<T> values(1024);
+	for (size_t i = 0; i < values.size(); ++i)
+		values[i] = T{ static_cast<float>(i) };
+
+	size_t idx = 0;
+	for (auto _ : state)
+	{
+		const auto& value = values[idx++ & 1023];
+		benchmark::DoNotOptimize(Hasher::Hash(value.data, sizeof(value.data)));
+	}
+
+	state.SetBytesProcessed(state.iterations() * sizeof(T::data));
+}
+
+template <class T>
+static void BM_FloatHash(benchmark::State& state)
+{
+	std::vector<T> values(1024);
+	for (size_t i = 0; i < values.size(); ++i)
+		values[i] = T{ static_cast<float>(i) };
+
+	const Hash<T> hash;
+	size_t idx = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(hash(values[idx++ & 1023]));
+
+	state.SetBytesProcessed(state.iterations() * sizeof(T::data));
+}
+
+BENCHMARK_TEMPLATE(BM_Hash, Vector3, WyHasher);
+BENCHMARK_TEMPLATE(BM_Hash, Vector3, FnvHasher);
+BENCHMARK_TEMPLATE(BM_Hash, Matrix4, WyHasher);
+BENCHMARK_TEMPLATE(BM_Hash, Matrix4, FnvHasher);
+BENCHMARK_TEMPLATE(BM_FloatHash, Vector3);
+BENCHMARK_TEMPLATE(BM_FloatHash, Matrix4);
@@ -0,0 +1,99 @@
+#include <cmath>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/LinearColor.h"
+
+using namespace BSMath;
+
+constexpr size_t PixelNum = 1 << 16;
+
+static std::vector<LinearColor> MakeLinearColors()
+{
+	std::vector<LinearColor> colors(PixelNum);
+	Pcg32 engine{ 1u };
+	std::uniform_real_distribution<float> dist;
+	for (auto& color : colors)
+		color = LinearColor{ dist(engine), dist(engine), dist(engine), dist(engine) };
+	return colors;
+}
+
+static uint8 EncodePow(float linear)
+{
+	const float n = Clamp(linear, 0.0f, 1.0f);
+	const float srgb = n <= 0.0031308f ? n * 12.92f : 1.055f * std::pow(n, 1.0f / 2.4f) - 0.055f;
+	return static_cast<uint8>(srgb * 255.0f + 0.5f);
+}
+
+static void BM_EncodePow(benchmark::State& state)
+{
+	const auto colors = MakeLinearColors();
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			const auto& color = colors[i];
+			out[i] = Color{ EncodePow(color.r), EncodePow(color.g), EncodePow(color.b), static_cast<uint8>(color.a * 255.0f + 0.5f) };
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_EncodeSRGB(benchmark::State& state)
+{
+	const auto colors = MakeLinearColors();
+	std::vector<Color> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		EncodeSRGB(colors.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_DecodePow(benchmark::State& state)
+{
+	std::vector<Color> colors(PixelNum);
+	EncodeSRGB(MakeLinearColors().data(), PixelNum, colors.data());
+	std::vector<LinearColor> out(PixelNum);
+
+	const auto decode = [](uint8 level)
+	{
+		const float srgb = level / 255.0f;
+		return srgb <= 0.04045f ? srgb / 12.92f : std::pow((srgb + 0.055f) / 1.055f, 2.4f);
+	};
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+			out[i] = LinearColor{ decode(colors[i].r), decode(colors[i].g), decode(colors[i].b), colors[i].a / 255.0f };
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_DecodeSRGB(benchmark::State& state)
+{
+	std::vector<Color> colors(PixelNum);
+	EncodeSRGB(MakeLinearColors().data(), PixelNum, colors.data());
+	std::vector<LinearColor> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		DecodeSRGB(colors.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+BENCHMARK(BM_EncodePow);
+BENCHMARK(BM_EncodeSRGB);
+BENCHMARK(BM_DecodePow);
+BENCHMARK(BM_DecodeSRGB);
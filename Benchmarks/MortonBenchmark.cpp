@@ -0,0 +1,82 @@
+#include <random>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Morton.h"
+
+using namespace BSMath;
+
+namespace
+{
+	struct Points final
+	{
+		explicit Points(size_t size) : xs(size), ys(size), zs(size)
+		{
+			std::mt19937 engine{ 0 };
+			std::uniform_real_distribution<float> dist{ -100.0f, 100.0f };
+			for (size_t i = 0; i < size; ++i)
+			{
+				xs[i] = dist(engine);
+				ys[i] = dist(engine);
+				zs[i] = dist(engine);
+			}
+		}
+
+		[[nodiscard]] VectorSoA<const float, 3> GetSoA() const noexcept { return VectorSoA<const float, 3>{ xs.data(), ys.data(), zs.data() }; }
+
+		std::vector<float> xs, ys, zs;
+	};
+
+	const AABB Bounds{ Vector3{ -100.0f }, Vector3{ 100.0f } };
+}
+
+template <class Key>
+static void BM_EncodeMortons(benchmark::State& state)
+{
+	const Points points{ static_cast<size_t>(state.range(0)) };
+	std::vector<Key> keys(points.xs.size());
+
+	for (auto _ : state)
+	{
+		EncodeMortons(Bounds, points.GetSoA(), keys.size(), keys.data());
+		benchmark::DoNotOptimize(keys.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_EncodeHilbert(benchmark::State& state)
+{
+	const Points points{ static_cast<size_t>(state.range(0)) };
+	const auto soa = points.GetSoA();
+	std::vector<uint32> keys(points.xs.size());
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < keys.size(); ++i)
+			keys[i] = EncodeHilbert(soa.Get(i), Bounds);
+		benchmark::DoNotOptimize(keys.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Key>
+static void BM_SortByMorton(benchmark::State& state)
+{
+	const Points points{ static_cast<size_t>(state.range(0)) };
+	std::vector<uint32> indices(points.xs.size());
+
+	for (auto _ : state)
+	{
+		SortByMorton<Key>(Bounds, points.GetSoA(), indices.size(), indices.data());
+		benchmark::DoNotOptimize(indices.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_EncodeMortons, uint32)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_EncodeMortons, uint64)->Arg(1 << 20);
+BENCHMARK(BM_EncodeHilbert)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SortByMorton, uint32)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SortByMorton, uint64)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
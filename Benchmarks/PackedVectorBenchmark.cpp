@@ -0,0 +1,158 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/PackedVector.h"
+
+using namespace BSMath;
+
+constexpr size_t ValueNum = 1 << 16;
+
+static std::vector<float> MakeValues()
+{
+	std::vector<float> values(ValueNum);
+	Pcg32 engine{ 1u };
+	std::uniform_real_distribution<float> dist{ -1.0f, 1.0f };
+	for (auto& value : values)
+		value = dist(engine);
+	return values;
+}
+
+static std::vector<Vector3> MakeVectors()
+{
+	const auto values = MakeValues();
+	std::vector<Vector3> vectors(ValueNum / 3);
+	for (size_t i = 0; i < vectors.size(); ++i)
+		vectors[i] = Vector3{ values.data() + i * 3 };
+	return vectors;
+}
+
+static void BM_ToHalfScalar(benchmark::State& state)
+{
+	const auto values = MakeValues();
+	std::vector<Half> out(ValueNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < ValueNum; ++i)
+			out[i] = Half{ values[i] };
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * ValueNum);
+}
+
+static void BM_ToHalf(benchmark::State& state)
+{
+	const auto values = MakeValues();
+	std::vector<Half> out(ValueNum);
+
+	for (auto _ : state)
+	{
+		ConvertToHalf(values.data(), ValueNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * ValueNum);
+}
+
+static void BM_FromHalfScalar(benchmark::State& state)
+{
+	const auto values = MakeValues();
+	std::vector<Half> halves(ValueNum);
+	ConvertToHalf(values.data(), ValueNum, halves.data());
+	std::vector<float> out(ValueNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < ValueNum; ++i)
+			out[i] = halves[i];
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * ValueNum);
+}
+
+static void BM_FromHalf(benchmark::State& state)
+{
+	const auto values = MakeValues();
+	std::vector<Half> halves(ValueNum);
+	ConvertToHalf(values.data(), ValueNum, halves.data());
+	std::vector<float> out(ValueNum);
+
+	for (auto _ : state)
+	{
+		ConvertFromHalf(halves.data(), ValueNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * ValueNum);
+}
+
+template <class Packed>
+static void BM_PackVector3Scalar(benchmark::State& state)
+{
+	const auto vectors = MakeVectors();
+	std::vector<Packed> out(vectors.size());
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < vectors.size(); ++i)
+			out[i] = Packed{ vectors[i] };
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+
+static void BM_PackHalfVector3(benchmark::State& state)
+{
+	const auto vectors = MakeVectors();
+	std::vector<HalfVector3> out(vectors.size());
+
+	for (auto _ : state)
+	{
+		ConvertToHalf(vectors.data(), vectors.size(), out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+
+static void BM_PackSNorm16Vector3(benchmark::State& state)
+{
+	const auto vectors = MakeVectors();
+	std::vector<SNorm16Vector3> out(vectors.size());
+
+	for (auto _ : state)
+	{
+		ConvertToNormalized(vectors.data(), vectors.size(), out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+
+static void BM_UnpackSNorm16Vector3(benchmark::State& state)
+{
+	const auto vectors = MakeVectors();
+	std::vector<SNorm16Vector3> packed(vectors.size());
+	ConvertToNormalized(vectors.data(), vectors.size(), packed.data());
+	std::vector<Vector3> out(vectors.size());
+
+	for (auto _ : state)
+	{
+		ConvertFromNormalized(packed.data(), packed.size(), out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+
+BENCHMARK(BM_ToHalfScalar);
+BENCHMARK(BM_ToHalf);
+BENCHMARK(BM_FromHalfScalar);
+BENCHMARK(BM_FromHalf);
+BENCHMARK_TEMPLATE(BM_PackVector3Scalar, HalfVector3);
+BENCHMARK(BM_PackHalfVector3);
+BENCHMARK_TEMPLATE(BM_PackVector3Scalar, SNorm16Vector3);
+BENCHMARK(BM_PackSNorm16Vector3);
+BENCHMARK(BM_UnpackSNorm16Vector3);
@@ -0,0 +1,137 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Palette.h"
+
+using namespace BSMath;
+
+constexpr size_t Width = 256, Height = 256, PixelNum = Width * Height;
+
+static std::vector<Color> MakePixels()
+{
+	std::vector<Color> pixels(PixelNum);
+	Pcg32 engine{ 1u };
+	for (auto& pixel : pixels)
+		pixel = Color{ engine() };
+	return pixels;
+}
+
+static void BM_Build(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	for (auto _ : state)
+	{
+		Palette palette{ pixels.data(), pixels.size(), 256, static_cast<size_t>(state.range(0)) };
+		benchmark::DoNotOptimize(palette.GetColors().data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_MapScalar(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	const Palette palette{ pixels.data(), pixels.size(), static_cast<size_t>(state.range(0)) };
+	const auto& colors = palette.GetColors();
+	std::vector<uint8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PixelNum; ++i)
+		{
+			int best = std::numeric_limits<int>::max();
+			for (size_t j = 0; j < colors.size(); ++j)
+			{
+				const int r = pixels[i].r - colors[j].r, g = pixels[i].g - colors[j].g, b = pixels[i].b - colors[j].b;
+				const int dist = r * r + g * g + b * b;
+				if (dist < best)
+				{
+					best = dist;
+					out[i] = static_cast<uint8>(j);
+				}
+			}
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_Map(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	const Palette palette{ pixels.data(), pixels.size(), static_cast<size_t>(state.range(0)) };
+	std::vector<uint8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		palette.Map(pixels.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_MapCached(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	Palette palette{ pixels.data(), pixels.size(), static_cast<size_t>(state.range(0)) };
+	palette.EnableCache();
+	std::vector<uint8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		palette.Map(pixels.data(), PixelNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_EnableCache(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	Palette palette{ pixels.data(), pixels.size(), 256 };
+
+	for (auto _ : state)
+		palette.EnableCache();
+}
+
+static void BM_MapOrdered(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	Palette palette{ pixels.data(), pixels.size(), 256 };
+	palette.EnableCache();
+	std::vector<uint8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		palette.MapOrdered(pixels.data(), Width, Height, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+static void BM_MapDiffused(benchmark::State& state)
+{
+	const auto pixels = MakePixels();
+	Palette palette{ pixels.data(), pixels.size(), 256 };
+	palette.EnableCache();
+	std::vector<uint8> out(PixelNum);
+
+	for (auto _ : state)
+	{
+		palette.MapDiffused(pixels.data(), Width, Height, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PixelNum);
+}
+
+BENCHMARK(BM_Build)->Arg(0)->Arg(2);
+BENCHMARK(BM_MapScalar)->Arg(16)->Arg(256);
+BENCHMARK(BM_Map)->Arg(16)->Arg(256);
+BENCHMARK(BM_MapCached)->Arg(256);
+BENCHMARK(BM_EnableCache);
+BENCHMARK(BM_MapOrdered);
+BENCHMARK(BM_MapDiffused);
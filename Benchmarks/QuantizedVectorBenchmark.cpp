@@ -0,0 +1,130 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/QuantizedVector.h"
+
+using namespace BSMath;
+
+constexpr size_t PointNum = 1 << 14;
+
+static const AABB Bounds{ Vector3{ -100.0f, -10.0f, -100.0f }, Vector3{ 100.0f, 50.0f, 100.0f } };
+
+static std::vector<Vector3> MakePoints(uint32 seed)
+{
+	std::vector<Vector3> points(PointNum);
+	Pcg32 engine{ seed };
+	std::uniform_real_distribution<float> dist{ 0.0f, 1.0f };
+	for (auto& point : points)
+		point = Bounds.min + Vector3{ dist(engine), dist(engine), dist(engine) } * Bounds.GetSize();
+	return points;
+}
+
+static void BM_QuantizeScalar(benchmark::State& state)
+{
+	const auto points = MakePoints(1u);
+	const QuantizationGrid grid{ Bounds, 16 };
+	std::vector<QuantizedVector48> out(PointNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PointNum; ++i)
+			out[i] = grid.Quantize<16>(points[i]);
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+template <size_t ComponentBits>
+static void BM_Quantize(benchmark::State& state)
+{
+	const auto points = MakePoints(1u);
+	const QuantizationGrid grid{ Bounds, ComponentBits };
+	std::vector<QuantizedVector3<ComponentBits>> out(PointNum);
+
+	for (auto _ : state)
+	{
+		grid.Quantize(points.data(), PointNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+static void BM_DequantizeScalar(benchmark::State& state)
+{
+	const auto points = MakePoints(1u);
+	const QuantizationGrid grid{ Bounds, 16 };
+	std::vector<QuantizedVector48> quantized(PointNum);
+	grid.Quantize(points.data(), PointNum, quantized.data());
+	std::vector<Vector3> out(PointNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PointNum; ++i)
+			out[i] = grid.Dequantize(quantized[i]);
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+template <size_t ComponentBits>
+static void BM_Dequantize(benchmark::State& state)
+{
+	const auto points = MakePoints(1u);
+	const QuantizationGrid grid{ Bounds, ComponentBits };
+	std::vector<QuantizedVector3<ComponentBits>> quantized(PointNum);
+	grid.Quantize(points.data(), PointNum, quantized.data());
+	std::vector<Vector3> out(PointNum);
+
+	for (auto _ : state)
+	{
+		grid.Dequantize(quantized.data(), PointNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+static void BM_EncodeDelta(benchmark::State& state)
+{
+	const QuantizationGrid grid{ Bounds, 16 };
+	std::vector<QuantizedVector48> previous(PointNum), current(PointNum), out(PointNum);
+	grid.Quantize(MakePoints(1u).data(), PointNum, previous.data());
+	grid.Quantize(MakePoints(2u).data(), PointNum, current.data());
+
+	for (auto _ : state)
+	{
+		EncodeDelta(current.data(), previous.data(), PointNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+static void BM_DecodeDelta(benchmark::State& state)
+{
+	const QuantizationGrid grid{ Bounds, 16 };
+	std::vector<QuantizedVector48> previous(PointNum), deltas(PointNum), out(PointNum);
+	grid.Quantize(MakePoints(1u).data(), PointNum, previous.data());
+	grid.Quantize(MakePoints(2u).data(), PointNum, deltas.data());
+
+	for (auto _ : state)
+	{
+		DecodeDelta(deltas.data(), previous.data(), PointNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+BENCHMARK(BM_QuantizeScalar);
+BENCHMARK_TEMPLATE(BM_Quantize, 10);
+BENCHMARK_TEMPLATE(BM_Quantize, 16);
+BENCHMARK_TEMPLATE(BM_Quantize, 21);
+BENCHMARK(BM_DequantizeScalar);
+BENCHMARK_TEMPLATE(BM_Dequantize, 10);
+BENCHMARK_TEMPLATE(BM_Dequantize, 16);
+BENCHMARK_TEMPLATE(BM_Dequantize, 21);
+BENCHMARK(BM_EncodeDelta);
+BENCHMARK(BM_DecodeDelta);
@@ -0,0 +1,100 @@
+#include <random>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Rand.h"
+
+using namespace BSMath;
+
+constexpr size_t FloatNum = 1 << 16;
+
+static void BM_Mt19937Floats(benchmark::State& state)
+{
+	std::mt19937 engine{ 0 };
+	std::uniform_real_distribution<float> dist;
+	std::vector<float> floats(FloatNum);
+
+	for (auto _ : state)
+	{
+		for (auto& n : floats)
+			n = dist(engine);
+		benchmark::DoNotOptimize(floats.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * FloatNum);
+}
+
+template <class Engine>
+static void BM_FillFloats(benchmark::State& state)
+{
+	Engine engine{ 0 };
+	std::vector<float> floats(FloatNum);
+
+	for (auto _ : state)
+	{
+		engine.FillUniform(floats.data(), floats.size());
+		benchmark::DoNotOptimize(floats.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * FloatNum);
+}
+
+template <class Engine>
+static void BM_Vector3Random(benchmark::State& state)
+{
+	Random<Vector3, Engine, VectorDistribution<float, 3>> random;
+	std::vector<Vector3> vecs(FloatNum / 4);
+
+	for (auto _ : state)
+	{
+		if (state.range(0))
+		{
+			random.Fill(vecs.data(), vecs.size());
+		}
+		else
+		{
+			for (auto& vec : vecs)
+				vec = random();
+		}
+		benchmark::DoNotOptimize(vecs.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * vecs.size());
+}
+
+// A short-lived generator as the old Random built one.
+static void BM_ConstructRandomDevice(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		std::mt19937 engine{ std::random_device{}() };
+		benchmark::DoNotOptimize(std::uniform_real_distribution<float>{}(engine));
+	}
+}
+
+template <class Engine>
+static void BM_ConstructRandom(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		Random<float, Engine, std::uniform_real_distribution<float>> random;
+		benchmark::DoNotOptimize(random());
+	}
+}
+
+static void BM_RandFloat(benchmark::State& state)
+{
+	for (auto _ : state)
+		benchmark::DoNotOptimize(Rand::Float());
+}
+
+BENCHMARK(BM_Mt19937Floats);
+BENCHMARK_TEMPLATE(BM_FillFloats, BasicXoshiro128<4>);
+BENCHMARK_TEMPLATE(BM_FillFloats, BasicXoshiro128<8>);
+BENCHMARK_TEMPLATE(BM_FillFloats, Philox4x32);
+BENCHMARK_TEMPLATE(BM_Vector3Random, std::mt19937)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Vector3Random, Xoshiro128)->Arg(0)->Arg(1);
+BENCHMARK(BM_ConstructRandomDevice);
+BENCHMARK_TEMPLATE(BM_ConstructRandom, std::mt19937);
+BENCHMARK_TEMPLATE(BM_ConstructRandom, Xoshiro128);
+BENCHMARK_TEMPLATE(BM_ConstructRandom, Pcg32);
+BENCHMARK(BM_RandFloat);
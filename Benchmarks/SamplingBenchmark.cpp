@@ -0,0 +1,36 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Sampling.h"
+
+using namespace BSMath;
+
+constexpr size_t SampleNum = 1 << 14;
+
+template <class T, class Distributor>
+static void BM_Sample(benchmark::State& state)
+{
+	Random<T, DefaultRandomEngine, Distributor> random;
+	std::vector<T> samples(SampleNum);
+
+	for (auto _ : state)
+	{
+		if (state.range(0))
+		{
+			random.Fill(samples.data(), samples.size());
+		}
+		else
+		{
+			for (auto& sample : samples)
+				sample = random();
+		}
+		benchmark::DoNotOptimize(samples.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * SampleNum);
+}
+
+BENCHMARK_TEMPLATE(BM_Sample, Vector3, UnitSphereDistribution)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Sample, Vector3, UnitBallDistribution)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Sample, Vector2, UnitDiskDistribution)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Sample, Vector3, CosineHemisphereDistribution)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Sample, Quaternion, QuaternionDistribution)->Arg(0)->Arg(1);
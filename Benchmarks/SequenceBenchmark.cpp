@@ -0,0 +1,53 @@
+#include <random>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Sequence.h"
+
+using namespace BSMath;
+
+constexpr size_t PointNum = 1 << 14;
+
+static void BM_Mt19937Points(benchmark::State& state)
+{
+	Random<Vector2, std::mt19937, VectorDistribution<float, 2>> random;
+	std::vector<Vector2> points(PointNum);
+
+	for (auto _ : state)
+	{
+		for (auto& point : points)
+			point = random();
+		benchmark::DoNotOptimize(points.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+template <class Sequence>
+static void BM_SequencePoints(benchmark::State& state)
+{
+	Sequence sequence{ 1u };
+	std::vector<typename Sequence::result_type> points(PointNum);
+
+	for (auto _ : state)
+	{
+		sequence.Seek(0u);
+		if (state.range(0))
+		{
+			sequence.Fill(points.data(), points.size());
+		}
+		else
+		{
+			for (auto& point : points)
+				point = sequence();
+		}
+		benchmark::DoNotOptimize(points.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+BENCHMARK(BM_Mt19937Points);
+BENCHMARK_TEMPLATE(BM_SequencePoints, Vector2HaltonSequence)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SequencePoints, Vector2SobolSequence)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SequencePoints, R2Sequence)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SequencePoints, Vector3SobolSequence)->Arg(0)->Arg(1);
@@ -0,0 +1,153 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Sampling.h"
+#include "BSMath/Skinning.h"
+
+using namespace BSMath;
+
+constexpr size_t BoneNum = 64;
+constexpr size_t VertexNum = 1 << 16;
+
+namespace
+{
+	struct Mesh final
+	{
+		std::vector<Matrix4> bones;
+		std::vector<DualQuaternion> dqs;
+		std::vector<uint16> indices;
+		std::vector<Vector4> weights;
+		std::vector<Vector3> positions;
+		std::vector<Vector3> normals;
+	};
+
+	Mesh MakeMesh()
+	{
+		Mesh mesh;
+		Pcg32 engine{ 1u };
+		std::uniform_real_distribution<float> dist{ 0.0f, 1.0f };
+		std::uniform_int_distribution<int> indexDist{ 0, BoneNum - 1 };
+		QuaternionDistribution rotationDist;
+
+		mesh.bones.resize(BoneNum);
+		mesh.dqs.resize(BoneNum);
+		for (size_t i = 0; i < BoneNum; ++i)
+		{
+			const Transform bone{ Vector3{ dist(engine), dist(engine), dist(engine) }, rotationDist(engine), Vector3::One };
+			mesh.bones[i] = bone.ToMatrix4();
+			mesh.dqs[i] = DualQuaternion{ bone.rotation, bone.translation };
+		}
+
+		mesh.indices.resize(VertexNum * 4);
+		for (auto& index : mesh.indices)
+			index = static_cast<uint16>(indexDist(engine));
+
+		mesh.weights.resize(VertexNum);
+		mesh.positions.resize(VertexNum);
+		mesh.normals.resize(VertexNum);
+		for (size_t i = 0; i < VertexNum; ++i)
+		{
+			mesh.weights[i] = Vector4{ dist(engine), dist(engine), dist(engine), dist(engine) };
+			mesh.weights[i] /= mesh.weights[i].x + mesh.weights[i].y + mesh.weights[i].z + mesh.weights[i].w;
+			mesh.positions[i] = Vector3{ dist(engine), dist(engine), dist(engine) };
+			mesh.normals[i] = Vector3::GetNormal(mesh.positions[i] - Vector3{ 0.5f });
+		}
+
+		return mesh;
+	}
+
+	Vector3 TransformPoint(const Matrix4& mat, const Vector3& point)
+	{
+		Vector3 ret;
+		for (size_t j = 0; j < 3; ++j)
+			ret[j] = point.x * mat[0][j] + point.y * mat[1][j] + point.z * mat[2][j] + mat[3][j];
+		return ret;
+	}
+}
+
+// Each bone transforms the point on its own and the results are weighted.
+static void BM_SkinMatrixScalar(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	std::vector<Vector3> out(VertexNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < VertexNum; ++i)
+		{
+			Vector3 skinned;
+			for (size_t j = 0; j < 4; ++j)
+				skinned += TransformPoint(mesh.bones[mesh.indices[i * 4 + j]], mesh.positions[i]) * mesh.weights[i][j];
+			out[i] = skinned;
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+static void BM_SkinMatrix(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	std::vector<Vector3> out(VertexNum);
+
+	for (auto _ : state)
+	{
+		SkinVertices(mesh.bones.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), VertexNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+static void BM_SkinMatrixWithNormals(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	std::vector<Vector3> out(VertexNum), outNormals(VertexNum);
+
+	for (auto _ : state)
+	{
+		SkinVertices(mesh.bones.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), mesh.normals.data(), VertexNum, out.data(), outNormals.data());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::DoNotOptimize(outNormals.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+static void BM_SkinDualQuaternionWithNormals(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	std::vector<Vector3> out(VertexNum), outNormals(VertexNum);
+
+	for (auto _ : state)
+	{
+		SkinVertices(mesh.dqs.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), mesh.normals.data(), VertexNum, out.data(), outNormals.data());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::DoNotOptimize(outNormals.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+// The argument is the task count, zero for hardware_concurrency.
+static void BM_ParallelSkinMatrixWithNormals(benchmark::State& state)
+{
+	const auto mesh = MakeMesh();
+	const auto taskNum = static_cast<size_t>(state.range(0));
+	std::vector<Vector3> out(VertexNum), outNormals(VertexNum);
+
+	for (auto _ : state)
+	{
+		ParallelSkinVertices(mesh.bones.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), mesh.normals.data(), VertexNum, out.data(), outNormals.data(), taskNum);
+		benchmark::DoNotOptimize(out.data());
+		benchmark::DoNotOptimize(outNormals.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * VertexNum);
+}
+
+BENCHMARK(BM_SkinMatrixScalar);
+BENCHMARK(BM_SkinMatrix);
+BENCHMARK(BM_SkinMatrixWithNormals);
+BENCHMARK(BM_SkinDualQuaternionWithNormals);
+BENCHMARK(BM_ParallelSkinMatrixWithNormals)->Arg(0)->Arg(4)->UseRealTime();
@@ -0,0 +1,54 @@
+#include <random>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/SpatialHashGrid.h"
+
+using namespace BSMath;
+
+namespace
+{
+	std::vector<Vector3> MakePoints(size_t size)
+	{
+		std::mt19937 engine{ 0 };
+		std::uniform_real_distribution<float> pos{ -100.0f, 100.0f };
+
+		std::vector<Vector3> points(size);
+		for (auto& point : points)
+			point = Vector3{ pos(engine), pos(engine), pos(engine) };
+		return points;
+	}
+}
+
+static void BM_SpatialHashGridBuild(benchmark::State& state)
+{
+	const auto points = MakePoints(static_cast<size_t>(state.range(0)));
+	SpatialHashGrid grid{ 2.0f };
+
+	for (auto _ : state)
+	{
+		grid.Build(points.data(), points.size());
+		benchmark::DoNotOptimize(grid.GetCellNum());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SpatialHashGridQuery(benchmark::State& state)
+{
+	const auto points = MakePoints(static_cast<size_t>(state.range(0)));
+	const SpatialHashGrid grid{ 2.0f, points.data(), points.size() };
+	const auto queries = MakePoints(1024);
+
+	size_t idx = 0;
+	for (auto _ : state)
+	{
+		uint32 sum = 0;
+		grid.Query(queries[idx++ & 1023], 2.0f, [&](uint32 i) { sum += i; });
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SpatialHashGridBuild)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SpatialHashGridQuery)->Arg(1 << 16)->Arg(1 << 20);
@@ -0,0 +1,152 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "BSMath/Sampling.h"
+#include "BSMath/Transform.h"
+
+using namespace BSMath;
+
+constexpr size_t TransformNum = 1 << 10;
+constexpr size_t PointNum = 1 << 14;
+
+static std::vector<Transform> MakeTransforms(uint32 seed)
+{
+	std::vector<Transform> transforms(TransformNum);
+	Pcg32 engine{ seed };
+	std::uniform_real_distribution<float> dist{ -10.0f, 10.0f };
+	QuaternionDistribution rotationDist;
+	for (auto& transform : transforms)
+	{
+		transform.translation = Vector3{ dist(engine), dist(engine), dist(engine) };
+		transform.rotation = rotationDist(engine);
+		transform.scale = Vector3{ 1.5f };
+	}
+	return transforms;
+}
+
+static std::vector<Matrix4> MakeMatrices(uint32 seed)
+{
+	const auto transforms = MakeTransforms(seed);
+	std::vector<Matrix4> matrices(TransformNum);
+	ToMatrices(transforms.data(), TransformNum, matrices.data());
+	return matrices;
+}
+
+// Node i hangs under (i - 1) / 2 as in a binary heap, and the root has no parent.
+static std::vector<int32> MakeParents()
+{
+	std::vector<int32> parents(TransformNum);
+	for (size_t i = 0; i < TransformNum; ++i)
+		parents[i] = static_cast<int32>(i + 1) / 2 - 1;
+	return parents;
+}
+
+static void BM_ComposeMatrix(benchmark::State& state)
+{
+	const auto lhs = MakeMatrices(1u), rhs = MakeMatrices(2u);
+	std::vector<Matrix4> out(TransformNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < TransformNum; ++i)
+			out[i] = lhs[i] * rhs[i];
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * TransformNum);
+}
+
+static void BM_Compose(benchmark::State& state)
+{
+	const auto lhs = MakeTransforms(1u), rhs = MakeTransforms(2u);
+	std::vector<Transform> out(TransformNum);
+
+	for (auto _ : state)
+	{
+		Compose(lhs.data(), rhs.data(), TransformNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * TransformNum);
+}
+
+static void BM_ToWorldMatrix(benchmark::State& state)
+{
+	const auto locals = MakeMatrices(1u);
+	const auto parents = MakeParents();
+	std::vector<Matrix4> out(TransformNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < TransformNum; ++i)
+			out[i] = parents[i] < 0 ? locals[i] : locals[i] * out[parents[i]];
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * TransformNum);
+}
+
+static void BM_ToWorld(benchmark::State& state)
+{
+	const auto locals = MakeTransforms(1u);
+	const auto parents = MakeParents();
+	std::vector<Transform> out(TransformNum);
+
+	for (auto _ : state)
+	{
+		ToWorld(locals.data(), parents.data(), TransformNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * TransformNum);
+}
+
+static void BM_Lerp(benchmark::State& state)
+{
+	const auto from = MakeTransforms(1u), to = MakeTransforms(2u);
+	std::vector<Transform> out(TransformNum);
+
+	for (auto _ : state)
+	{
+		Lerp(from.data(), to.data(), 0.3f, TransformNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * TransformNum);
+}
+
+static void BM_TransformPointScalar(benchmark::State& state)
+{
+	const auto transform = MakeTransforms(1u)[0];
+	std::vector<Vector3> points(PointNum, Vector3{ 1.0f, 2.0f, 3.0f }), out(PointNum);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < PointNum; ++i)
+			out[i] = transform.TransformPoint(points[i]);
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+static void BM_TransformPoints(benchmark::State& state)
+{
+	const auto transform = MakeTransforms(1u)[0];
+	std::vector<Vector3> points(PointNum, Vector3{ 1.0f, 2.0f, 3.0f }), out(PointNum);
+
+	for (auto _ : state)
+	{
+		TransformPoints(transform, points.data(), PointNum, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * PointNum);
+}
+
+BENCHMARK(BM_ComposeMatrix);
+BENCHMARK(BM_Compose);
+BENCHMARK(BM_ToWorldMatrix);
+BENCHMARK(BM_ToWorld);
+BENCHMARK(BM_Lerp);
+BENCHMARK(BM_TransformPointScalar);
+BENCHMARK(BM_TransformPoints);
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <limits>
+#include "Vector.h"
+
+namespace BSMath
+{
+	struct alignas(16) AABB final
+	{
+	public:
+		static const AABB Empty;
+
+	public:
+		constexpr AABB() noexcept : min(), max() {}
+
+		explicit constexpr AABB(const Vector3& inMin, const Vector3& inMax) noexcept
+			: min(inMin), max(inMax) {}
+
+		explicit AABB(const Vector3* points, size_t size) noexcept;
+
+		constexpr void Set(const Vector3& inMin, const Vector3& inMax) noexcept
+		{
+			min = inMin; max = inMax;
+		}
+
+		[[nodiscard]] Vector3 GetCenter() const noexcept { return (min + max) * 0.5f; }
+		[[nodiscard]] Vector3 GetExtent() const noexcept { return (max - min) * 0.5f; }
+		[[nodiscard]] Vector3 GetSize() const noexcept { return max - min; }
+
+		[[nodiscard]] float SurfaceArea() const noexcept
+		{
+			const auto size = GetSize();
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		[[nodiscard]] bool IsValid() const noexcept;
+		[[nodiscard]] bool IsInside(const Vector3& point) const noexcept;
+		[[nodiscard]] bool Intersect(const AABB& other) const noexcept;
+
+		AABB& operator+=(const Vector3& point) noexcept;
+		AABB& operator+=(const AABB& other) noexcept;
+
+	public:
+		Vector3 min;
+		Vector3 max;
+	};
+
+	inline const AABB AABB::Empty
+	{
+		Vector3{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() },
+		Vector3{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() }
+	};
+
+	NO_ODR AABB::AABB(const Vector3* points, size_t size) noexcept : AABB(Empty)
+	{
+		for (size_t i = 0; i < size; ++i)
+			*this += points[i];
+	}
+
+	NO_ODR bool AABB::IsValid() const noexcept
+	{
+		using namespace SIMD;
+		return VectorMoveMask(VectorLessEqual(VectorLoad(min.data), VectorLoad(max.data))) == 0xF;
+	}
+
+	NO_ODR bool AABB::IsInside(const Vector3& point) const noexcept
+	{
+		using namespace SIMD;
+		const auto vec = VectorLoad(point.data);
+		const auto lower = VectorLessEqual(VectorLoad(min.data), vec);
+		const auto upper = VectorLessEqual(vec, VectorLoad(max.data));
+		return VectorMoveMask(VectorAnd(lower, upper)) == 0xF;
+	}
+
+	NO_ODR bool AABB::Intersect(const AABB& other) const noexcept
+	{
+		using namespace SIMD;
+		const auto lower = VectorLessEqual(VectorLoad(min.data), VectorLoad(other.max.data));
+		const auto upper = VectorLessEqual(VectorLoad(other.min.data), VectorLoad(max.data));
+		return VectorMoveMask(VectorAnd(lower, upper)) == 0xF;
+	}
+
+	NO_ODR AABB& AABB::operator+=(const Vector3& point) noexcept
+	{
+		min = Min(min, point);
+		max = Max(max, point);
+		return *this;
+	}
+
+	NO_ODR AABB& AABB::operator+=(const AABB& other) noexcept
+	{
+		min = Min(min, other.min);
+		max = Max(max, other.max);
+		return *this;
+	}
+
+	// Global Operators
+
+	[[nodiscard]] NO_ODR bool operator==(const AABB& lhs, const AABB& rhs) noexcept
+	{
+		return lhs.min == rhs.min && lhs.max == rhs.max;
+	}
+
+	[[nodiscard]] NO_ODR bool operator!=(const AABB& lhs, const AABB& rhs) noexcept { return !(lhs == rhs); }
+
+	[[nodiscard]] NO_ODR AABB operator+(const AABB& lhs, const Vector3& rhs) noexcept
+	{
+		return AABB{ lhs } += rhs;
+	}
+
+	[[nodiscard]] NO_ODR AABB operator+(const AABB& lhs, const AABB& rhs) noexcept
+	{
+		return AABB{ lhs } += rhs;
+	}
+
+	// Global Functions
+
+	[[nodiscard]] NO_ODR bool IsNearlyEqual(const AABB& lhs, const AABB& rhs, float tolerance = Epsilon) noexcept
+	{
+		return IsNearlyEqual(lhs.min, rhs.min, tolerance) && IsNearlyEqual(lhs.max, rhs.max, tolerance);
+	}
+}
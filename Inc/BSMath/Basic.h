@@ -7,6 +7,8 @@ namespace BSMath
 {
 	using namespace BSBase;
 
+	struct Half;
+
 	template <class T, size_t L>
 	struct Vector;
 
@@ -16,6 +18,9 @@ namespace BSMath
 	using IntVector3 = Vector<int, 3>;
 	using Vector4 = Vector<float, 4>;
 	using IntVector4 = Vector<int, 4>;
+	using HalfVector2 = Vector<Half, 2>;
+	using HalfVector3 = Vector<Half, 3>;
+	using HalfVector4 = Vector<Half, 4>;
 
 	template <class T, size_t L>
 	struct Matrix;
@@ -26,4 +31,13 @@ namespace BSMath
 
 	struct Quaternion;
 	struct Rotator;
+
+	struct AABB;
+	struct Plane;
+	struct Sphere;
+	struct Frustum;
+	struct Ray;
+
+	class Bvh;
+	class SpatialHashGrid;
 }
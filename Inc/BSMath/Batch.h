@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include "Utility.h"
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Calls block(in, out) on every four elements of a span, where each element covers InStride
+		// values of in and OutStride values of out. The tail is copied into value initialized buffers of
+		// a whole block and back, so block never touches memory past the spans and every element gets
+		// the same arithmetic as in whole blocks.
+		template <size_t InStride = 1, size_t OutStride = 1, class In, class Out, class Block>
+		void ForEachBlock(const In* in, size_t size, Out* out, Block&& block) noexcept
+		{
+			size_t idx = 0;
+			for (; idx + 4 <= size; idx += 4)
+				block(in + idx * InStride, out + idx * OutStride);
+
+			if (idx == size) return;
+
+			In remain[4 * InStride]{};
+			Out outRemain[4 * OutStride];
+			std::copy_n(in + idx * InStride, (size - idx) * InStride, remain);
+			block(remain, outRemain);
+			std::copy_n(outRemain, (size - idx) * OutStride, out + idx * OutStride);
+		}
+
+		// Two span version of ForEachBlock, calling block(lhs, rhs, out).
+		template <class Lhs, class Rhs, class Out, class Block>
+		void ForEachBlock(const Lhs* lhs, const Rhs* rhs, size_t size, Out* out, Block&& block) noexcept
+		{
+			size_t idx = 0;
+			for (; idx + 4 <= size; idx += 4)
+				block(lhs + idx, rhs + idx, out + idx);
+
+			if (idx == size) return;
+
+			Lhs lhsRemain[4]{};
+			Rhs rhsRemain[4]{};
+			Out outRemain[4];
+			std::copy_n(lhs + idx, size - idx, lhsRemain);
+			std::copy_n(rhs + idx, size - idx, rhsRemain);
+			block(lhsRemain, rhsRemain, outRemain);
+			std::copy_n(outRemain, size - idx, out + idx);
+		}
+	}
+}
@@ -0,0 +1,487 @@
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Ray.h"
+
+namespace BSMath
+{
+	// Four children per node with their bounds stored as SoA, so one node is tested by one packet.
+	// A child is an inner node when its count is 0, a leaf holding count primitives starting
+	// at children[i] in the primitive index list otherwise, and an empty slot when children[i] is -1.
+	struct alignas(64) BvhNode final
+	{
+	public:
+		constexpr static size_t Width = 4;
+
+	public:
+		[[nodiscard]] VectorSoA<const float, 3> GetMins() const noexcept { return VectorSoA<const float, 3>{ minX, minY, minZ }; }
+		[[nodiscard]] VectorSoA<const float, 3> GetMaxs() const noexcept { return VectorSoA<const float, 3>{ maxX, maxY, maxZ }; }
+
+		[[nodiscard]] int GetValidMask() const noexcept
+		{
+			using namespace SIMD;
+			return VectorMoveMask(VectorGreaterThan(VectorLoadPtr(children), VectorLoad1(-1)));
+		}
+
+	public:
+		float minX[Width];
+		float minY[Width];
+		float minZ[Width];
+		float maxX[Width];
+		float maxY[Width];
+		float maxZ[Width];
+		int32 children[Width];
+		uint32 counts[Width];
+	};
+
+	namespace Detail
+	{
+		struct BvhBuildNode final
+		{
+			AABB bounds;
+			std::unique_ptr<BvhBuildNode> children[2];
+			uint32 first = 0;
+			uint32 count = 0;
+		};
+
+		// Bounds kept in registers while building, so growing them costs two instructions.
+		struct BvhBounds final
+		{
+		public:
+			BvhBounds() noexcept
+				: min(SIMD::VectorLoad1(std::numeric_limits<float>::max())),
+				max(SIMD::VectorLoad1(std::numeric_limits<float>::lowest())) {}
+
+			explicit BvhBounds(const AABB& box) noexcept
+				: min(SIMD::VectorLoad(box.min.data)), max(SIMD::VectorLoad(box.max.data)) {}
+
+			void Grow(const BvhBounds& other) noexcept
+			{
+				min = SIMD::VectorMin(min, other.min);
+				max = SIMD::VectorMax(max, other.max);
+			}
+
+			void Grow(SIMD::VectorRegister<float> point) noexcept
+			{
+				min = SIMD::VectorMin(min, point);
+				max = SIMD::VectorMax(max, point);
+			}
+
+			[[nodiscard]] float SurfaceArea() const noexcept
+			{
+				alignas(16) float size[4];
+				SIMD::VectorStorePtr(SIMD::VectorSubtract(max, min), size);
+				return 2.0f * (size[0] * size[1] + size[1] * size[2] + size[2] * size[0]);
+			}
+
+			[[nodiscard]] AABB ToAABB() const noexcept
+			{
+				AABB ret;
+				SIMD::VectorStore(min, ret.min.data);
+				SIMD::VectorStore(max, ret.max.data);
+				return ret;
+			}
+
+		public:
+			SIMD::VectorRegister<float> min;
+			SIMD::VectorRegister<float> max;
+		};
+
+		struct BvhPrimitive final
+		{
+			BvhBounds bounds;
+			float centroid[3];
+			uint32 index;
+		};
+
+		class BvhBuilder final
+		{
+		public:
+			constexpr static size_t BinNum = 16;
+			constexpr static size_t MaxLeafSize = 8;
+			constexpr static size_t ParallelThreshold = 1 << 14;
+
+		public:
+			BvhBuilder(const AABB* boxes, size_t size)
+				: primitives(size), maxParallelDepth(0)
+			{
+				for (size_t i = 0; i < size; ++i)
+				{
+					const auto center = boxes[i].GetCenter();
+					primitives[i].bounds = BvhBounds{ boxes[i] };
+					std::copy_n(center.data, 3, primitives[i].centroid);
+					primitives[i].index = static_cast<uint32>(i);
+				}
+
+				for (auto threadNum = std::thread::hardware_concurrency(); threadNum > 1; threadNum >>= 1)
+					++maxParallelDepth;
+			}
+
+			[[nodiscard]] std::unique_ptr<BvhBuildNode> Build(uint32 first, uint32 count, size_t depth);
+
+			[[nodiscard]] uint32 GetIndex(size_t idx) const noexcept { return primitives[idx].index; }
+
+		private:
+			[[nodiscard]] uint32 Split(const BvhBounds& nodeBounds, const BvhBounds& centroidBounds, uint32 first, uint32 count);
+
+		private:
+			std::vector<BvhPrimitive> primitives;
+			size_t maxParallelDepth;
+		};
+	}
+
+	class Bvh final
+	{
+	public:
+		// The builder stops splitting below this depth, which bounds the traversal stack. Traversal
+		// keeps that whole stack, 193 entries or 1.5 KB for Raycast, in a local array rather than
+		// a short stack that restarts from the root on overflow. Nodes then need no parent links,
+		// and no subtree is visited twice.
+		constexpr static size_t MaxDepth = 64;
+		constexpr static size_t StackSize = MaxDepth * (BvhNode::Width - 1) + 1;
+
+	public:
+		Bvh() = default;
+
+		Bvh(const AABB* boxes, size_t size) { Build(boxes, size); }
+
+		void Build(const AABB* boxes, size_t size);
+
+		// func(index) returns the distance to the primitive or Infinity when missed.
+		// Returns the nearest distance and writes its primitive index to outIndex.
+		template <class Func>
+		float Raycast(const Ray& ray, Func&& func, uint32* outIndex = nullptr) const;
+
+		// Calls func(index) for every primitive in the leaves overlapping the box.
+		// Like Raycast, func is responsible for the exact primitive test.
+		template <class Func>
+		void Query(const AABB& box, Func&& func) const;
+
+		[[nodiscard]] const std::vector<BvhNode>& GetNodes() const noexcept { return nodes; }
+		[[nodiscard]] const std::vector<uint32>& GetIndices() const noexcept { return indices; }
+
+	private:
+		uint32 Flatten(const Detail::BvhBuildNode& node);
+
+	private:
+		std::vector<BvhNode> nodes;
+		std::vector<uint32> indices;
+	};
+
+	namespace Detail
+	{
+		NO_ODR std::unique_ptr<BvhBuildNode> BvhBuilder::Build(uint32 first, uint32 count, size_t depth)
+		{
+			BvhBounds nodeBounds, centroidBounds;
+			for (uint32 i = first; i < first + count; ++i)
+			{
+				nodeBounds.Grow(primitives[i].bounds);
+				centroidBounds.Grow(SIMD::VectorLoad(primitives[i].centroid));
+			}
+
+			auto node = std::make_unique<BvhBuildNode>();
+			node->bounds = nodeBounds.ToAABB();
+			node->first = first;
+			node->count = count;
+
+			if (count <= 2 || depth >= Bvh::MaxDepth)
+				return node;
+
+			const uint32 mid = Split(nodeBounds, centroidBounds, first, count);
+			if (mid == first)
+				return node;
+
+			const uint32 leftCount = mid - first;
+			const uint32 rightCount = count - leftCount;
+
+			if (count >= ParallelThreshold && depth < maxParallelDepth)
+			{
+				auto left = std::async(std::launch::async, &BvhBuilder::Build, this, first, leftCount, depth + 1);
+				node->children[1] = Build(mid, rightCount, depth + 1);
+				node->children[0] = left.get();
+			}
+			else
+			{
+				node->children[0] = Build(first, leftCount, depth + 1);
+				node->children[1] = Build(mid, rightCount, depth + 1);
+			}
+
+			return node;
+		}
+
+		NO_ODR uint32 BvhBuilder::Split(const BvhBounds& nodeBounds, const BvhBounds& centroidBounds, uint32 first, uint32 count)
+		{
+			// Ref: Wald, "On fast Construction of SAH-based Bounding Volume Hierarchies"
+
+			const auto centroidBox = centroidBounds.ToAABB();
+			const auto size = centroidBox.GetSize();
+			const size_t axis = size.x > size.y ? (size.x > size.z ? 0 : 2) : (size.y > size.z ? 1 : 2);
+			const uint32 half = first + count / 2;
+
+			if (size[axis] <= 0.0f)
+				return count > MaxLeafSize ? half : first;
+
+			const float offset = centroidBox.min[axis];
+			const float scale = BinNum * (1.0f - Epsilon * 4.0f) / size[axis];
+			const auto getBin = [&](const BvhPrimitive& primitive)
+			{
+				return Min(static_cast<size_t>((primitive.centroid[axis] - offset) * scale), BinNum - 1);
+			};
+
+			BvhBounds binBounds[BinNum];
+			uint32 binCounts[BinNum]{};
+
+			for (uint32 i = first; i < first + count; ++i)
+			{
+				const size_t bin = getBin(primitives[i]);
+				binBounds[bin].Grow(primitives[i].bounds);
+				++binCounts[bin];
+			}
+
+			float rightCosts[BinNum];
+			BvhBounds accBounds;
+			uint32 accCount = 0;
+			for (size_t i = BinNum - 1; i > 0; --i)
+			{
+				accBounds.Grow(binBounds[i]);
+				accCount += binCounts[i];
+				rightCosts[i] = accCount ? accCount * accBounds.SurfaceArea() : 0.0f;
+			}
+
+			size_t bestSplit = 0;
+			float bestCost = Infinity;
+			accBounds = BvhBounds{};
+			accCount = 0;
+			for (size_t i = 1; i < BinNum; ++i)
+			{
+				accBounds.Grow(binBounds[i - 1]);
+				accCount += binCounts[i - 1];
+
+				const float cost = (accCount ? accCount * accBounds.SurfaceArea() : 0.0f) + rightCosts[i];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestSplit = i;
+				}
+			}
+
+			const float leafCost = count * nodeBounds.SurfaceArea();
+			if (count <= MaxLeafSize && bestCost >= leafCost)
+				return first;
+
+			const auto begin = primitives.begin() + first;
+			const auto mid = std::partition(begin, begin + count,
+				[&](const BvhPrimitive& primitive) { return getBin(primitive) < bestSplit; });
+
+			const auto ret = static_cast<uint32>(mid - primitives.begin());
+			return ret == first || ret == first + count ? half : ret;
+		}
+	}
+
+	NO_ODR void Bvh::Build(const AABB* boxes, size_t size)
+	{
+		nodes.clear();
+		indices.resize(size);
+		if (size == 0) return;
+
+		Detail::BvhBuilder builder{ boxes, size };
+		auto root = builder.Build(0, static_cast<uint32>(size), 0);
+
+		for (size_t i = 0; i < size; ++i)
+			indices[i] = builder.GetIndex(i);
+
+		if (root->children[0])
+		{
+			Flatten(*root);
+			return;
+		}
+
+		Detail::BvhBuildNode wrapper;
+		wrapper.bounds = root->bounds;
+		wrapper.children[0] = std::move(root);
+		Flatten(wrapper);
+	}
+
+	NO_ODR uint32 Bvh::Flatten(const Detail::BvhBuildNode& node)
+	{
+		const Detail::BvhBuildNode* slots[BvhNode::Width]{ node.children[0].get(), node.children[1].get() };
+		size_t slotNum = node.children[1] ? 2 : 1;
+
+		// Pull grandchildren up until the node is full, expanding the largest inner child first.
+		while (slotNum < BvhNode::Width)
+		{
+			size_t best = BvhNode::Width;
+			float bestArea = -1.0f;
+			for (size_t i = 0; i < slotNum; ++i)
+			{
+				if (slots[i]->children[0] && slots[i]->bounds.SurfaceArea() > bestArea)
+				{
+					best = i;
+					bestArea = slots[i]->bounds.SurfaceArea();
+				}
+			}
+
+			if (best == BvhNode::Width) break;
+
+			const auto* expand = slots[best];
+			slots[best] = expand->children[0].get();
+			slots[slotNum++] = expand->children[1].get();
+		}
+
+		const auto idx = static_cast<uint32>(nodes.size());
+		nodes.emplace_back();
+
+		for (size_t i = 0; i < BvhNode::Width; ++i)
+		{
+			const auto& bounds = i < slotNum ? slots[i]->bounds : AABB::Empty;
+			nodes[idx].minX[i] = bounds.min.x;
+			nodes[idx].minY[i] = bounds.min.y;
+			nodes[idx].minZ[i] = bounds.min.z;
+			nodes[idx].maxX[i] = bounds.max.x;
+			nodes[idx].maxY[i] = bounds.max.y;
+			nodes[idx].maxZ[i] = bounds.max.z;
+			nodes[idx].children[i] = -1;
+			nodes[idx].counts[i] = 0;
+		}
+
+		for (size_t i = 0; i < slotNum; ++i)
+		{
+			if (slots[i]->children[0])
+			{
+				const uint32 child = Flatten(*slots[i]);
+				nodes[idx].children[i] = static_cast<int32>(child);
+			}
+			else
+			{
+				nodes[idx].children[i] = static_cast<int32>(slots[i]->first);
+				nodes[idx].counts[i] = slots[i]->count;
+			}
+		}
+
+		return idx;
+	}
+
+	template <class Func>
+	float Bvh::Raycast(const Ray& ray, Func&& func, uint32* outIndex) const
+	{
+		using namespace SIMD;
+
+		struct Entry
+		{
+			uint32 node;
+			float distance;
+		};
+
+		float nearest = Infinity;
+		if (nodes.empty()) return nearest;
+
+		const RayPacket packet{ ray };
+		Entry stack[StackSize];
+		size_t top = 0;
+		stack[top++] = Entry{ 0, 0.0f };
+
+		while (top > 0)
+		{
+			const auto entry = stack[--top];
+			if (entry.distance >= nearest) continue;
+
+			const auto& node = nodes[entry.node];
+			const auto dist = Detail::IntersectBoxPacket(packet.origin, packet.invDirection,
+				Vector3Packet::Load(node.GetMins(), 0), Vector3Packet::Load(node.GetMaxs(), 0));
+
+			int mask = VectorMoveMask(VectorLessThan(dist, VectorLoad1(nearest))) & node.GetValidMask();
+			if (!mask) continue;
+
+			alignas(16) float dists[BvhNode::Width];
+			VectorStorePtr(dist, dists);
+
+			// Sort hit children from near to far.
+			size_t order[BvhNode::Width];
+			size_t hitNum = 0;
+			for (; mask; mask &= mask - 1)
+			{
+				size_t child = 0;
+				while (!((mask >> child) & 1)) ++child;
+
+				size_t pos = hitNum++;
+				for (; pos > 0 && dists[order[pos - 1]] > dists[child]; --pos)
+					order[pos] = order[pos - 1];
+				order[pos] = child;
+			}
+
+			for (size_t i = 0; i < hitNum; ++i)
+			{
+				const size_t child = order[i];
+				if (node.counts[child] == 0 || dists[child] >= nearest) continue;
+
+				const auto begin = static_cast<uint32>(node.children[child]);
+				for (uint32 j = begin; j < begin + node.counts[child]; ++j)
+				{
+					const float primDist = func(indices[j]);
+					if (primDist < nearest)
+					{
+						nearest = primDist;
+						if (outIndex) *outIndex = indices[j];
+					}
+				}
+			}
+
+			for (size_t i = hitNum; i > 0; --i)
+			{
+				const size_t child = order[i - 1];
+				if (node.counts[child] == 0)
+					stack[top++] = Entry{ static_cast<uint32>(node.children[child]), dists[child] };
+			}
+		}
+
+		return nearest;
+	}
+
+	template <class Func>
+	void Bvh::Query(const AABB& box, Func&& func) const
+	{
+		using namespace SIMD;
+		if (nodes.empty()) return;
+
+		const Vector3Packet boxMin{ box.min };
+		const Vector3Packet boxMax{ box.max };
+
+		uint32 stack[StackSize];
+		size_t top = 0;
+		stack[top++] = 0;
+
+		while (top > 0)
+		{
+			const auto& node = nodes[stack[--top]];
+			const auto mins = Vector3Packet::Load(node.GetMins(), 0);
+			const auto maxs = Vector3Packet::Load(node.GetMaxs(), 0);
+
+			auto overlap = VectorAnd(VectorLessEqual(mins[0], boxMax[0]), VectorLessEqual(boxMin[0], maxs[0]));
+			for (size_t i = 1; i < 3; ++i)
+			{
+				overlap = VectorAnd(overlap, VectorLessEqual(mins[i], boxMax[i]));
+				overlap = VectorAnd(overlap, VectorLessEqual(boxMin[i], maxs[i]));
+			}
+
+			for (int mask = VectorMoveMask(overlap) & node.GetValidMask(); mask; mask &= mask - 1)
+			{
+				size_t child = 0;
+				while (!((mask >> child) & 1)) ++child;
+
+				if (node.counts[child] == 0)
+				{
+					stack[top++] = static_cast<uint32>(node.children[child]);
+					continue;
+				}
+
+				const auto begin = static_cast<uint32>(node.children[child]);
+				for (uint32 j = begin; j < begin + node.counts[child]; ++j)
+					func(indices[j]);
+			}
+		}
+	}
+}
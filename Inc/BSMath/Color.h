@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Batch.h"
 #include "Hash.h"
 #include "Random.h"
 #include "Utility.h"
@@ -130,6 +131,115 @@ namespace BSMath
 		};
 	}
 
+	// Batch Functions
+
+	namespace Detail
+	{
+		// Divides words of at most 255 * 255 by 255, rounded to nearest.
+		// Ref: Blinn, "Three Wrongs Make a Right"
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorDivide255(SIMD::VectorRegister<int> vec) noexcept
+		{
+			using namespace SIMD;
+			return VectorMultiplyHighU16(VectorAdd16(vec, VectorLoad16(128)), VectorLoad16(257));
+		}
+
+		// Widens the pixels of both registers to words, applies func to each half and packs them back.
+		template <class Func>
+		[[nodiscard]] SIMD::VectorRegister<int> VECTOR_CALL TransformWords(SIMD::VectorRegister<int> lhs, SIMD::VectorRegister<int> rhs, Func&& func) noexcept
+		{
+			using namespace SIMD;
+			return VectorPackU16(func(VectorUnpackLowU8(lhs), VectorUnpackLowU8(rhs)),
+				func(VectorUnpackHighU8(lhs), VectorUnpackHighU8(rhs)));
+		}
+
+		// Calls func with four pixels of each span per register.
+		template <class Func>
+		void TransformColors(const Color* lhs, const Color* rhs, size_t size, Color* out, Func&& func) noexcept
+		{
+			using namespace SIMD;
+			const auto load = [](const Color* ptr) { return VectorLoadPtrUnaligned(reinterpret_cast<const int*>(ptr)); };
+			ForEachBlock(lhs, rhs, size, out, [&](const Color* lhsBlock, const Color* rhsBlock, Color* outBlock)
+			{
+				VectorStorePtrUnaligned(func(load(lhsBlock), load(rhsBlock)), reinterpret_cast<int*>(outBlock));
+			});
+		}
+
+		// Single span version of TransformColors.
+		template <class Func>
+		void TransformColors(const Color* colors, size_t size, Color* out, Func&& func) noexcept
+		{
+			using namespace SIMD;
+			const auto load = [](const Color* ptr) { return VectorLoadPtrUnaligned(reinterpret_cast<const int*>(ptr)); };
+			ForEachBlock(colors, size, out, [&](const Color* block, Color* outBlock)
+			{
+				VectorStorePtrUnaligned(func(load(block)), reinterpret_cast<int*>(outBlock));
+			});
+		}
+	}
+
+	// The spans may alias out. Channels are weighted in 8 bit fixed point with exact rounding.
+
+	NO_ODR void AddSaturate(const Color* lhs, const Color* rhs, size_t size, Color* out) noexcept
+	{
+		Detail::TransformColors(lhs, rhs, size, out, SIMD::VectorAddSaturateU8);
+	}
+
+	NO_ODR void SubSaturate(const Color* lhs, const Color* rhs, size_t size, Color* out) noexcept
+	{
+		Detail::TransformColors(lhs, rhs, size, out, SIMD::VectorSubtractSaturateU8);
+	}
+
+	// lhs * rhs / 255 per channel.
+	NO_ODR void Multiply(const Color* lhs, const Color* rhs, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		Detail::TransformColors(lhs, rhs, size, out, [](VectorRegister<int> l, VectorRegister<int> r)
+		{
+			return Detail::TransformWords(l, r, [](VectorRegister<int> lw, VectorRegister<int> rw)
+			{
+				return Detail::VectorDivide255(VectorMultiply16(lw, rw));
+			});
+		});
+	}
+
+	// t is quantized to 1/255 steps.
+	NO_ODR void Lerp(const Color* lhs, const Color* rhs, float t, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		const auto weight = static_cast<int16>(Clamp(t, 0.0f, 1.0f) * 255.0f + 0.5f);
+		const auto rhsWeight = VectorLoad16(weight);
+		const auto lhsWeight = VectorLoad16(static_cast<int16>(255 - weight));
+
+		Detail::TransformColors(lhs, rhs, size, out, [=](VectorRegister<int> l, VectorRegister<int> r)
+		{
+			return Detail::TransformWords(l, r, [=](VectorRegister<int> lw, VectorRegister<int> rw)
+			{
+				return Detail::VectorDivide255(VectorAdd16(VectorMultiply16(lw, lhsWeight), VectorMultiply16(rw, rhsWeight)));
+			});
+		});
+	}
+
+	// Straight alpha blending of src over dst: src * src.a + dst * (1 - src.a) for colors,
+	// and src.a + dst.a * (1 - src.a) for alpha.
+	NO_ODR void AlphaBlend(const Color* src, const Color* dst, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		const auto alphaMask = VectorLoad(0xFFFF, 0, 0xFFFF, 0);
+
+		Detail::TransformColors(src, dst, size, out, [=](VectorRegister<int> s, VectorRegister<int> d)
+		{
+			return Detail::TransformWords(s, d, [=](VectorRegister<int> sw, VectorRegister<int> dw)
+			{
+				const auto srcAlpha = VectorSwizzle16<Swizzle::X, Swizzle::X, Swizzle::X, Swizzle::X>(sw);
+				const auto dstWeighted = VectorMultiply16(dw, VectorSubtract16(VectorLoad16(255), srcAlpha));
+
+				const auto color = Detail::VectorDivide255(VectorAdd16(VectorMultiply16(sw, srcAlpha), dstWeighted));
+				const auto alpha = VectorAdd16(sw, Detail::VectorDivide255(dstWeighted));
+				return VectorSelect(alpha, color, alphaMask);
+			});
+		});
+	}
+
 	// Color's Random
 	class ColorDistribution final
 	{
@@ -148,7 +258,19 @@ namespace BSMath
 				static_cast<uint8>(dist(engine))
 			};
 		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size)
+		{
+			static_assert(sizeof(result_type) == sizeof(uint32));
+
+			// Each random word holds four uniform bytes.
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+				engine.Fill(reinterpret_cast<uint32*>(out), size);
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine); });
+		}
 	};
 
-	using ColorRandom = Random<Color, std::mt19937, ColorDistribution>;
+	using ColorRandom = Random<Color, DefaultRandomEngine, ColorDistribution>;
 }
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <array>
+#include "Color.h"
+
+namespace BSMath
+{
+	// Byte order of a packed 8 bit color in memory. Color itself is ARGB.
+	enum class ColorLayout : uint8
+	{
+		ARGB, RGBA, BGRA, ABGR
+	};
+
+	namespace Detail
+	{
+		// Channels named in the memory order of each layout.
+		template <ColorLayout Layout>
+		struct PackedChannels;
+
+		template <>
+		struct PackedChannels<ColorLayout::ARGB>
+		{
+		public:
+			constexpr PackedChannels(uint8 inR, uint8 inG, uint8 inB, uint8 inA) noexcept
+				: a(inA), r(inR), g(inG), b(inB) {}
+
+		public:
+			uint8 a;
+			uint8 r;
+			uint8 g;
+			uint8 b;
+		};
+
+		template <>
+		struct PackedChannels<ColorLayout::RGBA>
+		{
+		public:
+			constexpr PackedChannels(uint8 inR, uint8 inG, uint8 inB, uint8 inA) noexcept
+				: r(inR), g(inG), b(inB), a(inA) {}
+
+		public:
+			uint8 r;
+			uint8 g;
+			uint8 b;
+			uint8 a;
+		};
+
+		template <>
+		struct PackedChannels<ColorLayout::BGRA>
+		{
+		public:
+			constexpr PackedChannels(uint8 inR, uint8 inG, uint8 inB, uint8 inA) noexcept
+				: b(inB), g(inG), r(inR), a(inA) {}
+
+		public:
+			uint8 b;
+			uint8 g;
+			uint8 r;
+			uint8 a;
+		};
+
+		template <>
+		struct PackedChannels<ColorLayout::ABGR>
+		{
+		public:
+			constexpr PackedChannels(uint8 inR, uint8 inG, uint8 inB, uint8 inA) noexcept
+				: a(inA), b(inB), g(inG), r(inR) {}
+
+		public:
+			uint8 a;
+			uint8 b;
+			uint8 g;
+			uint8 r;
+		};
+
+		// Byte offsets of r, g, b and a.
+		[[nodiscard]] constexpr std::array<size_t, 4> GetChannelOffsets(ColorLayout layout) noexcept
+		{
+			switch (layout)
+			{
+			case ColorLayout::RGBA: return { 0, 1, 2, 3 };
+			case ColorLayout::BGRA: return { 2, 1, 0, 3 };
+			case ColorLayout::ABGR: return { 3, 2, 1, 0 };
+			default: return { 1, 2, 3, 0 };
+			}
+		}
+
+		// Source byte of each destination byte.
+		[[nodiscard]] constexpr std::array<size_t, 4> GetChannelOrder(ColorLayout from, ColorLayout to) noexcept
+		{
+			const auto fromOffsets = GetChannelOffsets(from), toOffsets = GetChannelOffsets(to);
+			std::array<size_t, 4> order{};
+			for (size_t channel = 0; channel < 4; ++channel)
+				order[toOffsets[channel]] = fromOffsets[channel];
+			return order;
+		}
+
+		// pshufb control applying the order to each 32 bit lane.
+		[[nodiscard]] constexpr std::array<int, 4> GetShuffleControl(const std::array<size_t, 4>& order) noexcept
+		{
+			std::array<int, 4> control{};
+			for (size_t pixel = 0; pixel < 4; ++pixel)
+			{
+				for (size_t i = 0; i < 4; ++i)
+					control[pixel] |= static_cast<int>(pixel * 4 + order[i]) << (i * 8);
+			}
+			return control;
+		}
+
+		// Mask of the destination bytes that take their source byte from distance bytes above.
+		[[nodiscard]] constexpr uint32 GetShiftMask(const std::array<size_t, 4>& order, int distance) noexcept
+		{
+			uint32 mask = 0;
+			for (size_t i = 0; i < 4; ++i)
+			{
+				if (static_cast<int>(order[i]) - static_cast<int>(i) == distance)
+					mask |= 0xFFu << (i * 8);
+			}
+			return mask;
+		}
+
+		// Moves the bytes that travel the same distance with one shift of the 32 bit lanes and adds them to ret.
+		template <int Distance, uint32 Mask>
+		[[nodiscard]] SIMD::VectorRegister<int> VECTOR_CALL VectorShiftChannels(SIMD::VectorRegister<int> vec, SIMD::VectorRegister<int> ret) noexcept
+		{
+			using namespace SIMD;
+			constexpr auto Bits = Distance < 0 ? -Distance * 8 : Distance * 8;
+
+			if constexpr (Mask == 0)
+				return ret;
+			else if constexpr (Distance > 0)
+				return VectorOr(ret, Mask == (0xFFFFFFFFu >> Bits) ? VectorShiftRight<Bits>(vec) : VectorAnd(VectorShiftRight<Bits>(vec), VectorLoad1(static_cast<int>(Mask))));
+			else if constexpr (Distance < 0)
+				return VectorOr(ret, Mask == (0xFFFFFFFFu << Bits) ? VectorShiftLeft<Bits>(vec) : VectorAnd(VectorShiftLeft<Bits>(vec), VectorLoad1(static_cast<int>(Mask))));
+			else
+				return VectorOr(ret, VectorAnd(vec, VectorLoad1(static_cast<int>(Mask))));
+		}
+
+		// Permutes the bytes of each 32 bit lane. SSSE3 does it with one pshufb, SSE2 groups the bytes by
+		// the distance they move and shifts each group, which keeps the shuffle port free.
+		template <ColorLayout From, ColorLayout To>
+		[[nodiscard]] SIMD::VectorRegister<int> VECTOR_CALL VectorReorderChannels(SIMD::VectorRegister<int> vec) noexcept
+		{
+			using namespace SIMD;
+			constexpr auto Order = GetChannelOrder(From, To);
+
+			if constexpr (From == To)
+				return vec;
+			else
+			{
+#if defined(HAS_SSSE3)
+				constexpr auto Control = GetShuffleControl(Order);
+				return VectorShuffleBytes(vec, VectorLoad(Control[0], Control[1], Control[2], Control[3]));
+#else
+				auto ret = VectorLoad1(0);
+				ret = VectorShiftChannels<0, GetShiftMask(Order, 0)>(vec, ret);
+				ret = VectorShiftChannels<1, GetShiftMask(Order, 1)>(vec, ret);
+				ret = VectorShiftChannels<2, GetShiftMask(Order, 2)>(vec, ret);
+				ret = VectorShiftChannels<3, GetShiftMask(Order, 3)>(vec, ret);
+				ret = VectorShiftChannels<-1, GetShiftMask(Order, -1)>(vec, ret);
+				ret = VectorShiftChannels<-2, GetShiftMask(Order, -2)>(vec, ret);
+				return VectorShiftChannels<-3, GetShiftMask(Order, -3)>(vec, ret);
+#endif
+			}
+		}
+
+		template <ColorLayout From, ColorLayout To, class In, class Out>
+		void ReorderChannels(const In* colors, size_t size, Out* out) noexcept
+		{
+			static_assert(sizeof(In) == sizeof(uint32) && sizeof(Out) == sizeof(uint32));
+			using namespace SIMD;
+
+			const auto reorder = [](const In* src, Out* dst)
+			{
+				const auto vec = VectorLoadPtrUnaligned(reinterpret_cast<const int*>(src));
+				VectorStorePtrUnaligned(VectorReorderChannels<From, To>(vec), reinterpret_cast<int*>(dst));
+			};
+
+			ForEachBlock(colors, size, out, reorder);
+		}
+	}
+
+	// 8 bit color in a given memory layout, so buffers of decoders and graphics APIs can be
+	// reinterpreted as spans of it instead of copied. Channels keep the names of Color.
+	template <ColorLayout Layout>
+	struct alignas(4) PackedColor final : public Detail::PackedChannels<Layout>
+	{
+	public:
+		constexpr PackedColor() noexcept : Detail::PackedChannels<Layout>(255, 255, 255, 255) {}
+
+		explicit constexpr PackedColor(uint8 inR, uint8 inG, uint8 inB, uint8 inA = 255) noexcept
+			: Detail::PackedChannels<Layout>(inR, inG, inB, inA) {}
+
+		explicit constexpr PackedColor(const Color& color) noexcept
+			: Detail::PackedChannels<Layout>(color.r, color.g, color.b, color.a) {}
+
+		[[nodiscard]] constexpr Color ToColor() const noexcept
+		{
+			return Color{ this->r, this->g, this->b, this->a };
+		}
+	};
+
+	using ARGB8 = PackedColor<ColorLayout::ARGB>;
+	using RGBA8 = PackedColor<ColorLayout::RGBA>;
+	using BGRA8 = PackedColor<ColorLayout::BGRA>;
+	using ABGR8 = PackedColor<ColorLayout::ABGR>;
+
+	static_assert(sizeof(RGBA8) == sizeof(uint32));
+
+	// Global Operators
+
+	template <ColorLayout Layout>
+	[[nodiscard]] constexpr bool operator==(const PackedColor<Layout>& lhs, const PackedColor<Layout>& rhs) noexcept
+	{
+		return (lhs.r == rhs.r) && (lhs.g == rhs.g) && (lhs.b == rhs.b) && (lhs.a == rhs.a);
+	}
+
+	template <ColorLayout Layout>
+	[[nodiscard]] constexpr bool operator!=(const PackedColor<Layout>& lhs, const PackedColor<Layout>& rhs) noexcept { return !(lhs == rhs); }
+
+	// Batch Functions
+
+	// Reorders the channels of every pixel, four per step. The spans may be the same memory,
+	// so a buffer converts in place through a reinterpret_cast of out.
+	template <ColorLayout From, ColorLayout To>
+	void ConvertLayout(const PackedColor<From>* colors, size_t size, PackedColor<To>* out) noexcept
+	{
+		Detail::ReorderChannels<From, To>(colors, size, out);
+	}
+
+	template <ColorLayout Layout>
+	void ToColors(const PackedColor<Layout>* colors, size_t size, Color* out) noexcept
+	{
+		Detail::ReorderChannels<Layout, ColorLayout::ARGB>(colors, size, out);
+	}
+
+	template <ColorLayout Layout>
+	void FromColors(const Color* colors, size_t size, PackedColor<Layout>* out) noexcept
+	{
+		Detail::ReorderChannels<ColorLayout::ARGB, Layout>(colors, size, out);
+	}
+}
@@ -0,0 +1,522 @@
+#pragma once
+
+#include "LinearColor.h"
+
+namespace BSMath
+{
+	// Hue in degrees [0, 360), saturation and value in [0, 1].
+	struct alignas(16) HSVColor final
+	{
+	public:
+		constexpr HSVColor() noexcept : h(0.0f), s(0.0f), v(0.0f), a(1.0f) {}
+
+		explicit constexpr HSVColor(float inH, float inS, float inV, float inA = 1.0f) noexcept
+			: h(inH), s(inS), v(inV), a(inA) {}
+
+	public:
+		float h;
+		float s;
+		float v;
+		float a;
+	};
+
+	// Hue in degrees [0, 360), saturation and lightness in [0, 1].
+	struct alignas(16) HSLColor final
+	{
+	public:
+		constexpr HSLColor() noexcept : h(0.0f), s(0.0f), l(0.0f), a(1.0f) {}
+
+		explicit constexpr HSLColor(float inH, float inS, float inL, float inA = 1.0f) noexcept
+			: h(inH), s(inS), l(inL), a(inA) {}
+
+	public:
+		float h;
+		float s;
+		float l;
+		float a;
+	};
+
+	// 8 bit YCbCr with alpha, laid out as packed 4:4:4 video.
+	struct alignas(4) YCbCrColor final
+	{
+	public:
+		constexpr YCbCrColor() noexcept : y(0), cb(128), cr(128), a(255) {}
+
+		explicit constexpr YCbCrColor(uint8 inY, uint8 inCb, uint8 inCr, uint8 inA = 255) noexcept
+			: y(inY), cb(inCb), cr(inCr), a(inA) {}
+
+	public:
+		uint8 y;
+		uint8 cb;
+		uint8 cr;
+		uint8 a;
+	};
+
+	// Limited range puts Y in [16, 235] and chroma in [16, 240] as video does.
+	// Full range spans [0, 255] as JPEG does.
+	enum class YCbCrFormat : uint8
+	{
+		BT601, BT709, BT601Full, BT709Full
+	};
+
+	// Global Operators
+
+	[[nodiscard]] constexpr bool operator==(const YCbCrColor& lhs, const YCbCrColor& rhs) noexcept
+	{
+		return (lhs.y == rhs.y) && (lhs.cb == rhs.cb) && (lhs.cr == rhs.cr) && (lhs.a == rhs.a);
+	}
+
+	[[nodiscard]] constexpr bool operator!=(const YCbCrColor& lhs, const YCbCrColor& rhs) noexcept { return !(lhs == rhs); }
+
+	namespace Detail
+	{
+		[[nodiscard]] NO_ODR int32 PackWords(int32 low, int32 high) noexcept
+		{
+			return static_cast<int32>((static_cast<uint32>(low) & 0xFFFFu) | (static_cast<uint32>(high) << 16));
+		}
+
+		// Fixed point weights of a YCbCr format, Q15 from RGB and Q13 back to RGB. A color register
+		// splits into word pairs (r, b) and (a, g), a YCbCr register into (y, cr) and (cb, a),
+		// so each channel takes two VectorMultiplyAddPairs16 and a bias holding offsets and rounding.
+		// Ref: ITU-R BT.601-7, ITU-R BT.709-6
+		struct YCbCrKernel final
+		{
+		public:
+			explicit YCbCrKernel(YCbCrFormat format) noexcept
+			{
+				using namespace SIMD;
+
+				const bool isBT709 = format == YCbCrFormat::BT709 || format == YCbCrFormat::BT709Full;
+				const bool isFull = format == YCbCrFormat::BT601Full || format == YCbCrFormat::BT709Full;
+				const double kr = isBT709 ? 0.2126 : 0.299;
+				const double kb = isBT709 ? 0.0722 : 0.114;
+				const double kg = 1.0 - kr - kb;
+				const double yScale = isFull ? 1.0 : 219.0 / 255.0;
+				const double cScale = isFull ? 1.0 : 224.0 / 255.0;
+				const int32 yOffset = isFull ? 0 : 16;
+
+				// Weights of Y sum to its range and those of chroma to zero, so grays map exactly.
+				constexpr double EncodeOne = 1 << 15;
+				const auto encode = [=](double weight) { return static_cast<int32>(std::lround(weight * EncodeOne)); };
+				const int32 yR = encode(kr * yScale), yB = encode(kb * yScale), yG = encode(yScale) - yR - yB;
+				const int32 cbR = encode(-0.5 * kr / (1.0 - kb) * cScale), cbB = encode(0.5 * cScale), cbG = -cbR - cbB;
+				const int32 crR = encode(0.5 * cScale), crB = encode(-0.5 * kb / (1.0 - kr) * cScale), crG = -crR - crB;
+
+				yRB = VectorLoad1(PackWords(yR, yB));
+				yAG = VectorLoad1(PackWords(0, yG));
+				cbRB = VectorLoad1(PackWords(cbR, cbB));
+				cbAG = VectorLoad1(PackWords(0, cbG));
+				crRB = VectorLoad1(PackWords(crR, crB));
+				crAG = VectorLoad1(PackWords(0, crG));
+				yBias = VectorLoad1((yOffset << 15) + (1 << 14));
+				cBias = VectorLoad1((128 << 15) + (1 << 14));
+
+				constexpr double DecodeOne = 1 << 13;
+				const auto decode = [=](double weight) { return static_cast<int32>(std::lround(weight * DecodeOne)); };
+				const int32 yWeight = decode(1.0 / yScale);
+				const int32 rCr = decode(2.0 * (1.0 - kr) / cScale);
+				const int32 gCb = decode(-2.0 * kb * (1.0 - kb) / kg / cScale);
+				const int32 gCr = decode(-2.0 * kr * (1.0 - kr) / kg / cScale);
+				const int32 bCb = decode(2.0 * (1.0 - kb) / cScale);
+
+				rYCr = VectorLoad1(PackWords(yWeight, rCr));
+				gYCr = VectorLoad1(PackWords(yWeight, gCr));
+				gCbA = VectorLoad1(PackWords(gCb, 0));
+				bYCr = VectorLoad1(PackWords(yWeight, 0));
+				bCbA = VectorLoad1(PackWords(bCb, 0));
+				rBias = VectorLoad1((1 << 12) - yOffset * yWeight - 128 * rCr);
+				gBias = VectorLoad1((1 << 12) - yOffset * yWeight - 128 * (gCb + gCr));
+				bBias = VectorLoad1((1 << 12) - yOffset * yWeight - 128 * bCb);
+			}
+
+			// Y, Cb and Cr of four colors in 32 bit lanes.
+			void VECTOR_CALL Encode(SIMD::VectorRegister<int> colors, SIMD::VectorRegister<int>(&out)[3]) const noexcept
+			{
+				using namespace SIMD;
+				const auto wordMask = VectorLoad1(0x00FF00FF);
+				const auto ag = VectorAnd(colors, wordMask);
+				const auto rb = VectorAnd(VectorShiftRight<8>(colors), wordMask);
+
+				const auto encode = [=](VectorRegister<int> rbWeight, VectorRegister<int> agWeight, VectorRegister<int> bias)
+				{
+					const auto sum = VectorAdd(VectorMultiplyAddPairs16(rb, rbWeight), VectorMultiplyAddPairs16(ag, agWeight));
+					return VectorShiftRightArithmetic<15>(VectorAdd(sum, bias));
+				};
+
+				out[0] = encode(yRB, yAG, yBias);
+				out[1] = encode(cbRB, cbAG, cBias);
+				out[2] = encode(crRB, crAG, cBias);
+			}
+
+			// R, G and B of four colors in 32 bit lanes from (y, cr) and (cb, a) word pairs, unclamped.
+			void VECTOR_CALL Decode(SIMD::VectorRegister<int> yCr, SIMD::VectorRegister<int> cbA, SIMD::VectorRegister<int>(&out)[3]) const noexcept
+			{
+				using namespace SIMD;
+				out[0] = VectorShiftRightArithmetic<13>(VectorAdd(VectorMultiplyAddPairs16(yCr, rYCr), rBias));
+
+				const auto g = VectorAdd(VectorMultiplyAddPairs16(yCr, gYCr), VectorMultiplyAddPairs16(cbA, gCbA));
+				out[1] = VectorShiftRightArithmetic<13>(VectorAdd(g, gBias));
+
+				const auto b = VectorAdd(VectorMultiplyAddPairs16(yCr, bYCr), VectorMultiplyAddPairs16(cbA, bCbA));
+				out[2] = VectorShiftRightArithmetic<13>(VectorAdd(b, bBias));
+			}
+
+		public:
+			SIMD::VectorRegister<int> yRB, yAG, cbRB, cbAG, crRB, crAG, yBias, cBias;
+			SIMD::VectorRegister<int> rYCr, gYCr, gCbA, bYCr, bCbA, rBias, gBias, bBias;
+		};
+
+		// Packs the 32 bit lanes of four channel registers to bytes with saturation,
+		// one channel per four bytes.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorPackChannels(SIMD::VectorRegister<int> c0,
+			SIMD::VectorRegister<int> c1, SIMD::VectorRegister<int> c2, SIMD::VectorRegister<int> c3) noexcept
+		{
+			using namespace SIMD;
+			return VectorPackU16(VectorPack32(c0, c1), VectorPack32(c2, c3));
+		}
+
+		// Turns four bytes per channel into four pixels of four channels.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorInterleaveChannels(SIMD::VectorRegister<int> channels) noexcept
+		{
+			using namespace SIMD;
+			const auto half = VectorInterleaveLowU8(channels, VectorSwizzle<Swizzle::Z, Swizzle::W, Swizzle::Z, Swizzle::W>(channels));
+			return VectorInterleaveLowU8(half, VectorSwizzle<Swizzle::Z, Swizzle::W, Swizzle::Z, Swizzle::W>(half));
+		}
+
+		// Loads four pixels as one register per channel in r, g, b, a order, scaled to [0, 1].
+		NO_ODR void LoadChannels(const Color* colors, SIMD::VectorRegister<float>(&channels)[4]) noexcept
+		{
+			using namespace SIMD;
+			const auto vec = VectorLoadPtrUnaligned(reinterpret_cast<const int*>(colors));
+			const auto byteMask = VectorLoad1(0xFF);
+			const auto toFloat = [](VectorRegister<int> channel) { return VectorMultiply(VectorConvertFloat(channel), VectorLoad1(1.0f / 255.0f)); };
+
+			channels[0] = toFloat(VectorAnd(VectorShiftRight<8>(vec), byteMask));
+			channels[1] = toFloat(VectorAnd(VectorShiftRight<16>(vec), byteMask));
+			channels[2] = toFloat(VectorShiftRight<24>(vec));
+			channels[3] = toFloat(VectorAnd(vec, byteMask));
+		}
+
+		template <class T>
+		void LoadChannels(const T* colors, SIMD::VectorRegister<float>(&channels)[4]) noexcept
+		{
+			static_assert(sizeof(T) == sizeof(float) * 4);
+			using namespace SIMD;
+			for (size_t i = 0; i < 4; ++i)
+				channels[i] = VectorLoadPtr(reinterpret_cast<const float*>(colors + i));
+			VectorTranspose(channels);
+		}
+
+		// Channels are clamped to [0, 1] and rounded.
+		NO_ODR void StoreChannels(SIMD::VectorRegister<float>(&channels)[4], Color* colors) noexcept
+		{
+			using namespace SIMD;
+			const auto toInt = [](VectorRegister<float> channel)
+			{
+				const auto clamped = VectorMin(VectorMax(channel, Zero<float>), VectorLoad1(1.0f));
+				return VectorConvertInt(VectorMultiplyAdd(clamped, VectorLoad1(255.0f), VectorLoad1(0.5f)));
+			};
+
+			auto vec = VectorOr(toInt(channels[3]), VectorShiftLeft<8>(toInt(channels[0])));
+			vec = VectorOr(vec, VectorShiftLeft<16>(toInt(channels[1])));
+			vec = VectorOr(vec, VectorShiftLeft<24>(toInt(channels[2])));
+			VectorStorePtrUnaligned(vec, reinterpret_cast<int*>(colors));
+		}
+
+		template <class T>
+		void StoreChannels(SIMD::VectorRegister<float>(&channels)[4], T* colors) noexcept
+		{
+			static_assert(sizeof(T) == sizeof(float) * 4);
+			using namespace SIMD;
+			VectorTranspose(channels);
+			for (size_t i = 0; i < 4; ++i)
+				VectorStorePtr(channels[i], reinterpret_cast<float*>(colors + i));
+		}
+
+		// Runs kernel on four pixels at a time, one register per channel.
+		template <class In, class Out, class Kernel>
+		void TransformChannels(const In* in, size_t size, Out* out, Kernel&& kernel) noexcept
+		{
+			using namespace SIMD;
+			const auto transform = [&](const In* src, Out* dst)
+			{
+				VectorRegister<float> channels[4];
+				LoadChannels(src, channels);
+				kernel(channels);
+				StoreChannels(channels, dst);
+			};
+
+			ForEachBlock(in, size, out, transform);
+		}
+
+		// Hue in degrees [0, 360), zero for grays.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorHue(SIMD::VectorRegister<float> r, SIMD::VectorRegister<float> g,
+			SIMD::VectorRegister<float> b, SIMD::VectorRegister<float> max, SIMD::VectorRegister<float> delta) noexcept
+		{
+			using namespace SIMD;
+			const auto scale = VectorDivide(VectorLoad1(60.0f), delta);
+			const auto fromR = VectorMultiply(VectorSubtract(g, b), scale);
+			const auto fromG = VectorMultiplyAdd(VectorSubtract(b, r), scale, VectorLoad1(120.0f));
+			const auto fromB = VectorMultiplyAdd(VectorSubtract(r, g), scale, VectorLoad1(240.0f));
+
+			auto hue = VectorSelect(fromG, fromB, VectorEqual(max, g));
+			hue = VectorSelect(fromR, hue, VectorEqual(max, r));
+			hue = VectorAdd(hue, VectorAnd(VectorLessThan(hue, Zero<float>), VectorLoad1(360.0f)));
+			return VectorAnd(hue, VectorGreaterThan(delta, Zero<float>));
+		}
+
+		// Hue in units of 360 / period degrees, wrapped to [0, period).
+		template <int Period>
+		[[nodiscard]] SIMD::VectorRegister<float> VECTOR_CALL VectorHueSector(SIMD::VectorRegister<float> hue) noexcept
+		{
+			using namespace SIMD;
+			const auto sector = VectorMultiply(hue, VectorLoad1(Period / 360.0f));
+			const auto turns = VectorConvertFloat(VectorFloorInt(VectorMultiply(sector, VectorLoad1(1.0f / Period))));
+			return VectorSubtract(sector, VectorMultiply(turns, VectorLoad1(static_cast<float>(Period))));
+		}
+
+		template <int Period>
+		[[nodiscard]] SIMD::VectorRegister<float> VECTOR_CALL VectorHueOffset(SIMD::VectorRegister<float> sector, float offset) noexcept
+		{
+			using namespace SIMD;
+			const auto shifted = VectorAdd(sector, VectorLoad1(offset));
+			return VectorSubtract(shifted, VectorAnd(VectorGreaterEqual(shifted, VectorLoad1(static_cast<float>(Period))), VectorLoad1(static_cast<float>(Period))));
+		}
+
+		NO_ODR void VECTOR_CALL RGBToHSV(SIMD::VectorRegister<float>(&channels)[4]) noexcept
+		{
+			using namespace SIMD;
+			const auto max = VectorMax(VectorMax(channels[0], channels[1]), channels[2]);
+			const auto min = VectorMin(VectorMin(channels[0], channels[1]), channels[2]);
+			const auto delta = VectorSubtract(max, min);
+
+			channels[0] = VectorHue(channels[0], channels[1], channels[2], max, delta);
+			channels[1] = VectorAnd(VectorDivide(delta, max), VectorGreaterThan(delta, Zero<float>));
+			channels[2] = max;
+		}
+
+		// Ref: https://en.wikipedia.org/wiki/HSL_and_HSV#HSV_to_RGB_alternative
+		NO_ODR void VECTOR_CALL HSVToRGB(SIMD::VectorRegister<float>(&channels)[4]) noexcept
+		{
+			using namespace SIMD;
+			const auto sector = VectorHueSector<6>(channels[0]);
+			const auto value = channels[2];
+			const auto chroma = VectorMultiply(value, channels[1]);
+
+			const auto channel = [=](float offset)
+			{
+				const auto k = VectorHueOffset<6>(sector, offset);
+				const auto factor = VectorMin(VectorMax(VectorMin(k, VectorSubtract(VectorLoad1(4.0f), k)), Zero<float>), VectorLoad1(1.0f));
+				return VectorSubtract(value, VectorMultiply(chroma, factor));
+			};
+
+			channels[0] = channel(5.0f);
+			channels[1] = channel(3.0f);
+			channels[2] = channel(1.0f);
+		}
+
+		NO_ODR void VECTOR_CALL RGBToHSL(SIMD::VectorRegister<float>(&channels)[4]) noexcept
+		{
+			using namespace SIMD;
+			const auto max = VectorMax(VectorMax(channels[0], channels[1]), channels[2]);
+			const auto min = VectorMin(VectorMin(channels[0], channels[1]), channels[2]);
+			const auto delta = VectorSubtract(max, min);
+			const auto sum = VectorAdd(max, min);
+
+			const auto one = VectorLoad1(1.0f);
+			const auto saturation = VectorMin(VectorDivide(delta, VectorSubtract(one, VectorAbs(VectorSubtract(sum, one)))), one);
+
+			channels[0] = VectorHue(channels[0], channels[1], channels[2], max, delta);
+			channels[1] = VectorAnd(saturation, VectorGreaterThan(delta, Zero<float>));
+			channels[2] = VectorMultiply(sum, VectorLoad1(0.5f));
+		}
+
+		// Ref: https://en.wikipedia.org/wiki/HSL_and_HSV#HSL_to_RGB_alternative
+		NO_ODR void VECTOR_CALL HSLToRGB(SIMD::VectorRegister<float>(&channels)[4]) noexcept
+		{
+			using namespace SIMD;
+			const auto sector = VectorHueSector<12>(channels[0]);
+			const auto lightness = channels[2];
+			const auto chroma = VectorMultiply(channels[1], VectorMin(lightness, VectorSubtract(VectorLoad1(1.0f), lightness)));
+
+			const auto channel = [=](float offset)
+			{
+				const auto k = VectorHueOffset<12>(sector, offset);
+				const auto ramp = VectorMin(VectorSubtract(k, VectorLoad1(3.0f)), VectorSubtract(VectorLoad1(9.0f), k));
+				const auto factor = VectorMin(VectorMax(ramp, VectorLoad1(-1.0f)), VectorLoad1(1.0f));
+				return VectorSubtract(lightness, VectorMultiply(chroma, factor));
+			};
+
+			channels[0] = channel(0.0f);
+			channels[1] = channel(8.0f);
+			channels[2] = channel(4.0f);
+		}
+	}
+
+	// Batch Functions
+
+	// HSV and HSL are computed in float four pixels at a time, on the values as stored.
+	// Hues outside [0, 360) wrap around.
+
+	NO_ODR void RGBToHSV(const Color* colors, size_t size, HSVColor* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::RGBToHSV);
+	}
+
+	NO_ODR void RGBToHSV(const LinearColor* colors, size_t size, HSVColor* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::RGBToHSV);
+	}
+
+	NO_ODR void HSVToRGB(const HSVColor* colors, size_t size, Color* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::HSVToRGB);
+	}
+
+	NO_ODR void HSVToRGB(const HSVColor* colors, size_t size, LinearColor* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::HSVToRGB);
+	}
+
+	NO_ODR void RGBToHSL(const Color* colors, size_t size, HSLColor* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::RGBToHSL);
+	}
+
+	NO_ODR void RGBToHSL(const LinearColor* colors, size_t size, HSLColor* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::RGBToHSL);
+	}
+
+	NO_ODR void HSLToRGB(const HSLColor* colors, size_t size, Color* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::HSLToRGB);
+	}
+
+	NO_ODR void HSLToRGB(const HSLColor* colors, size_t size, LinearColor* out) noexcept
+	{
+		Detail::TransformChannels(colors, size, out, Detail::HSLToRGB);
+	}
+
+	// YCbCr is computed in fixed point on the gamma encoded 8 bit values. Each result is within one level
+	// of the exactly rounded one. Decoded colors are clamped and the planar versions treat alpha as opaque.
+	// A LinearColor converts through EncodeSRGB and DecodeSRGB first.
+
+	NO_ODR void RGBToYCbCr(const Color* colors, YCbCrFormat format, size_t size, YCbCrColor* out) noexcept
+	{
+		using namespace SIMD;
+		const Detail::YCbCrKernel kernel{ format };
+		const auto encode = [&](const Color* src, YCbCrColor* dst)
+		{
+			const auto vec = VectorLoadPtrUnaligned(reinterpret_cast<const int*>(src));
+			VectorRegister<int> yCbCr[3];
+			kernel.Encode(vec, yCbCr);
+
+			const auto alpha = VectorAnd(vec, VectorLoad1(0xFF));
+			const auto channels = Detail::VectorPackChannels(yCbCr[0], yCbCr[1], yCbCr[2], alpha);
+			VectorStorePtrUnaligned(Detail::VectorInterleaveChannels(channels), reinterpret_cast<int*>(dst));
+		};
+
+		Detail::ForEachBlock(colors, size, out, encode);
+	}
+
+	NO_ODR void YCbCrToRGB(const YCbCrColor* colors, YCbCrFormat format, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		const Detail::YCbCrKernel kernel{ format };
+		const auto decode = [&](const YCbCrColor* src, Color* dst)
+		{
+			const auto vec = VectorLoadPtrUnaligned(reinterpret_cast<const int*>(src));
+			const auto wordMask = VectorLoad1(0x00FF00FF);
+			VectorRegister<int> rgb[3];
+			kernel.Decode(VectorAnd(vec, wordMask), VectorAnd(VectorShiftRight<8>(vec), wordMask), rgb);
+
+			const auto channels = Detail::VectorPackChannels(VectorShiftRight<24>(vec), rgb[0], rgb[1], rgb[2]);
+			VectorStorePtrUnaligned(Detail::VectorInterleaveChannels(channels), reinterpret_cast<int*>(dst));
+		};
+
+		Detail::ForEachBlock(colors, size, out, decode);
+	}
+
+	// Planar version writing one plane per channel, sixteen pixels per step.
+	NO_ODR void RGBToYCbCr(const Color* colors, YCbCrFormat format, size_t size, uint8* y, uint8* cb, uint8* cr) noexcept
+	{
+		using namespace SIMD;
+		const Detail::YCbCrKernel kernel{ format };
+		const auto encode = [&](const Color* src, uint8* dstY, uint8* dstCb, uint8* dstCr)
+		{
+			VectorRegister<int> planes[3][4];
+			for (size_t i = 0; i < 4; ++i)
+			{
+				VectorRegister<int> yCbCr[3];
+				kernel.Encode(VectorLoadPtrUnaligned(reinterpret_cast<const int*>(src + i * 4)), yCbCr);
+				for (size_t plane = 0; plane < 3; ++plane)
+					planes[plane][i] = yCbCr[plane];
+			}
+
+			uint8* const dst[3]{ dstY, dstCb, dstCr };
+			for (size_t plane = 0; plane < 3; ++plane)
+			{
+				const auto bytes = Detail::VectorPackChannels(planes[plane][0], planes[plane][1], planes[plane][2], planes[plane][3]);
+				VectorStorePtrUnaligned(bytes, reinterpret_cast<int*>(dst[plane]));
+			}
+		};
+
+		size_t idx = 0;
+		for (; idx + 16 <= size; idx += 16)
+			encode(colors + idx, y + idx, cb + idx, cr + idx);
+
+		if (idx == size) return;
+
+		const size_t remainNum = size - idx;
+		Color remain[16];
+		uint8 yRemain[16], cbRemain[16], crRemain[16];
+		std::copy_n(colors + idx, remainNum, remain);
+		encode(remain, yRemain, cbRemain, crRemain);
+		std::copy_n(yRemain, remainNum, y + idx);
+		std::copy_n(cbRemain, remainNum, cb + idx);
+		std::copy_n(crRemain, remainNum, cr + idx);
+	}
+
+	// Planar version reading one plane per channel, sixteen pixels per step.
+	NO_ODR void YCbCrToRGB(const uint8* y, const uint8* cb, const uint8* cr, YCbCrFormat format, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		const Detail::YCbCrKernel kernel{ format };
+		const auto decode = [&](const uint8* srcY, const uint8* srcCb, const uint8* srcCr, Color* dst)
+		{
+			const auto load = [](const uint8* ptr) { return VectorLoadPtrUnaligned(reinterpret_cast<const int*>(ptr)); };
+			const auto planeY = load(srcY), planeCb = load(srcCb), planeCr = load(srcCr);
+			const auto alpha = VectorLoad1(-1);
+
+			const auto yCrLow = VectorInterleaveLowU8(planeY, planeCr), yCrHigh = VectorInterleaveHighU8(planeY, planeCr);
+			const auto cbALow = VectorInterleaveLowU8(planeCb, alpha), cbAHigh = VectorInterleaveHighU8(planeCb, alpha);
+			const VectorRegister<int> yCr[4]{ VectorUnpackLowU8(yCrLow), VectorUnpackHighU8(yCrLow), VectorUnpackLowU8(yCrHigh), VectorUnpackHighU8(yCrHigh) };
+			const VectorRegister<int> cbA[4]{ VectorUnpackLowU8(cbALow), VectorUnpackHighU8(cbALow), VectorUnpackLowU8(cbAHigh), VectorUnpackHighU8(cbAHigh) };
+
+			for (size_t i = 0; i < 4; ++i)
+			{
+				VectorRegister<int> rgb[3];
+				kernel.Decode(yCr[i], cbA[i], rgb);
+
+				const auto channels = Detail::VectorPackChannels(VectorLoad1(0xFF), rgb[0], rgb[1], rgb[2]);
+				VectorStorePtrUnaligned(Detail::VectorInterleaveChannels(channels), reinterpret_cast<int*>(dst + i * 4));
+			}
+		};
+
+		size_t idx = 0;
+		for (; idx + 16 <= size; idx += 16)
+			decode(y + idx, cb + idx, cr + idx, out + idx);
+
+		if (idx == size) return;
+
+		const size_t remainNum = size - idx;
+		uint8 yRemain[16]{}, cbRemain[16]{}, crRemain[16]{};
+		Color outRemain[16];
+		std::copy_n(y + idx, remainNum, yRemain);
+		std::copy_n(cb + idx, remainNum, cbRemain);
+		std::copy_n(cr + idx, remainNum, crRemain);
+		decode(yRemain, cbRemain, crRemain, outRemain);
+		std::copy_n(outRemain, remainNum, out + idx);
+	}
+}
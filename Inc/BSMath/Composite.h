@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Color.h"
+
+// Porter-Duff compositing of premultiplied Color spans. Every channel, alpha included, is
+// src * Fa + dst * Fb with the factors of the operator, evaluated in 8 bit fixed point and
+// divided by 255 once with exact rounding.
+// The operators expect valid premultiplied input, no channel larger than its alpha.
+// Destination variants such as dst over src are the same calls with the spans swapped.
+// Ref: Porter, Duff, "Compositing Digital Images"
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Applies func to the widened words of both spans together with their broadcast alphas.
+		template <class Func>
+		void Composite(const Color* src, const Color* dst, size_t size, Color* out, Func&& func) noexcept
+		{
+			using namespace SIMD;
+			TransformColors(src, dst, size, out, [&](VectorRegister<int> s, VectorRegister<int> d)
+			{
+				return TransformWords(s, d, [&](VectorRegister<int> sw, VectorRegister<int> dw)
+				{
+					const auto srcAlpha = VectorSwizzle16<Swizzle::X, Swizzle::X, Swizzle::X, Swizzle::X>(sw);
+					const auto dstAlpha = VectorSwizzle16<Swizzle::X, Swizzle::X, Swizzle::X, Swizzle::X>(dw);
+					return func(sw, dw, srcAlpha, dstAlpha);
+				});
+			});
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorInvert255(SIMD::VectorRegister<int> vec) noexcept
+		{
+			using namespace SIMD;
+			return VectorSubtract16(VectorLoad16(255), vec);
+		}
+	}
+
+	// Straight to premultiplied alpha. The spans may alias.
+	NO_ODR void Premultiply(const Color* colors, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		const auto alphaMask = VectorLoad(0xFFFF, 0, 0xFFFF, 0);
+
+		Detail::TransformColors(colors, size, out, [=](VectorRegister<int> vec)
+		{
+			const auto transform = [=](VectorRegister<int> words)
+			{
+				const auto alpha = VectorSwizzle16<Swizzle::X, Swizzle::X, Swizzle::X, Swizzle::X>(words);
+				return VectorSelect(words, Detail::VectorDivide255(VectorMultiply16(words, alpha)), alphaMask);
+			};
+
+			return VectorPackU16(transform(VectorUnpackLowU8(vec)), transform(VectorUnpackHighU8(vec)));
+		});
+	}
+
+	// Premultiplied to straight alpha, color * 255 / alpha rounded to nearest.
+	// Colors of zero alpha stay zero and channels larger than their alpha saturate.
+	NO_ODR void Unpremultiply(const Color* colors, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		const auto byteMask = VectorLoad1(0xFF);
+
+		Detail::TransformColors(colors, size, out, [=](VectorRegister<int> vec)
+		{
+			const auto alpha = VectorAnd(vec, byteMask);
+			const auto alphaFloat = VectorConvertFloat(VectorMax(alpha, VectorLoad1(1)));
+
+			// Quotients of exact integers round ties correctly, so adding a half and truncating is exact.
+			const auto divide = [=](VectorRegister<int> channel)
+			{
+				const auto scaled = VectorMultiply(VectorConvertFloat(VectorAnd(channel, byteMask)), VectorLoad1(255.0f));
+				const auto quotient = VectorAdd(VectorDivide(scaled, alphaFloat), VectorLoad1(0.5f));
+				return VectorMin(VectorConvertInt(quotient), VectorLoad1(255));
+			};
+
+			auto ret = VectorOr(alpha, VectorShiftLeft<8>(divide(VectorShiftRight<8>(vec))));
+			ret = VectorOr(ret, VectorShiftLeft<16>(divide(VectorShiftRight<16>(vec))));
+			ret = VectorOr(ret, VectorShiftLeft<24>(divide(VectorShiftRight<24>(vec))));
+			return VectorAndNot(VectorEqual(alpha, VectorLoad1(0)), ret);
+		});
+	}
+
+	// src + dst * (1 - src.a)
+	NO_ODR void CompositeOver(const Color* src, const Color* dst, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		Detail::Composite(src, dst, size, out, [](VectorRegister<int> s, VectorRegister<int> d, VectorRegister<int> sa, VectorRegister<int>)
+		{
+			return VectorAdd16(s, Detail::VectorDivide255(VectorMultiply16(d, Detail::VectorInvert255(sa))));
+		});
+	}
+
+	// src * dst.a
+	NO_ODR void CompositeIn(const Color* src, const Color* dst, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		Detail::Composite(src, dst, size, out, [](VectorRegister<int> s, VectorRegister<int>, VectorRegister<int>, VectorRegister<int> da)
+		{
+			return Detail::VectorDivide255(VectorMultiply16(s, da));
+		});
+	}
+
+	// src * (1 - dst.a)
+	NO_ODR void CompositeOut(const Color* src, const Color* dst, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		Detail::Composite(src, dst, size, out, [](VectorRegister<int> s, VectorRegister<int>, VectorRegister<int>, VectorRegister<int> da)
+		{
+			return Detail::VectorDivide255(VectorMultiply16(s, Detail::VectorInvert255(da)));
+		});
+	}
+
+	// src * dst.a + dst * (1 - src.a)
+	NO_ODR void CompositeAtop(const Color* src, const Color* dst, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		Detail::Composite(src, dst, size, out, [](VectorRegister<int> s, VectorRegister<int> d, VectorRegister<int> sa, VectorRegister<int> da)
+		{
+			return Detail::VectorDivide255(VectorAdd16(VectorMultiply16(s, da), VectorMultiply16(d, Detail::VectorInvert255(sa))));
+		});
+	}
+
+	// src * (1 - dst.a) + dst * (1 - src.a)
+	NO_ODR void CompositeXor(const Color* src, const Color* dst, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		Detail::Composite(src, dst, size, out, [](VectorRegister<int> s, VectorRegister<int> d, VectorRegister<int> sa, VectorRegister<int> da)
+		{
+			const auto srcWeighted = VectorMultiply16(s, Detail::VectorInvert255(da));
+			return Detail::VectorDivide255(VectorAdd16(srcWeighted, VectorMultiply16(d, Detail::VectorInvert255(sa))));
+		});
+	}
+}
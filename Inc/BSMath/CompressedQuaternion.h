@@ -0,0 +1,263 @@
+#pragma once
+
+#include "Batch.h"
+#include "PackedVector.h"
+#include "Quaternion.h"
+
+// Smallest-three quaternion compression. q and -q are the same rotation, so the component
+// of largest magnitude is made positive and dropped: two bits store its index, and the other
+// three, which lie in [-1/sqrt2, 1/sqrt2], are quantized to ComponentBits each.
+// The dropped component is rebuilt from unit length, so inputs must be normalized.
+// Ref: Fiedler, "Snapshot Compression"
+namespace BSMath
+{
+	namespace Detail
+	{
+		template <size_t ComponentBits>
+		struct SmallestThree final
+		{
+			// An even number of steps puts zero on the Center level, so identity and axis rotations stay exact.
+			static constexpr uint32 Max = (1u << ComponentBits) - 2;
+			static constexpr int Center = static_cast<int>(Max / 2);
+			static constexpr uint32 Mask = (1u << ComponentBits) - 1;
+			static constexpr float Range = 0.707106781f;
+			static constexpr float EncodeScale = static_cast<float>(Max) * Range;
+			static constexpr float EncodeBias = static_cast<float>(Max) * 0.5f;
+			static constexpr float DecodeScale = 2.0f * Range / static_cast<float>(Max);
+
+			// Bit offsets of the three kept components from the last, and of the index.
+			static constexpr int IndexOffset = static_cast<int>(ComponentBits) * 3;
+			static constexpr size_t ByteNum = (ComponentBits * 3 + 2 + 7) / 8;
+
+			[[nodiscard]] static uint32 Quantize(float n) noexcept
+			{
+				return static_cast<uint32>(Clamp(std::lrint(n * EncodeScale + EncodeBias), 0L, static_cast<long>(Max)));
+			}
+
+			// Centering before scaling keeps zero exact even if the multiply and add were fused.
+			[[nodiscard]] static float Dequantize(uint32 n) noexcept
+			{
+				return static_cast<float>(static_cast<int>(n) - Center) * DecodeScale;
+			}
+		};
+	}
+
+	// Packed into the low bytes of a little endian word: the last kept component at bit 0,
+	// then the others, then the index. 10, 15 and 20 bits fill 32, 48 and 64 bit budgets.
+	template <size_t ComponentBits>
+	struct CompressedQuaternion final
+	{
+	private:
+		using Codec = Detail::SmallestThree<ComponentBits>;
+
+	public:
+		static_assert(ComponentBits >= 2 && ComponentBits <= 20, "Components take 2 to 20 bits.");
+
+		static constexpr size_t ByteNum = Codec::ByteNum;
+
+	public:
+		CompressedQuaternion() noexcept : CompressedQuaternion(Quaternion::Identity) {}
+
+		explicit CompressedQuaternion(const Quaternion& quat) noexcept
+		{
+			// Ties go to the lower index, as in the batch version.
+			size_t largest = 0;
+			for (size_t i = 1; i < 4; ++i)
+			{
+				if (Abs(quat[i]) > Abs(quat[largest]))
+					largest = i;
+			}
+
+			const float sign = quat[largest] < 0.0f ? -1.0f : 1.0f;
+			uint64 bits = largest;
+			for (size_t i = 0; i < 4; ++i)
+			{
+				if (i != largest)
+					bits = (bits << ComponentBits) | Codec::Quantize(quat[i] * sign);
+			}
+
+			Detail::StorePackedBits<ByteNum>(bits, data);
+		}
+
+		[[nodiscard]] Quaternion ToQuaternion() const noexcept
+		{
+			const uint64 bits = Detail::LoadPackedBits<ByteNum>(data);
+
+			float kept[3];
+			for (size_t i = 0; i < 3; ++i)
+				kept[2 - i] = Codec::Dequantize(static_cast<uint32>(bits >> (i * ComponentBits)) & Codec::Mask);
+
+			const auto largest = static_cast<size_t>(bits >> Codec::IndexOffset) & 3;
+			const float lengthSquared = kept[0] * kept[0] + kept[1] * kept[1] + kept[2] * kept[2];
+
+			Quaternion ret;
+			for (size_t i = 0, j = 0; i < 4; ++i)
+				ret[i] = i == largest ? std::sqrt(Max(1.0f - lengthSquared, 0.0f)) : kept[j++];
+			return ret;
+		}
+
+	public:
+		uint8 data[ByteNum];
+	};
+
+	using CompressedQuaternion32 = CompressedQuaternion<10>;
+	using CompressedQuaternion48 = CompressedQuaternion<15>;
+	using CompressedQuaternion64 = CompressedQuaternion<20>;
+
+	// Global Operators
+
+	template <size_t ComponentBits>
+	[[nodiscard]] NO_ODR bool operator==(const CompressedQuaternion<ComponentBits>& lhs, const CompressedQuaternion<ComponentBits>& rhs) noexcept
+	{
+		return std::memcmp(lhs.data, rhs.data, CompressedQuaternion<ComponentBits>::ByteNum) == 0;
+	}
+
+	template <size_t ComponentBits>
+	[[nodiscard]] NO_ODR bool operator!=(const CompressedQuaternion<ComponentBits>& lhs, const CompressedQuaternion<ComponentBits>& rhs) noexcept { return !(lhs == rhs); }
+
+	// Batch Functions
+
+	namespace Detail
+	{
+		// Compresses four quaternions in SoA form, one lane each.
+		template <size_t ComponentBits>
+		void CompressQuaternions(const Quaternion* quats, CompressedQuaternion<ComponentBits>* out) noexcept
+		{
+			using namespace SIMD;
+			using Codec = SmallestThree<ComponentBits>;
+			constexpr auto Bits = static_cast<int>(ComponentBits);
+
+			VectorRegister<float> lanes[4]{ VectorLoadPtr(&quats[0].x), VectorLoadPtr(&quats[1].x), VectorLoadPtr(&quats[2].x), VectorLoadPtr(&quats[3].x) };
+			VectorTranspose(lanes);
+			const auto [x, y, z, w] = lanes;
+
+			const auto absX = VectorAbs(x), absY = VectorAbs(y), absZ = VectorAbs(z), absW = VectorAbs(w);
+			const auto largestAbs = VectorMax(VectorMax(absX, absY), VectorMax(absZ, absW));
+
+			// Checking from the back lets the lowest index win ties.
+			auto largest = VectorLoad1(3);
+			largest = VectorSelect(VectorLoad1(2), largest, VectorCastInt(VectorEqual(absZ, largestAbs)));
+			largest = VectorSelect(VectorLoad1(1), largest, VectorCastInt(VectorEqual(absY, largestAbs)));
+			largest = VectorSelect(VectorLoad1(0), largest, VectorCastInt(VectorEqual(absX, largestAbs)));
+
+			const auto isX = VectorCastFloat(VectorEqual(largest, VectorLoad1(0)));
+			const auto isY = VectorCastFloat(VectorEqual(largest, VectorLoad1(1)));
+			const auto isZ = VectorCastFloat(VectorEqual(largest, VectorLoad1(2)));
+			const auto beforeZ = VectorCastFloat(VectorLessThan(largest, VectorLoad1(2)));
+			const auto beforeW = VectorCastFloat(VectorLessThan(largest, VectorLoad1(3)));
+
+			const auto dropped = VectorSelect(x, VectorSelect(y, VectorSelect(z, w, isZ), isY), isX);
+			const auto sign = VectorAnd(VectorLessThan(dropped, Zero<float>), VectorLoad1(-0.0f));
+
+			const auto quantize = [=](VectorRegister<float> component)
+			{
+				const auto flipped = VectorXor(component, sign);
+				const auto level = VectorRoundInt(VectorAdd(VectorMultiply(flipped, VectorLoad1(Codec::EncodeScale)), VectorLoad1(Codec::EncodeBias)));
+				return VectorMin(VectorMax(level, VectorLoad1(0)), VectorLoad1(static_cast<int>(Codec::Max)));
+			};
+
+			auto low = VectorLoad1(0), high = VectorLoad1(0);
+			AddField<0, Bits>(quantize(VectorSelect(w, z, beforeW)), low, high);
+			AddField<Bits, Bits>(quantize(VectorSelect(z, y, beforeZ)), low, high);
+			AddField<Bits * 2, Bits>(quantize(VectorSelect(y, x, isX)), low, high);
+			AddField<Codec::IndexOffset, 2>(largest, low, high);
+
+			StorePackedBlock(low, high, out);
+		}
+
+		template <size_t ComponentBits>
+		void DecompressQuaternions(const CompressedQuaternion<ComponentBits>* quats, Quaternion* out) noexcept
+		{
+			using namespace SIMD;
+			using Codec = SmallestThree<ComponentBits>;
+			constexpr auto Bits = static_cast<int>(ComponentBits);
+
+			VectorRegister<int> low, high;
+			LoadPackedBlock(quats, low, high);
+			const auto dequantize = [](VectorRegister<int> level)
+			{
+				return VectorMultiply(VectorConvertFloat(VectorSubtract(level, VectorLoad1(Codec::Center))), VectorLoad1(Codec::DecodeScale));
+			};
+
+			const auto first = dequantize(GetField<Bits * 2, Bits>(low, high));
+			const auto second = dequantize(GetField<Bits, Bits>(low, high));
+			const auto third = dequantize(GetField<0, Bits>(low, high));
+			const auto largest = GetField<Codec::IndexOffset, 2>(low, high);
+
+			auto lengthSquared = VectorAdd(VectorMultiply(first, first), VectorMultiply(second, second));
+			lengthSquared = VectorAdd(lengthSquared, VectorMultiply(third, third));
+			const auto dropped = VectorSqrt(VectorMax(VectorSubtract(VectorLoad1(1.0f), lengthSquared), Zero<float>));
+
+			const auto isX = VectorCastFloat(VectorEqual(largest, VectorLoad1(0)));
+			const auto isY = VectorCastFloat(VectorEqual(largest, VectorLoad1(1)));
+			const auto isZ = VectorCastFloat(VectorEqual(largest, VectorLoad1(2)));
+			const auto isW = VectorCastFloat(VectorEqual(largest, VectorLoad1(3)));
+			const auto beforeZ = VectorCastFloat(VectorLessThan(largest, VectorLoad1(2)));
+
+			VectorRegister<float> lanes[4];
+			lanes[0] = VectorSelect(dropped, first, isX);
+			lanes[1] = VectorSelect(dropped, VectorSelect(first, second, isX), isY);
+			lanes[2] = VectorSelect(dropped, VectorSelect(second, third, beforeZ), isZ);
+			lanes[3] = VectorSelect(dropped, third, isW);
+			VectorTranspose(lanes);
+
+			for (size_t i = 0; i < 4; ++i)
+				VectorStorePtr(lanes[i], &out[i].x);
+		}
+	}
+
+	template <size_t ComponentBits>
+	void Compress(const Quaternion* quats, size_t size, CompressedQuaternion<ComponentBits>* out) noexcept
+	{
+		Detail::ForEachBlock(quats, size, out, Detail::CompressQuaternions<ComponentBits>);
+	}
+
+	template <size_t ComponentBits>
+	void Decompress(const CompressedQuaternion<ComponentBits>* quats, size_t size, Quaternion* out) noexcept
+	{
+		Detail::ForEachBlock(quats, size, out, Detail::DecompressQuaternions<ComponentBits>);
+	}
+
+	// Rotation angles between quaternions and their compressed round trips, in radians.
+	struct CompressionError final
+	{
+		float maxAngle = 0.0f;
+		float meanAngle = 0.0f;
+	};
+
+	template <size_t ComponentBits>
+	[[nodiscard]] CompressionError MeasureCompressionError(const Quaternion* quats, size_t size) noexcept
+	{
+		constexpr size_t BlockSize = 64;
+		CompressedQuaternion<ComponentBits> compressed[BlockSize];
+		Quaternion decompressed[BlockSize];
+
+		CompressionError ret;
+		double angleSum = 0.0;
+		for (size_t idx = 0; idx < size; idx += BlockSize)
+		{
+			const size_t blockSize = Min(BlockSize, size - idx);
+			Compress(quats + idx, blockSize, compressed);
+			Decompress(compressed, blockSize, decompressed);
+
+			for (size_t i = 0; i < blockSize; ++i)
+			{
+				// The chord between unit quaternions is 2 * sin(angle / 4), precise for small angles
+				// unlike the acos of their dot product.
+				const auto& quat = quats[idx + i];
+				const float sign = (quat | decompressed[i]) < 0.0f ? -1.0f : 1.0f;
+
+				float chordSquared = 0.0f;
+				for (size_t j = 0; j < 4; ++j)
+					chordSquared += Square(quat[j] - decompressed[i][j] * sign);
+
+				const float angle = 4.0f * Asin(Min(std::sqrt(chordSquared) * 0.5f, 1.0f));
+				ret.maxAngle = Max(ret.maxAngle, angle);
+				angleSum += angle;
+			}
+		}
+
+		ret.meanAngle = size > 0 ? static_cast<float>(angleSum / size) : 0.0f;
+		return ret;
+	}
+}
@@ -170,8 +170,8 @@ namespace BSMath::Creator
 			{
 				xScale,   0.0f,                       0.0f, 0.0f,
 				  0.0f, yScale,                       0.0f, 0.0f,
-				  0.0f,   0.0f,         far / (far - near), 0.0f,
-				  0.0f,   0.0f, -near * far / (far - near), 1.0f
+				  0.0f,   0.0f,         far / (far - near), 1.0f,
+				  0.0f,   0.0f, -near * far / (far - near), 0.0f
 			};
 		}
 
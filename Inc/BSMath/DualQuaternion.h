@@ -0,0 +1,239 @@
+#pragma once
+
+#include "Transform.h"
+
+// Rigid transforms as a rotation quaternion and a dual part holding the translation. Blending
+// them keeps the volume that blending matrices loses at twisting joints, in 32 bytes per bone
+// instead of 64. Like Quaternion and Transform, lhs * rhs applies rhs first.
+// Ref: Kavan et al., "Geometric Skinning with Approximate Dual Quaternion Blending"
+namespace BSMath
+{
+	struct alignas(16) DualQuaternion final
+	{
+	public:
+		static const DualQuaternion Identity;
+
+	public:
+		constexpr DualQuaternion() noexcept : real(), dual(0.0f, 0.0f, 0.0f, 0.0f) {}
+
+		explicit constexpr DualQuaternion(const Quaternion& inReal, const Quaternion& inDual) noexcept
+			: real(inReal), dual(inDual) {}
+
+		// Rotates and then translates.
+		explicit DualQuaternion(const Quaternion& rotation, const Vector3& translation) noexcept;
+
+		[[nodiscard]] Vector3 GetTranslation() const noexcept;
+
+		[[nodiscard]] Vector3 TransformPoint(const Vector3& point) const noexcept;
+		[[nodiscard]] Vector3 TransformDirection(const Vector3& direction) const noexcept;
+
+		// The inverse of a normalized dual quaternion.
+		[[nodiscard]] DualQuaternion GetInvert() const noexcept;
+
+		// Scales the real part to unit length and makes the dual part orthogonal to it.
+		bool Normalize() noexcept;
+
+		[[nodiscard]] static DualQuaternion GetNormal(const DualQuaternion& dq) noexcept
+		{
+			DualQuaternion ret = dq;
+			return ret.Normalize() ? ret : DualQuaternion::Identity;
+		}
+
+		DualQuaternion& operator*=(const DualQuaternion& other) noexcept;
+
+	public:
+		Quaternion real;
+		Quaternion dual;
+	};
+
+	inline const DualQuaternion DualQuaternion::Identity{};
+
+	namespace Detail
+	{
+		// The vector part of 2 * dual * conjugate(real), with a zero w lane.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorDualTranslation(SIMD::VectorRegister<float> real, SIMD::VectorRegister<float> dual) noexcept
+		{
+			using namespace SIMD;
+			auto ret = VectorMultiply(VectorReplicate<Swizzle::W>(real), dual);
+			ret = VectorSubtract(ret, VectorMultiply(VectorReplicate<Swizzle::W>(dual), real));
+			ret = VectorAdd(ret, VectorCross(real, dual));
+			return VectorAdd(ret, ret);
+		}
+
+		// The length must not be zero.
+		NO_ODR void VECTOR_CALL VectorNormalizeDual(SIMD::VectorRegister<float>& real, SIMD::VectorRegister<float>& dual) noexcept
+		{
+			using namespace SIMD;
+			const auto inverseLength = VectorInvSqrt(VectorQuaternionDot(real, real));
+			real = VectorMultiply(real, inverseLength);
+			dual = VectorMultiply(dual, inverseLength);
+			dual = VectorSubtract(dual, VectorMultiply(real, VectorQuaternionDot(real, dual)));
+		}
+	}
+
+	NO_ODR DualQuaternion::DualQuaternion(const Quaternion& rotation, const Vector3& translation) noexcept
+		: real(rotation), dual()
+	{
+		using namespace SIMD;
+		const auto pure = VectorAnd(VectorLoadPtr(translation.data), VectorCastFloat(VectorLoad(-1, -1, -1, 0)));
+		const auto product = Detail::VectorQuaternionMultiply(pure, VectorLoadPtr(&rotation.x));
+		VectorStorePtr(VectorMultiply(product, VectorLoad1(0.5f)), &dual.x);
+	}
+
+	NO_ODR Vector3 DualQuaternion::GetTranslation() const noexcept
+	{
+		using namespace SIMD;
+		return Detail::ToVector3(Detail::VectorDualTranslation(VectorLoadPtr(&real.x), VectorLoadPtr(&dual.x)));
+	}
+
+	NO_ODR Vector3 DualQuaternion::TransformPoint(const Vector3& point) const noexcept
+	{
+		using namespace SIMD;
+		const auto realVec = VectorLoadPtr(&real.x);
+		const auto rotated = Detail::VectorRotate(realVec, VectorLoadPtr(point.data));
+		return Detail::ToVector3(VectorAdd(rotated, Detail::VectorDualTranslation(realVec, VectorLoadPtr(&dual.x))));
+	}
+
+	NO_ODR Vector3 DualQuaternion::TransformDirection(const Vector3& direction) const noexcept
+	{
+		using namespace SIMD;
+		return Detail::ToVector3(Detail::VectorRotate(VectorLoadPtr(&real.x), VectorLoadPtr(direction.data)));
+	}
+
+	NO_ODR DualQuaternion DualQuaternion::GetInvert() const noexcept
+	{
+		using namespace SIMD;
+		DualQuaternion ret;
+		VectorStorePtr(Detail::VectorConjugate(VectorLoadPtr(&real.x)), &ret.real.x);
+		VectorStorePtr(Detail::VectorConjugate(VectorLoadPtr(&dual.x)), &ret.dual.x);
+		return ret;
+	}
+
+	NO_ODR bool DualQuaternion::Normalize() noexcept
+	{
+		using namespace SIMD;
+		if ((real | real) <= 0.0f)
+			return false;
+
+		auto realVec = VectorLoadPtr(&real.x);
+		auto dualVec = VectorLoadPtr(&dual.x);
+		Detail::VectorNormalizeDual(realVec, dualVec);
+		VectorStorePtr(realVec, &real.x);
+		VectorStorePtr(dualVec, &dual.x);
+		return true;
+	}
+
+	NO_ODR DualQuaternion& DualQuaternion::operator*=(const DualQuaternion& other) noexcept
+	{
+		using namespace SIMD;
+		const auto lhsReal = VectorLoadPtr(&real.x), lhsDual = VectorLoadPtr(&dual.x);
+		const auto rhsReal = VectorLoadPtr(&other.real.x), rhsDual = VectorLoadPtr(&other.dual.x);
+
+		const auto realVec = Detail::VectorQuaternionMultiply(lhsReal, rhsReal);
+		const auto dualVec = VectorAdd(Detail::VectorQuaternionMultiply(lhsReal, rhsDual), Detail::VectorQuaternionMultiply(lhsDual, rhsReal));
+		VectorStorePtr(realVec, &real.x);
+		VectorStorePtr(dualVec, &dual.x);
+		return *this;
+	}
+
+	// Global Operators
+
+	[[nodiscard]] NO_ODR bool operator==(const DualQuaternion& lhs, const DualQuaternion& rhs) noexcept
+	{
+		return lhs.real == rhs.real && lhs.dual == rhs.dual;
+	}
+
+	[[nodiscard]] NO_ODR bool operator!=(const DualQuaternion& lhs, const DualQuaternion& rhs) noexcept { return !(lhs == rhs); }
+
+	[[nodiscard]] NO_ODR DualQuaternion operator*(const DualQuaternion& lhs, const DualQuaternion& rhs) noexcept
+	{
+		return DualQuaternion{ lhs } *= rhs;
+	}
+
+	// Global Functions
+
+	[[nodiscard]] NO_ODR bool IsNearlyEqual(const DualQuaternion& lhs, const DualQuaternion& rhs, float tolerance = Epsilon) noexcept
+	{
+		return IsNearlyEqual(lhs.real, rhs.real, tolerance) && IsNearlyEqual(lhs.dual, rhs.dual, tolerance);
+	}
+
+	// Weighted sum normalized, each term flipped into the hemisphere of the first so that
+	// the blend takes the shorter arc. The weights must not sum to zero.
+	[[nodiscard]] NO_ODR DualQuaternion Blend(const DualQuaternion* dqs, const float* weights, size_t size) noexcept
+	{
+		using namespace SIMD;
+		if (size == 0)
+			return DualQuaternion::Identity;
+
+		const auto first = VectorLoadPtr(&dqs[0].real.x);
+		auto real = VectorLoad1(0.0f), dual = VectorLoad1(0.0f);
+		for (size_t i = 0; i < size; ++i)
+		{
+			const auto dqReal = VectorLoadPtr(&dqs[i].real.x);
+			const auto sign = VectorAnd(Detail::VectorQuaternionDot(first, dqReal), VectorLoad1(-0.0f));
+			const auto weight = VectorXor(VectorLoad1(weights[i]), sign);
+			real = VectorAdd(real, VectorMultiply(dqReal, weight));
+			dual = VectorAdd(dual, VectorMultiply(VectorLoadPtr(&dqs[i].dual.x), weight));
+		}
+
+		Detail::VectorNormalizeDual(real, dual);
+
+		DualQuaternion ret;
+		VectorStorePtr(real, &ret.real.x);
+		VectorStorePtr(dual, &ret.dual.x);
+		return ret;
+	}
+
+	// Batch Functions
+
+	namespace Detail
+	{
+		template <bool HasNormals>
+		void SkinVertices(const DualQuaternion* bones, const uint16* indices, const Vector4* weights, const Vector3* positions,
+			const Vector3* normals, size_t size, Vector3* outPositions, Vector3* outNormals) noexcept
+		{
+			using namespace SIMD;
+			for (size_t i = 0; i < size; ++i)
+			{
+				const auto* index = indices + i * 4;
+				const auto weight = VectorLoadPtr(weights[i].data);
+
+				const auto first = VectorLoadPtr(&bones[index[0]].real.x);
+				auto real = VectorMultiply(first, VectorReplicate<Swizzle::X>(weight));
+				auto dual = VectorMultiply(VectorLoadPtr(&bones[index[0]].dual.x), VectorReplicate<Swizzle::X>(weight));
+
+				const auto add = [&](const DualQuaternion& bone, VectorRegister<float> boneWeight)
+				{
+					const auto boneReal = VectorLoadPtr(&bone.real.x);
+					boneWeight = VectorXor(boneWeight, VectorAnd(VectorQuaternionDot(first, boneReal), VectorLoad1(-0.0f)));
+					real = VectorAdd(real, VectorMultiply(boneReal, boneWeight));
+					dual = VectorAdd(dual, VectorMultiply(VectorLoadPtr(&bone.dual.x), boneWeight));
+				};
+
+				add(bones[index[1]], VectorReplicate<Swizzle::Y>(weight));
+				add(bones[index[2]], VectorReplicate<Swizzle::Z>(weight));
+				add(bones[index[3]], VectorReplicate<Swizzle::W>(weight));
+				VectorNormalizeDual(real, dual);
+
+				const auto rotated = VectorRotate(real, VectorLoadPtr(positions[i].data));
+				outPositions[i] = ToVector3(VectorAdd(rotated, VectorDualTranslation(real, dual)));
+				if constexpr (HasNormals)
+					outNormals[i] = ToVector3(VectorRotate(real, VectorLoadPtr(normals[i].data)));
+			}
+		}
+	}
+
+	// Dual quaternion skinning. Each vertex has four bone indices in a row of indices and their
+	// weights in a Vector4, unused slots taking a zero weight. Each vertex's weights must not sum to zero.
+	NO_ODR void SkinVertices(const DualQuaternion* bones, const uint16* indices, const Vector4* weights,
+		const Vector3* positions, size_t size, Vector3* out) noexcept
+	{
+		Detail::SkinVertices<false>(bones, indices, weights, positions, nullptr, size, out, nullptr);
+	}
+
+	NO_ODR void SkinVertices(const DualQuaternion* bones, const uint16* indices, const Vector4* weights,
+		const Vector3* positions, const Vector3* normals, size_t size, Vector3* outPositions, Vector3* outNormals) noexcept
+	{
+		Detail::SkinVertices<true>(bones, indices, weights, positions, normals, size, outPositions, outNormals);
+	}
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Matrix.h"
+#include "Plane.h"
+
+namespace BSMath
+{
+	struct alignas(16) Frustum final
+	{
+	public:
+		constexpr static size_t PlaneNum = 6;
+
+	public:
+		constexpr Frustum() noexcept : planes() {}
+
+		explicit Frustum(const Matrix4& viewProjection) noexcept;
+
+		[[nodiscard]] bool IsInside(const Vector3& point) const noexcept;
+		[[nodiscard]] bool Intersect(const Vector3& center, float radius) const noexcept;
+		[[nodiscard]] bool Intersect(const Sphere& sphere) const noexcept { return Intersect(sphere.GetCenter(), sphere.GetRadius()); }
+		[[nodiscard]] bool Intersect(const AABB& box) const noexcept;
+
+	public:
+		// Left, Right, Bottom, Top, Near, Far. Normals face inside.
+		Plane planes[PlaneNum];
+	};
+
+	NO_ODR Frustum::Frustum(const Matrix4& viewProjection) noexcept : planes()
+	{
+		// Ref: Gribb, Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix"
+
+		using namespace SIMD;
+		const auto columns = Detail::LoadMatrix(viewProjection.GetTranspose());
+
+		const VectorRegister<float> result[PlaneNum]
+		{
+			VectorAdd(columns[3], columns[0]),
+			VectorSubtract(columns[3], columns[0]),
+			VectorAdd(columns[3], columns[1]),
+			VectorSubtract(columns[3], columns[1]),
+			columns[2],
+			VectorSubtract(columns[3], columns[2])
+		};
+
+		for (size_t i = 0; i < PlaneNum; ++i)
+			VectorStore(Detail::NormalizePlane(result[i]), planes[i].vec.data);
+	}
+
+	NO_ODR bool Frustum::IsInside(const Vector3& point) const noexcept
+	{
+		return Intersect(point, 0.0f);
+	}
+
+	NO_ODR bool Frustum::Intersect(const Vector3& center, float radius) const noexcept
+	{
+		using namespace SIMD;
+		const auto point = Detail::LoadPoint(center);
+
+		for (size_t i = 0; i < PlaneNum; ++i)
+			if (Detail::PlaneDot(VectorLoad(planes[i].vec.data), point) < -radius)
+				return false;
+
+		return true;
+	}
+
+	NO_ODR bool Frustum::Intersect(const AABB& box) const noexcept
+	{
+		using namespace SIMD;
+		const auto center = box.GetCenter();
+		const auto point = Detail::LoadPoint(center);
+		const auto extent = VectorLoad(box.GetExtent().data);
+
+		for (size_t i = 0; i < PlaneNum; ++i)
+		{
+			const auto plane = VectorLoad(planes[i].vec.data);
+			const float radius = Detail::PlaneDot(VectorAbs(plane), extent);
+			if (Detail::PlaneDot(plane, point) < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	// Batch culling writes one bit per object into outMask, set when the object is visible.
+	// Eight objects are tested per iteration, so outMask must hold (size + 7) / 8 bytes.
+
+	namespace Detail
+	{
+		[[nodiscard]] NO_ODR int CullSpherePacket(const Vector4Packet(&planes)[Frustum::PlaneNum],
+			const Vector3Packet& center, SIMD::VectorRegister<float> radius) noexcept
+		{
+			using namespace SIMD;
+			const auto negRadius = VectorNegate(radius);
+
+			auto visible = Zero<float>;
+			for (size_t i = 0; i < Frustum::PlaneNum; ++i)
+			{
+				auto dist = VectorMultiplyAdd(center[0], planes[i][0], planes[i][3]);
+				dist = VectorMultiplyAdd(center[1], planes[i][1], dist);
+				dist = VectorMultiplyAdd(center[2], planes[i][2], dist);
+
+				const auto inside = VectorGreaterEqual(dist, negRadius);
+				visible = i == 0 ? inside : VectorAnd(visible, inside);
+			}
+
+			return VectorMoveMask(visible);
+		}
+
+		[[nodiscard]] NO_ODR int CullBoxPacket(const Vector4Packet(&planes)[Frustum::PlaneNum],
+			const Vector4Packet(&absPlanes)[Frustum::PlaneNum], const Vector3Packet& min, const Vector3Packet& max) noexcept
+		{
+			using namespace SIMD;
+			const auto half = VectorLoad1(0.5f);
+			const auto center = (min + max) * half;
+			const auto extent = (max - min) * half;
+
+			auto visible = Zero<float>;
+			for (size_t i = 0; i < Frustum::PlaneNum; ++i)
+			{
+				auto dist = VectorMultiplyAdd(center[0], planes[i][0], planes[i][3]);
+				dist = VectorMultiplyAdd(center[1], planes[i][1], dist);
+				dist = VectorMultiplyAdd(center[2], planes[i][2], dist);
+
+				auto radius = VectorMultiply(extent[0], absPlanes[i][0]);
+				radius = VectorMultiplyAdd(extent[1], absPlanes[i][1], radius);
+				radius = VectorMultiplyAdd(extent[2], absPlanes[i][2], radius);
+
+				const auto inside = VectorGreaterEqual(VectorAdd(dist, radius), Zero<float>);
+				visible = i == 0 ? inside : VectorAnd(visible, inside);
+			}
+
+			return VectorMoveMask(visible);
+		}
+	}
+
+	NO_ODR void CullSpheres(const Frustum& frustum, const VectorSoA<const float, 3>& centers,
+		const float* radii, size_t size, uint8* outMask) noexcept
+	{
+		using namespace SIMD;
+
+		Vector4Packet planes[Frustum::PlaneNum];
+		for (size_t i = 0; i < Frustum::PlaneNum; ++i)
+			planes[i] = Vector4Packet{ frustum.planes[i].vec };
+
+		size_t idx = 0;
+		for (; idx + 8 <= size; idx += 8)
+		{
+			const int lo = Detail::CullSpherePacket(planes, Vector3Packet::Load(centers, idx), VectorLoadPtrUnaligned(radii + idx));
+			const int hi = Detail::CullSpherePacket(planes, Vector3Packet::Load(centers, idx + 4), VectorLoadPtrUnaligned(radii + idx + 4));
+			outMask[idx / 8] = static_cast<uint8>(lo | (hi << 4));
+		}
+
+		if (idx == size) return;
+
+		const size_t remain = size - idx;
+		const size_t loSize = Min(remain, Vector3Packet::Width);
+		int mask = Detail::CullSpherePacket(planes, Vector3Packet::Load(centers, idx, loSize), VectorLoadPtr(radii + idx, loSize));
+
+		if (remain > loSize)
+		{
+			const size_t hiSize = remain - loSize;
+			mask |= Detail::CullSpherePacket(planes, Vector3Packet::Load(centers, idx + 4, hiSize),
+				VectorLoadPtr(radii + idx + 4, hiSize)) << 4;
+		}
+
+		outMask[idx / 8] = static_cast<uint8>(mask & ((1 << remain) - 1));
+	}
+
+	NO_ODR void CullBoxes(const Frustum& frustum, const VectorSoA<const float, 3>& mins,
+		const VectorSoA<const float, 3>& maxs, size_t size, uint8* outMask) noexcept
+	{
+		using namespace SIMD;
+
+		Vector4Packet planes[Frustum::PlaneNum];
+		Vector4Packet absPlanes[Frustum::PlaneNum];
+		for (size_t i = 0; i < Frustum::PlaneNum; ++i)
+		{
+			planes[i] = Vector4Packet{ frustum.planes[i].vec };
+			absPlanes[i] = Vector4Packet{ Abs(frustum.planes[i].vec) };
+		}
+
+		size_t idx = 0;
+		for (; idx + 8 <= size; idx += 8)
+		{
+			const int lo = Detail::CullBoxPacket(planes, absPlanes, Vector3Packet::Load(mins, idx), Vector3Packet::Load(maxs, idx));
+			const int hi = Detail::CullBoxPacket(planes, absPlanes, Vector3Packet::Load(mins, idx + 4), Vector3Packet::Load(maxs, idx + 4));
+			outMask[idx / 8] = static_cast<uint8>(lo | (hi << 4));
+		}
+
+		if (idx == size) return;
+
+		const size_t remain = size - idx;
+		const size_t loSize = Min(remain, Vector3Packet::Width);
+		int mask = Detail::CullBoxPacket(planes, absPlanes,
+			Vector3Packet::Load(mins, idx, loSize), Vector3Packet::Load(maxs, idx, loSize));
+
+		if (remain > loSize)
+		{
+			const size_t hiSize = remain - loSize;
+			mask |= Detail::CullBoxPacket(planes, absPlanes,
+				Vector3Packet::Load(mins, idx + 4, hiSize), Vector3Packet::Load(maxs, idx + 4, hiSize)) << 4;
+		}
+
+		outMask[idx / 8] = static_cast<uint8>(mask & ((1 << remain) - 1));
+	}
+}
@@ -1,29 +1,207 @@
 #pragma once
 
+#include <cstring>
 #include <functional>
 #include <type_traits>
-#include "Basic.h"
+#include "SIMD.h"
 
 namespace BSMath
 {
-	template <class T, size_t L>
+	namespace Detail
+	{
+		[[nodiscard]] NO_ODR uint64 HashRead8(const unsigned char* ptr) noexcept
+		{
+			uint64 ret;
+			std::memcpy(&ret, ptr, sizeof(ret));
+			return ret;
+		}
+
+		[[nodiscard]] NO_ODR uint64 HashRead4(const unsigned char* ptr) noexcept
+		{
+			uint32 ret;
+			std::memcpy(&ret, ptr, sizeof(ret));
+			return ret;
+		}
+
+		// Replaces lhs and rhs with the low and high halves of their 128 bit product.
+		NO_ODR void HashMultiply(uint64& lhs, uint64& rhs) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			const auto product = static_cast<unsigned __int128>(lhs) * rhs;
+			lhs = static_cast<uint64>(product);
+			rhs = static_cast<uint64>(product >> 64);
+#else
+			const uint64 lhsHi = lhs >> 32, lhsLo = static_cast<uint32>(lhs);
+			const uint64 rhsHi = rhs >> 32, rhsLo = static_cast<uint32>(rhs);
+			const uint64 hh = lhsHi * rhsHi, hl = lhsHi * rhsLo, lh = lhsLo * rhsHi, ll = lhsLo * rhsLo;
+			const uint64 mid = (ll >> 32) + static_cast<uint32>(hl) + static_cast<uint32>(lh);
+			lhs = (mid << 32) | static_cast<uint32>(ll);
+			rhs = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+#endif
+		}
+
+		[[nodiscard]] NO_ODR uint64 HashMix(uint64 lhs, uint64 rhs) noexcept
+		{
+			HashMultiply(lhs, rhs);
+			return lhs ^ rhs;
+		}
+	}
+
+	// Ref: https://github.com/wangyi-fudan/wyhash
+	// Consumes 16 bytes per multiply, with three independent lanes for inputs longer than 48 bytes.
+	struct WyHasher final
+	{
+		[[nodiscard]] static uint64 Hash(const void* data, size_t size, uint64 seed = 0) noexcept
+		{
+			constexpr uint64 Secret[4]{ 0xA0761D6478BD642Full, 0xE7037ED1A0B428DBull, 0x8EBC6AF09C88C6E3ull, 0x589965CC75374CC3ull };
+
+			const auto* ptr = static_cast<const unsigned char*>(data);
+			seed ^= Detail::HashMix(seed ^ Secret[0], Secret[1]);
+
+			uint64 a = 0, b = 0;
+			if (size <= 16)
+			{
+				if (size >= 4)
+				{
+					const size_t offset = (size >> 3) << 2;
+					a = (Detail::HashRead4(ptr) << 32) | Detail::HashRead4(ptr + offset);
+					b = (Detail::HashRead4(ptr + size - 4) << 32) | Detail::HashRead4(ptr + size - 4 - offset);
+				}
+				else if (size > 0)
+				{
+					a = (static_cast<uint64>(ptr[0]) << 16) | (static_cast<uint64>(ptr[size >> 1]) << 8) | ptr[size - 1];
+				}
+			}
+			else
+			{
+				size_t remain = size;
+				if (remain > 48)
+				{
+					uint64 seed1 = seed, seed2 = seed;
+					do
+					{
+						seed = Detail::HashMix(Detail::HashRead8(ptr) ^ Secret[1], Detail::HashRead8(ptr + 8) ^ seed);
+						seed1 = Detail::HashMix(Detail::HashRead8(ptr + 16) ^ Secret[2], Detail::HashRead8(ptr + 24) ^ seed1);
+						seed2 = Detail::HashMix(Detail::HashRead8(ptr + 32) ^ Secret[3], Detail::HashRead8(ptr + 40) ^ seed2);
+						ptr += 48;
+						remain -= 48;
+					} while (remain > 48);
+					seed ^= seed1 ^ seed2;
+				}
+
+				while (remain > 16)
+				{
+					seed = Detail::HashMix(Detail::HashRead8(ptr) ^ Secret[1], Detail::HashRead8(ptr + 8) ^ seed);
+					ptr += 16;
+					remain -= 16;
+				}
+
+				a = Detail::HashRead8(ptr + remain - 16);
+				b = Detail::HashRead8(ptr + remain - 8);
+			}
+
+			a ^= Secret[1];
+			b ^= seed;
+			Detail::HashMultiply(a, b);
+
+			return Detail::HashMix(a ^ Secret[0] ^ size, b ^ Secret[1]);
+		}
+	};
+
+	// Byte-wise FNV-1a. Slower, but stable and simple enough to reproduce anywhere.
+	struct FnvHasher final
+	{
+		[[nodiscard]] static uint64 Hash(const void* data, size_t size, uint64 seed = 14695981039346656037ull) noexcept
+		{
+			constexpr uint64 HashPrime = 1099511628211ull;
+
+			const auto* ptr = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; ++i)
+			{
+				seed ^= ptr[i];
+				seed *= HashPrime;
+			}
+			return seed;
+		}
+	};
+
+	template <class T, size_t L, class Hasher = WyHasher>
 	struct HashRange
 	{
 		[[nodiscard]] size_t operator()(const T& value) const noexcept
 		{
-			constexpr static auto HashOffsetBasis = sizeof(size_t) == 8 ? 14695981039346656037ull : 2166136261u;
-			constexpr static auto HashPrime = sizeof(size_t) == 8 ? 1099511628211ull : 16777619u;
+			return static_cast<size_t>(Hasher::Hash(&value, L));
+		}
+	};
+
+	namespace Detail
+	{
+		// -0 becomes +0 and every NaN becomes the same quiet NaN, so values equal under operator== share bits.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL CanonicalizeFloat(SIMD::VectorRegister<float> vec) noexcept
+		{
+			using namespace SIMD;
+			const auto canonicalNaN = VectorCastFloat(VectorLoad1(0x7FC00000));
+			return VectorSelect(VectorAdd(vec, Zero<float>), canonicalNaN, VectorEqual(vec, vec));
+		}
+
+		// The tail register reads past N when T is padded to it, since only N lanes are hashed afterward.
+		template <class T, size_t N, class Func>
+		NO_ODR void ForEachFloatRegister(const T& value, Func&& func) noexcept
+		{
+			constexpr bool IsPadded = sizeof(T) >= (N + 3) / 4 * 4 * sizeof(float);
+			const auto* ptr = reinterpret_cast<const float*>(&value);
+
+			for (size_t i = 0; i < N; i += 4)
+				func(IsPadded || i + 4 <= N ? SIMD::VectorLoadPtrUnaligned(ptr + i) : SIMD::VectorLoadPtr(ptr + i, N - i), i);
+		}
+	}
+
+	// Hashes the first N floats of T after canonicalizing them. Padding lanes may be loaded but are never hashed.
+	template <class T, size_t N, class Hasher = WyHasher>
+	struct FloatHashRange
+	{
+		[[nodiscard]] size_t operator()(const T& value) const noexcept
+		{
+			alignas(16) float buffer[(N + 3) / 4 * 4];
+			Detail::ForEachFloatRegister<T, N>(value, [&](auto vec, size_t idx)
+			{
+				SIMD::VectorStorePtr(Detail::CanonicalizeFloat(vec), buffer + idx);
+			});
+
+			return static_cast<size_t>(Hasher::Hash(buffer, sizeof(float) * N));
+		}
+	};
+
+	// Hashes the grid cell of each of the first N floats of T.
+	// Values in the same cell always collide, but nearly equal values may straddle a cell
+	// boundary, so lookups tolerant to cellSize should also probe the neighbouring cells.
+	template <class T, size_t N, class Hasher = WyHasher>
+	struct QuantizedHashRange
+	{
+	public:
+		explicit QuantizedHashRange(float cellSize) noexcept : invCellSize(1.0f / cellSize) {}
+
+		[[nodiscard]] size_t operator()(const T& value) const noexcept
+		{
+			using namespace SIMD;
+			const auto scale = VectorLoad1(invCellSize);
 
-			size_t val = HashOffsetBasis;
-			for (size_t i = 0; i < L; ++i)
+			alignas(16) int buffer[(N + 3) / 4 * 4];
+			Detail::ForEachFloatRegister<T, N>(value, [&](auto vec, size_t idx)
 			{
-				val ^= reinterpret_cast<const unsigned char*>(&value)[i];
-				val *= HashPrime;
-			}
-			return val;
+				VectorStorePtr(VectorFloorInt(VectorMultiply(vec, scale)), buffer + idx);
+			});
+
+			return static_cast<size_t>(Hasher::Hash(buffer, sizeof(int) * N));
 		}
+
+	private:
+		float invCellSize;
 	};
 
+	template <class T>
+	struct QuantizedHash;
+
 	template <class T, class SFINAE = void>
 	struct Hash final
 	{
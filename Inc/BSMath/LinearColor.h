@@ -0,0 +1,285 @@
+#pragma once
+
+#include <cmath>
+#include "Color.h"
+#include "Vector.h"
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Linear values of the 256 sRGB levels.
+		struct SRGBDecodeTable final
+		{
+		public:
+			SRGBDecodeTable() noexcept
+			{
+				for (int i = 0; i < 256; ++i)
+				{
+					const double srgb = i / 255.0;
+					data[i] = static_cast<float>(srgb <= 0.04045 ? srgb / 12.92 : std::pow((srgb + 0.055) / 1.055, 2.4));
+				}
+			}
+
+			[[nodiscard]] float operator[](uint8 idx) const noexcept { return data[idx]; }
+
+		public:
+			float data[256];
+		};
+
+		inline const SRGBDecodeTable SRGBDecode{};
+
+		// Piecewise linear sRGB encode in fixed point. Inputs are clamped to [2^-13, 1), and the top
+		// 3 mantissa bits with the exponent pick one of 104 segments whose bias and slope are packed
+		// as 16 bit halves. The next 8 mantissa bits interpolate. All floats in [0, 1] encode to the
+		// correctly rounded level but for 0.034% of them, which are off by one.
+		// Ref: Giesen, "float->sRGB8 using SSE2 (and a table)"
+		struct SRGBEncodeTable final
+		{
+		public:
+			constexpr static int32 MinBits = (127 - 13) << 23;
+			constexpr static int32 AlmostOneBits = 0x3F7FFFFF;
+
+			constexpr static uint32 Data[104]
+			{
+				0x006D0007u, 0x00770013u, 0x00800007u, 0x00810007u, 0x00870007u, 0x008E0007u, 0x00940007u, 0x009B0007u,
+				0x00A10014u, 0x00AE0014u, 0x00BB0014u, 0x00C80014u, 0x00D40014u, 0x00E10014u, 0x00F50018u, 0x01000014u,
+				0x0108002Du, 0x0122002Du, 0x013B002Du, 0x0155002Du, 0x01750033u, 0x0189002Du, 0x01A2002Du, 0x01BC002Du,
+				0x01DD0064u, 0x02090061u, 0x023D0061u, 0x0276006Bu, 0x02A40061u, 0x02DC006Bu, 0x030B0061u, 0x033E0061u,
+				0x037800C8u, 0x03DE00D2u, 0x044400D4u, 0x04AA00D4u, 0x050E00C8u, 0x057A00C0u, 0x05DC00C0u, 0x063900BBu,
+				0x0695015Du, 0x07420144u, 0x07E30130u, 0x087A0121u, 0x09090117u, 0x0992010Au, 0x0A150100u, 0x0A9200F8u,
+				0x0B0E01D0u, 0x0BF301B1u, 0x0CCC0191u, 0x0D940186u, 0x0E55016Fu, 0x0F0B0163u, 0x0FBB0154u, 0x10630143u,
+				0x11080261u, 0x12380240u, 0x1357021Du, 0x14650204u, 0x156501EEu, 0x165A01D3u, 0x174401BEu, 0x182301B5u,
+				0x18FE0330u, 0x1A9702F8u, 0x1C1502D1u, 0x1D7D02ADu, 0x1ED4028Du, 0x20190274u, 0x2151025Au, 0x227C0242u,
+				0x239F0441u, 0x25C103FDu, 0x27C003BFu, 0x29A00396u, 0x2B690368u, 0x2D1D033Fu, 0x2EBD031Fu, 0x304C0302u,
+				0x31CF05B6u, 0x34A90553u, 0x3752050Cu, 0x39D504C0u, 0x3C350491u, 0x3E7C0456u, 0x40A80428u, 0x42BC0400u,
+				0x44C30797u, 0x48900718u, 0x4C1C06B9u, 0x4F750661u, 0x52A30614u, 0x55AB05CCu, 0x5892058Du, 0x5B580556u,
+				0x5E0B0A26u, 0x631B0986u, 0x67DC08F0u, 0x6C530884u, 0x70970812u, 0x74A007BFu, 0x787C076Eu, 0x7C340724u
+			};
+		};
+
+		// Encodes one linear color to its sRGB levels, in the a, r, g, b order of Color.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL EncodeSRGB(SIMD::VectorRegister<float> vec) noexcept
+		{
+			using namespace SIMD;
+			using Table = SRGBEncodeTable;
+
+			// Max returns its second operand for NaN.
+			const auto clamped = VectorMin(VectorMax(vec, VectorCastFloat(VectorLoad1(Table::MinBits))),
+				VectorCastFloat(VectorLoad1(Table::AlmostOneBits)));
+			const auto bits = VectorCastInt(clamped);
+
+			alignas(16) int index[4];
+			VectorStorePtr(VectorShiftRight<20>(VectorSubtract(bits, VectorLoad1(Table::MinBits))), index);
+
+			const auto entry = VectorLoad(static_cast<int>(Table::Data[index[0]]),
+				static_cast<int>(Table::Data[index[1]]), static_cast<int>(Table::Data[index[2]]), 0);
+			const auto bias = VectorShiftLeft<9>(VectorShiftRight<16>(entry));
+			const auto scale = VectorAnd(entry, VectorLoad1(0xFFFF));
+			const auto t = VectorAnd(VectorShiftRight<12>(bits), VectorLoad1(0xFF));
+			const auto srgb = VectorShiftRight<16>(VectorAdd(bias, VectorMultiply(scale, t)));
+
+			const auto unitAlpha = VectorMin(VectorMax(vec, VectorLoad1(0.0f)), VectorLoad1(1.0f));
+			const auto alpha = VectorConvertInt(VectorMultiplyAdd(unitAlpha, VectorLoad1(255.0f), VectorLoad1(0.5f)));
+
+			const auto rgba = VectorSelect(alpha, srgb, VectorLoad(0, 0, 0, -1));
+			return VectorSwizzle<Swizzle::W, Swizzle::X, Swizzle::Y, Swizzle::Z>(rgba);
+		}
+	}
+
+	// Color in linear space with float channels, laid out as a Vector4.
+	struct alignas(16) LinearColor final
+	{
+	public:
+		static const LinearColor Black;
+		static const LinearColor Blue;
+		static const LinearColor Transparent;
+		static const LinearColor Green;
+		static const LinearColor Red;
+		static const LinearColor White;
+
+	public:
+		constexpr LinearColor() noexcept : r(1.0f), g(1.0f), b(1.0f), a(1.0f) {}
+
+		explicit constexpr LinearColor(float inR, float inG, float inB, float inA = 1.0f) noexcept
+			: r(inR), g(inG), b(inB), a(inA) {}
+
+		explicit constexpr LinearColor(const Vector4& vec) noexcept
+			: r(vec.x), g(vec.y), b(vec.z), a(vec.w) {}
+
+		// Decodes an sRGB color. Alpha stays linear.
+		explicit LinearColor(const Color& color) noexcept
+			: r(Detail::SRGBDecode[color.r]), g(Detail::SRGBDecode[color.g]),
+			b(Detail::SRGBDecode[color.b]), a(color.a * (1.0f / 255.0f)) {}
+
+		// Encodes to sRGB. Channels are clamped to [0, 1].
+		[[nodiscard]] Color ToColor() const noexcept;
+
+		[[nodiscard]] Vector4 ToVector() const noexcept { return Vector4{ r, g, b, a }; }
+
+		// Relative luminance with the Rec. 709 primaries.
+		[[nodiscard]] constexpr float GetLuminance() const noexcept
+		{
+			return 0.2126f * r + 0.7152f * g + 0.0722f * b;
+		}
+
+		LinearColor& operator+=(const LinearColor& other) noexcept;
+		LinearColor& operator-=(const LinearColor& other) noexcept;
+
+		LinearColor& operator*=(const LinearColor& other) noexcept;
+		LinearColor& operator*=(float scaler) noexcept;
+
+		LinearColor& operator/=(float divisor) noexcept;
+
+		[[nodiscard]] constexpr float& operator[](size_t i) noexcept { return (&r)[i]; }
+		[[nodiscard]] constexpr float operator[](size_t i) const noexcept { return (&r)[i]; }
+
+	public:
+		float r;
+		float g;
+		float b;
+		float a;
+	};
+
+	static_assert(sizeof(LinearColor) == sizeof(Vector4));
+
+	// Constants
+
+	inline const LinearColor LinearColor::      Black{ 0.0f, 0.0f, 0.0f };
+	inline const LinearColor LinearColor::       Blue{ 0.0f, 0.0f, 1.0f };
+	inline const LinearColor LinearColor::Transparent{ 0.0f, 0.0f, 0.0f, 0.0f };
+	inline const LinearColor LinearColor::      Green{ 0.0f, 1.0f, 0.0f };
+	inline const LinearColor LinearColor::        Red{ 1.0f, 0.0f, 0.0f };
+	inline const LinearColor LinearColor::      White{ 1.0f, 1.0f, 1.0f };
+
+	// Global Operators
+
+	[[nodiscard]] NO_ODR bool operator==(const LinearColor& lhs, const LinearColor& rhs) noexcept
+	{
+		using namespace SIMD;
+		return VectorMoveMask(VectorEqual(VectorLoadPtr(&lhs.r), VectorLoadPtr(&rhs.r))) == 0xF;
+	}
+
+	[[nodiscard]] NO_ODR bool operator!=(const LinearColor& lhs, const LinearColor& rhs) noexcept { return !(lhs == rhs); }
+
+	[[nodiscard]] NO_ODR LinearColor operator+(const LinearColor& lhs, const LinearColor& rhs) noexcept
+	{
+		return LinearColor{ lhs } += rhs;
+	}
+
+	[[nodiscard]] NO_ODR LinearColor operator-(const LinearColor& lhs, const LinearColor& rhs) noexcept
+	{
+		return LinearColor{ lhs } -= rhs;
+	}
+
+	[[nodiscard]] NO_ODR LinearColor operator*(const LinearColor& lhs, const LinearColor& rhs) noexcept
+	{
+		return LinearColor{ lhs } *= rhs;
+	}
+
+	[[nodiscard]] NO_ODR LinearColor operator*(const LinearColor& color, float scaler) noexcept
+	{
+		return LinearColor{ color } *= scaler;
+	}
+
+	[[nodiscard]] NO_ODR LinearColor operator*(float scaler, const LinearColor& color) noexcept
+	{
+		return LinearColor{ color } *= scaler;
+	}
+
+	[[nodiscard]] NO_ODR LinearColor operator/(const LinearColor& color, float divisor) noexcept
+	{
+		return LinearColor{ color } /= divisor;
+	}
+
+	// Member Operators
+
+	NO_ODR LinearColor& LinearColor::operator+=(const LinearColor& other) noexcept
+	{
+		using namespace SIMD;
+		VectorStorePtr(VectorAdd(VectorLoadPtr(&r), VectorLoadPtr(&other.r)), &r);
+		return *this;
+	}
+
+	NO_ODR LinearColor& LinearColor::operator-=(const LinearColor& other) noexcept
+	{
+		using namespace SIMD;
+		VectorStorePtr(VectorSubtract(VectorLoadPtr(&r), VectorLoadPtr(&other.r)), &r);
+		return *this;
+	}
+
+	NO_ODR LinearColor& LinearColor::operator*=(const LinearColor& other) noexcept
+	{
+		using namespace SIMD;
+		VectorStorePtr(VectorMultiply(VectorLoadPtr(&r), VectorLoadPtr(&other.r)), &r);
+		return *this;
+	}
+
+	NO_ODR LinearColor& LinearColor::operator*=(float scaler) noexcept
+	{
+		using namespace SIMD;
+		VectorStorePtr(VectorMultiply(VectorLoadPtr(&r), VectorLoad1(scaler)), &r);
+		return *this;
+	}
+
+	NO_ODR LinearColor& LinearColor::operator/=(float divisor) noexcept
+	{
+		if (divisor == 0.0f) return *this;
+
+		using namespace SIMD;
+		VectorStorePtr(VectorDivide(VectorLoadPtr(&r), VectorLoad1(divisor)), &r);
+		return *this;
+	}
+
+	// Member Functions
+
+	NO_ODR Color LinearColor::ToColor() const noexcept
+	{
+		using namespace SIMD;
+		const auto levels = Detail::EncodeSRGB(VectorLoadPtr(&r));
+		const auto bytes = VectorPackU16(VectorPack32(levels, levels), VectorPack32(levels, levels));
+		return Color{ static_cast<uint32>(VectorStore1(bytes)) };
+	}
+
+	// Global Functions
+
+	[[nodiscard]] NO_ODR LinearColor Min(const LinearColor& lhs, const LinearColor& rhs) noexcept
+	{
+		using namespace SIMD;
+
+		LinearColor ret;
+		VectorStorePtr(VectorMin(VectorLoadPtr(&lhs.r), VectorLoadPtr(&rhs.r)), &ret.r);
+		return ret;
+	}
+
+	[[nodiscard]] NO_ODR LinearColor Max(const LinearColor& lhs, const LinearColor& rhs) noexcept
+	{
+		using namespace SIMD;
+
+		LinearColor ret;
+		VectorStorePtr(VectorMax(VectorLoadPtr(&lhs.r), VectorLoadPtr(&rhs.r)), &ret.r);
+		return ret;
+	}
+
+	// Batch Functions
+
+	NO_ODR void DecodeSRGB(const Color* colors, size_t size, LinearColor* out) noexcept
+	{
+		for (size_t i = 0; i < size; ++i)
+			out[i] = LinearColor{ colors[i] };
+	}
+
+	// Four colors are packed and stored per step.
+	NO_ODR void EncodeSRGB(const LinearColor* colors, size_t size, Color* out) noexcept
+	{
+		using namespace SIMD;
+		const auto encode = [](const LinearColor* in, Color* ret)
+		{
+			const auto low = VectorPack32(Detail::EncodeSRGB(VectorLoadPtr(&in[0].r)), Detail::EncodeSRGB(VectorLoadPtr(&in[1].r)));
+			const auto high = VectorPack32(Detail::EncodeSRGB(VectorLoadPtr(&in[2].r)), Detail::EncodeSRGB(VectorLoadPtr(&in[3].r)));
+			VectorStorePtrUnaligned(VectorPackU16(low, high), reinterpret_cast<int*>(ret));
+		};
+
+		Detail::ForEachBlock(colors, size, out, encode);
+	}
+}
@@ -378,5 +378,12 @@ namespace BSMath
 
 	// Matrix's Hash
 	template <class T, size_t L>
-	struct Hash<Matrix<T, L>> final : public HashRange<Matrix<T, L>, sizeof(T) * L * L> {};
+	struct Hash<Matrix<T, L>> final : public std::conditional_t<std::is_floating_point_v<T>,
+		FloatHashRange<Matrix<T, L>, L * L>, HashRange<Matrix<T, L>, sizeof(T) * L * L>> {};
+
+	template <size_t L>
+	struct QuantizedHash<Matrix<float, L>> final : public QuantizedHashRange<Matrix<float, L>, L * L>
+	{
+		using QuantizedHashRange<Matrix<float, L>, L * L>::QuantizedHashRange;
+	};
 }
@@ -0,0 +1,478 @@
+#pragma once
+
+#include <numeric>
+#include <utility>
+#include <vector>
+#include "AABB.h"
+#include "Packet.h"
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Spread moves the low Bits bits of n to every L-th bit and Compact is its inverse.
+		template <class Key, size_t L>
+		struct MortonTraits;
+
+		template <>
+		struct MortonTraits<uint32, 2> final
+		{
+			constexpr static size_t Bits = 16;
+			constexpr static uint32 Mask = 0x55555555u;
+
+			[[nodiscard]] static uint32 Spread(uint32 n) noexcept
+			{
+#if defined(__BMI2__)
+				return _pdep_u32(n, Mask);
+#else
+				n &= 0x0000FFFFu;
+				n = (n | (n << 8)) & 0x00FF00FFu;
+				n = (n | (n << 4)) & 0x0F0F0F0Fu;
+				n = (n | (n << 2)) & 0x33333333u;
+				return (n | (n << 1)) & Mask;
+#endif
+			}
+
+			[[nodiscard]] static uint32 Compact(uint32 n) noexcept
+			{
+#if defined(__BMI2__)
+				return _pext_u32(n, Mask);
+#else
+				n &= Mask;
+				n = (n | (n >> 1)) & 0x33333333u;
+				n = (n | (n >> 2)) & 0x0F0F0F0Fu;
+				n = (n | (n >> 4)) & 0x00FF00FFu;
+				return (n | (n >> 8)) & 0x0000FFFFu;
+#endif
+			}
+		};
+
+		template <>
+		struct MortonTraits<uint64, 2> final
+		{
+			constexpr static size_t Bits = 32;
+			constexpr static uint64 Mask = 0x5555555555555555ull;
+
+			[[nodiscard]] static uint64 Spread(uint64 n) noexcept
+			{
+#if defined(__BMI2__) && defined(__x86_64__)
+				return _pdep_u64(n, Mask);
+#else
+				n &= 0x00000000FFFFFFFFull;
+				n = (n | (n << 16)) & 0x0000FFFF0000FFFFull;
+				n = (n | (n << 8)) & 0x00FF00FF00FF00FFull;
+				n = (n | (n << 4)) & 0x0F0F0F0F0F0F0F0Full;
+				n = (n | (n << 2)) & 0x3333333333333333ull;
+				return (n | (n << 1)) & Mask;
+#endif
+			}
+
+			[[nodiscard]] static uint64 Compact(uint64 n) noexcept
+			{
+#if defined(__BMI2__) && defined(__x86_64__)
+				return _pext_u64(n, Mask);
+#else
+				n &= Mask;
+				n = (n | (n >> 1)) & 0x3333333333333333ull;
+				n = (n | (n >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+				n = (n | (n >> 4)) & 0x00FF00FF00FF00FFull;
+				n = (n | (n >> 8)) & 0x0000FFFF0000FFFFull;
+				return (n | (n >> 16)) & 0x00000000FFFFFFFFull;
+#endif
+			}
+		};
+
+		template <>
+		struct MortonTraits<uint32, 3> final
+		{
+			constexpr static size_t Bits = 10;
+			constexpr static uint32 Mask = 0x09249249u;
+
+			[[nodiscard]] static uint32 Spread(uint32 n) noexcept
+			{
+#if defined(__BMI2__)
+				return _pdep_u32(n, Mask);
+#else
+				n &= 0x000003FFu;
+				n = (n | (n << 16)) & 0x030000FFu;
+				n = (n | (n << 8)) & 0x0300F00Fu;
+				n = (n | (n << 4)) & 0x030C30C3u;
+				return (n | (n << 2)) & Mask;
+#endif
+			}
+
+			// Four keys at once for the batch encoder.
+			[[nodiscard]] static SIMD::VectorRegister<int> VECTOR_CALL Spread(SIMD::VectorRegister<int> n) noexcept
+			{
+				using namespace SIMD;
+				n = VectorAnd(n, VectorLoad1(0x000003FF));
+				n = VectorAnd(VectorOr(n, VectorShiftLeft<16>(n)), VectorLoad1(0x030000FF));
+				n = VectorAnd(VectorOr(n, VectorShiftLeft<8>(n)), VectorLoad1(0x0300F00F));
+				n = VectorAnd(VectorOr(n, VectorShiftLeft<4>(n)), VectorLoad1(0x030C30C3));
+				return VectorAnd(VectorOr(n, VectorShiftLeft<2>(n)), VectorLoad1(static_cast<int>(Mask)));
+			}
+
+			[[nodiscard]] static uint32 Compact(uint32 n) noexcept
+			{
+#if defined(__BMI2__)
+				return _pext_u32(n, Mask);
+#else
+				n &= Mask;
+				n = (n | (n >> 2)) & 0x030C30C3u;
+				n = (n | (n >> 4)) & 0x0300F00Fu;
+				n = (n | (n >> 8)) & 0x030000FFu;
+				return (n | (n >> 16)) & 0x000003FFu;
+#endif
+			}
+		};
+
+		template <>
+		struct MortonTraits<uint64, 3> final
+		{
+			constexpr static size_t Bits = 21;
+			constexpr static uint64 Mask = 0x1249249249249249ull;
+
+			[[nodiscard]] static uint64 Spread(uint64 n) noexcept
+			{
+#if defined(__BMI2__) && defined(__x86_64__)
+				return _pdep_u64(n, Mask);
+#else
+				n &= 0x00000000001FFFFFull;
+				n = (n | (n << 32)) & 0x001F00000000FFFFull;
+				n = (n | (n << 16)) & 0x001F0000FF0000FFull;
+				n = (n | (n << 8)) & 0x100F00F00F00F00Full;
+				n = (n | (n << 4)) & 0x10C30C30C30C30C3ull;
+				return (n | (n << 2)) & Mask;
+#endif
+			}
+
+			[[nodiscard]] static uint64 Compact(uint64 n) noexcept
+			{
+#if defined(__BMI2__) && defined(__x86_64__)
+				return _pext_u64(n, Mask);
+#else
+				n &= Mask;
+				n = (n | (n >> 2)) & 0x10C30C30C30C30C3ull;
+				n = (n | (n >> 4)) & 0x100F00F00F00F00Full;
+				n = (n | (n >> 8)) & 0x001F0000FF0000FFull;
+				n = (n | (n >> 16)) & 0x001F00000000FFFFull;
+				return (n | (n >> 32)) & 0x00000000001FFFFFull;
+#endif
+			}
+		};
+
+		// Splits bounds into 2^Bits cells on each axis. Points on the max face go into the last cell.
+		template <class Key>
+		struct MortonQuantizer final
+		{
+		public:
+			constexpr static float CellNum = static_cast<float>(1u << MortonTraits<Key, 3>::Bits);
+			constexpr static float MaxCell = CellNum - 1.0f;
+
+		public:
+			explicit MortonQuantizer(const AABB& bounds) noexcept : min(bounds.min), scale()
+			{
+				const auto size = bounds.GetSize();
+				for (size_t i = 0; i < 3; ++i)
+					scale[i] = size[i] > 0.0f ? CellNum / size[i] : 0.0f;
+			}
+
+			[[nodiscard]] SIMD::VectorRegister<float> VECTOR_CALL operator()(SIMD::VectorRegister<float> point,
+				SIMD::VectorRegister<float> minReg, SIMD::VectorRegister<float> scaleReg) const noexcept
+			{
+				using namespace SIMD;
+				const auto cell = VectorMultiply(VectorSubtract(point, minReg), scaleReg);
+				return VectorMin(VectorMax(cell, Zero<float>), VectorLoad1(MaxCell));
+			}
+
+			[[nodiscard]] IntVector3 operator()(const Vector3& point) const noexcept
+			{
+				using namespace SIMD;
+				int cell[4];
+				VectorStore(VectorConvertInt((*this)(VectorLoad(point.data), VectorLoad(min.data), VectorLoad(scale.data))), cell);
+				return IntVector3{ cell[0], cell[1], cell[2] };
+			}
+
+			[[nodiscard]] Vector3 GetCenter(const IntVector3& cell) const noexcept
+			{
+				Vector3 ret = min;
+				for (size_t i = 0; i < 3; ++i)
+					if (scale[i] > 0.0f)
+						ret[i] += (static_cast<float>(cell[i]) + 0.5f) / scale[i];
+				return ret;
+			}
+
+		public:
+			Vector3 min;
+			Vector3 scale;
+		};
+
+		// Ref: Skilling, "Programming the Hilbert curve", AIP Conference Proceedings 707, 2004
+		template <size_t L>
+		NO_ODR void HilbertAxesToTranspose(uint32(&axes)[L], size_t bits) noexcept
+		{
+			const uint32 msb = 1u << (bits - 1);
+
+			// Inverse undo
+			for (uint32 q = msb; q > 1; q >>= 1)
+			{
+				const uint32 p = q - 1;
+				for (size_t i = 0; i < L; ++i)
+				{
+					if (axes[i] & q)
+					{
+						axes[0] ^= p;
+					}
+					else
+					{
+						const uint32 t = (axes[0] ^ axes[i]) & p;
+						axes[0] ^= t;
+						axes[i] ^= t;
+					}
+				}
+			}
+
+			// Gray encode
+			for (size_t i = 1; i < L; ++i)
+				axes[i] ^= axes[i - 1];
+
+			uint32 t = 0;
+			for (uint32 q = msb; q > 1; q >>= 1)
+				if (axes[L - 1] & q)
+					t ^= q - 1;
+
+			for (size_t i = 0; i < L; ++i)
+				axes[i] ^= t;
+		}
+
+		template <size_t L>
+		NO_ODR void HilbertTransposeToAxes(uint32(&axes)[L], size_t bits) noexcept
+		{
+			// Wraps to 0 when bits is 32, which still ends the loop below.
+			const uint32 end = 2u << (bits - 1);
+
+			// Gray decode
+			const uint32 t = axes[L - 1] >> 1;
+			for (size_t i = L - 1; i > 0; --i)
+				axes[i] ^= axes[i - 1];
+			axes[0] ^= t;
+
+			// Undo excess work
+			for (uint32 q = 2; q != end; q <<= 1)
+			{
+				const uint32 p = q - 1;
+				for (size_t i = L; i-- > 0;)
+				{
+					if (axes[i] & q)
+					{
+						axes[0] ^= p;
+					}
+					else
+					{
+						const uint32 t2 = (axes[0] ^ axes[i]) & p;
+						axes[0] ^= t2;
+						axes[i] ^= t2;
+					}
+				}
+			}
+		}
+	}
+
+	// Morton (Z-order) codes interleave the coordinate bits with x in the lowest bit.
+	// uint32 keys hold 16 bits per axis in 2D and 10 in 3D, and uint64 keys 32 and 21.
+	// Coordinates are treated as unsigned and their higher bits are discarded.
+
+	template <class Key = uint32, size_t L>
+	[[nodiscard]] NO_ODR Key EncodeMorton(const Vector<int, L>& vec) noexcept
+	{
+		using Traits = Detail::MortonTraits<Key, L>;
+
+		Key ret = 0;
+		for (size_t i = 0; i < L; ++i)
+			ret |= Traits::Spread(static_cast<Key>(static_cast<uint32>(vec[i]))) << i;
+		return ret;
+	}
+
+	template <size_t L, class Key>
+	[[nodiscard]] NO_ODR Vector<int, L> DecodeMorton(Key code) noexcept
+	{
+		using Traits = Detail::MortonTraits<Key, L>;
+
+		Vector<int, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret[i] = static_cast<int>(Traits::Compact(code >> i));
+		return ret;
+	}
+
+	// Hilbert codes visit the same cells as Morton codes, but consecutive codes are always adjacent cells.
+
+	template <class Key = uint32, size_t L>
+	[[nodiscard]] NO_ODR Key EncodeHilbert(const Vector<int, L>& vec) noexcept
+	{
+		using Traits = Detail::MortonTraits<Key, L>;
+		constexpr auto CellMask = static_cast<uint32>((static_cast<uint64>(1) << Traits::Bits) - 1);
+
+		uint32 axes[L];
+		for (size_t i = 0; i < L; ++i)
+			axes[i] = static_cast<uint32>(vec[i]) & CellMask;
+
+		Detail::HilbertAxesToTranspose(axes, Traits::Bits);
+
+		Key ret = 0;
+		for (size_t i = 0; i < L; ++i)
+			ret |= Traits::Spread(static_cast<Key>(axes[i])) << (L - 1 - i);
+		return ret;
+	}
+
+	template <size_t L, class Key>
+	[[nodiscard]] NO_ODR Vector<int, L> DecodeHilbert(Key code) noexcept
+	{
+		using Traits = Detail::MortonTraits<Key, L>;
+
+		uint32 axes[L];
+		for (size_t i = 0; i < L; ++i)
+			axes[i] = static_cast<uint32>(Traits::Compact(code >> (L - 1 - i)));
+
+		Detail::HilbertTransposeToAxes(axes, Traits::Bits);
+
+		Vector<int, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret[i] = static_cast<int>(axes[i]);
+		return ret;
+	}
+
+	// Points are quantized to the cells of bounds and clamped into it.
+	// Decoding returns the center of the cell.
+
+	template <class Key = uint32>
+	[[nodiscard]] NO_ODR Key EncodeMorton(const Vector3& point, const AABB& bounds) noexcept
+	{
+		return EncodeMorton<Key>(Detail::MortonQuantizer<Key>{ bounds }(point));
+	}
+
+	template <class Key>
+	[[nodiscard]] NO_ODR Vector3 DecodeMorton(Key code, const AABB& bounds) noexcept
+	{
+		return Detail::MortonQuantizer<Key>{ bounds }.GetCenter(DecodeMorton<3>(code));
+	}
+
+	template <class Key = uint32>
+	[[nodiscard]] NO_ODR Key EncodeHilbert(const Vector3& point, const AABB& bounds) noexcept
+	{
+		return EncodeHilbert<Key>(Detail::MortonQuantizer<Key>{ bounds }(point));
+	}
+
+	template <class Key>
+	[[nodiscard]] NO_ODR Vector3 DecodeHilbert(Key code, const AABB& bounds) noexcept
+	{
+		return Detail::MortonQuantizer<Key>{ bounds }.GetCenter(DecodeHilbert<3>(code));
+	}
+
+	// Batch Functions
+
+	template <class Key = uint32>
+	NO_ODR void EncodeMortons(const AABB& bounds, const VectorSoA<const float, 3>& points,
+		size_t size, Key* outKeys) noexcept
+	{
+		using namespace SIMD;
+		const Detail::MortonQuantizer<Key> quantizer{ bounds };
+
+		if constexpr (std::is_same_v<Key, uint32>)
+		{
+			using Traits = Detail::MortonTraits<uint32, 3>;
+			const Vector3Packet min{ quantizer.min };
+			const Vector3Packet scale{ quantizer.scale };
+
+			const auto encode = [&](const Vector3Packet& point)
+			{
+				const auto x = VectorConvertInt(quantizer(point[0], min[0], scale[0]));
+				const auto y = VectorConvertInt(quantizer(point[1], min[1], scale[1]));
+				const auto z = VectorConvertInt(quantizer(point[2], min[2], scale[2]));
+				return VectorOr(Traits::Spread(x), VectorOr(VectorShiftLeft<1>(Traits::Spread(y)), VectorShiftLeft<2>(Traits::Spread(z))));
+			};
+
+			auto* keys = reinterpret_cast<int*>(outKeys);
+
+			size_t idx = 0;
+			for (; idx + Vector3Packet::Width <= size; idx += Vector3Packet::Width)
+				VectorStorePtrUnaligned(encode(Vector3Packet::Load(points, idx)), keys + idx);
+
+			if (idx < size)
+				VectorStorePtr(encode(Vector3Packet::Load(points, idx, size - idx)), keys + idx, size - idx);
+		}
+		else
+		{
+			for (size_t i = 0; i < size; ++i)
+				outKeys[i] = EncodeMorton<Key>(quantizer(points.Get(i)));
+		}
+	}
+
+	// LSD radix sort on bytes, stable, permuting values along with keys.
+	// Passes where every key shares the byte are skipped.
+	template <class Key>
+	NO_ODR void RadixSort(Key* keys, uint32* values, size_t size)
+	{
+		constexpr size_t DigitNum = sizeof(Key);
+		if (size <= 1) return;
+
+		std::vector<uint32> histogram(DigitNum * 256);
+		for (size_t i = 0; i < size; ++i)
+			for (size_t digit = 0; digit < DigitNum; ++digit)
+				++histogram[digit * 256 + ((keys[i] >> (digit * 8)) & 0xFF)];
+
+		std::vector<Key> keyBuffer(size);
+		std::vector<uint32> valueBuffer(size);
+
+		Key* srcKeys = keys;
+		Key* dstKeys = keyBuffer.data();
+		uint32* srcValues = values;
+		uint32* dstValues = valueBuffer.data();
+
+		for (size_t digit = 0; digit < DigitNum; ++digit)
+		{
+			uint32* offsets = histogram.data() + digit * 256;
+			const size_t shift = digit * 8;
+			if (offsets[(srcKeys[0] >> shift) & 0xFF] == size) continue;
+
+			uint32 sum = 0;
+			for (size_t i = 0; i < 256; ++i)
+			{
+				const uint32 count = offsets[i];
+				offsets[i] = sum;
+				sum += count;
+			}
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				const uint32 pos = offsets[(srcKeys[i] >> shift) & 0xFF]++;
+				dstKeys[pos] = srcKeys[i];
+				dstValues[pos] = srcValues[i];
+			}
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcValues, dstValues);
+		}
+
+		if (srcKeys != keys)
+		{
+			std::copy_n(srcKeys, size, keys);
+			std::copy_n(srcValues, size, values);
+		}
+	}
+
+	// Writes the point indices in Morton order of the points.
+	template <class Key = uint32>
+	NO_ODR void SortByMorton(const AABB& bounds, const VectorSoA<const float, 3>& points,
+		size_t size, uint32* outIndices)
+	{
+		std::vector<Key> keys(size);
+		EncodeMortons(bounds, points, size, keys.data());
+
+		std::iota(outIndices, outIndices + size, 0u);
+		RadixSort(keys.data(), outIndices, size);
+	}
+}
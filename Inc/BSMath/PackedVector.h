@@ -0,0 +1,588 @@
+#pragma once
+
+#include <cstring>
+#include "Batch.h"
+#include "Vector.h"
+
+// Compact storage formats for vertex streams and replication: IEEE 754 half floats and
+// normalized integers (SNORM16, UNORM8). Values are converted to float for arithmetic.
+// Bulk conversions run four components per register, with F16C when HAS_F16C is defined.
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Rounds to nearest even. Overflow becomes infinity and NaNs become a quiet NaN.
+		// Ref: Giesen, "float->half variants"
+		[[nodiscard]] NO_ODR uint16 FloatToHalf(float n) noexcept
+		{
+			uint32 bits;
+			std::memcpy(&bits, &n, sizeof(bits));
+			const auto sign = bits & 0x80000000u;
+			bits ^= sign;
+
+			uint32 ret;
+			if (bits >= 0x47800000u)
+			{
+				ret = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+			}
+			else if (bits < 0x38800000u)
+			{
+				// Adding 0.5 aligns the denormal mantissa to the low bits and rounds it.
+				float denormal;
+				std::memcpy(&denormal, &bits, sizeof(denormal));
+				denormal += 0.5f;
+				std::memcpy(&ret, &denormal, sizeof(ret));
+				ret -= 0x3F000000u;
+			}
+			else
+			{
+				// Rebias the exponent and round the 13 dropped bits, ties to the even mantissa.
+				ret = (bits + 0xC8000FFFu + ((bits >> 13) & 1u)) >> 13;
+			}
+
+			return static_cast<uint16>(ret | (sign >> 16));
+		}
+
+		[[nodiscard]] NO_ODR float HalfToFloat(uint16 half) noexcept
+		{
+			const auto shifted = (static_cast<uint32>(half) & 0x7FFFu) << 13;
+			const auto exponent = shifted & 0x0F800000u;
+			auto bits = shifted + 0x38000000u;
+
+			if (exponent == 0x0F800000u)
+			{
+				bits += 0x38000000u;
+			}
+			else if (exponent == 0)
+			{
+				// Renormalize denormals by subtracting the implicit one of the smallest normal.
+				bits += 0x00800000u;
+				float normal;
+				std::memcpy(&normal, &bits, sizeof(normal));
+				normal -= 6.103515625e-05f;
+				std::memcpy(&bits, &normal, sizeof(bits));
+			}
+
+			bits |= (static_cast<uint32>(half) & 0x8000u) << 16;
+
+			float ret;
+			std::memcpy(&ret, &bits, sizeof(ret));
+			return ret;
+		}
+
+		// Bit fields packed into the low ByteNum bytes of a little endian word. Loads assemble
+		// the word byte by byte, as a partial copy into a wider word stalls store forwarding.
+		template <size_t ByteNum>
+		[[nodiscard]] NO_ODR uint64 LoadPackedBits(const uint8* data) noexcept
+		{
+			static_assert(ByteNum <= sizeof(uint64));
+
+			uint64 ret = 0;
+			for (size_t i = 0; i < ByteNum; ++i)
+				ret |= static_cast<uint64>(data[i]) << (i * 8);
+			return ret;
+		}
+
+		template <size_t ByteNum>
+		NO_ODR void StorePackedBits(uint64 bits, uint8* data) noexcept
+		{
+			static_assert(ByteNum <= sizeof(uint64));
+			std::memcpy(data, &bits, ByteNum);
+		}
+
+		// SNORM maps [-1, 1] to [-max, max] and decodes the extra negative value to -1 as well.
+		// UNORM maps [0, 1] to [0, max]. Encoding clamps and rounds to nearest even.
+		template <class T>
+		struct NormalizedLimits final
+		{
+			static_assert(std::is_same_v<T, int16> || std::is_same_v<T, uint8>, "Only SNORM16 and UNORM8 are supported.");
+
+			static constexpr float Scale = static_cast<float>(std::numeric_limits<T>::max());
+			static constexpr float Lowest = std::is_signed_v<T> ? -1.0f : 0.0f;
+		};
+
+		template <class T>
+		[[nodiscard]] NO_ODR T EncodeNormalized(float n) noexcept
+		{
+			using Limits = NormalizedLimits<T>;
+			return static_cast<T>(std::lrint(Clamp(n, Limits::Lowest, 1.0f) * Limits::Scale));
+		}
+
+		template <class T>
+		[[nodiscard]] NO_ODR float DecodeNormalized(T n) noexcept
+		{
+			using Limits = NormalizedLimits<T>;
+			return Max(static_cast<float>(n) * (1.0f / Limits::Scale), Limits::Lowest);
+		}
+	}
+
+	// IEEE 754 binary16 storage.
+	struct Half final
+	{
+	public:
+		static const Half Zero;
+		static const Half One;
+		static const Half Max;
+		static const Half Infinity;
+
+	public:
+		constexpr Half() noexcept : bits(0) {}
+
+		explicit Half(float n) noexcept : bits(Detail::FloatToHalf(n)) {}
+
+		[[nodiscard]] static constexpr Half FromBits(uint16 inBits) noexcept
+		{
+			Half ret;
+			ret.bits = inBits;
+			return ret;
+		}
+
+		operator float() const noexcept { return Detail::HalfToFloat(bits); }
+
+	public:
+		uint16 bits;
+	};
+
+	// Constants
+
+	inline const Half Half::    Zero = Half::FromBits(0x0000);
+	inline const Half Half::     One = Half::FromBits(0x3C00);
+	inline const Half Half::     Max = Half::FromBits(0x7BFF);
+	inline const Half Half::Infinity = Half::FromBits(0x7C00);
+
+	static_assert(sizeof(Half) == sizeof(uint16));
+
+	// Tightly packed half vector, 2 * L bytes without the padding lane of Vector.
+	template <size_t L>
+	struct Vector<Half, L> final
+	{
+	public:
+		constexpr Vector() noexcept : data() {}
+
+		explicit Vector(const Vector<float, L>& vec) noexcept
+		{
+			for (size_t i = 0; i < L; ++i)
+				data[i] = Half{ vec[i] };
+		}
+
+		[[nodiscard]] Vector<float, L> ToVector() const noexcept
+		{
+			Vector<float, L> ret;
+			for (size_t i = 0; i < L; ++i)
+				ret[i] = data[i];
+			return ret;
+		}
+
+		[[nodiscard]] constexpr Half& operator[](size_t idx) noexcept { return data[idx]; }
+		[[nodiscard]] constexpr Half operator[](size_t idx) const noexcept { return data[idx]; }
+
+	public:
+		Half data[L];
+	};
+
+	static_assert(sizeof(HalfVector3) == sizeof(Half) * 3);
+
+	// Fixed point vector of T, which is int16 for SNORM16 or uint8 for UNORM8.
+	template <class T, size_t L>
+	struct NormalizedVector final
+	{
+	public:
+		constexpr NormalizedVector() noexcept : data() {}
+
+		explicit NormalizedVector(const Vector<float, L>& vec) noexcept
+		{
+			for (size_t i = 0; i < L; ++i)
+				data[i] = Detail::EncodeNormalized<T>(vec[i]);
+		}
+
+		[[nodiscard]] Vector<float, L> ToVector() const noexcept
+		{
+			Vector<float, L> ret;
+			for (size_t i = 0; i < L; ++i)
+				ret[i] = Detail::DecodeNormalized(data[i]);
+			return ret;
+		}
+
+		[[nodiscard]] constexpr T& operator[](size_t idx) noexcept { return data[idx]; }
+		[[nodiscard]] constexpr T operator[](size_t idx) const noexcept { return data[idx]; }
+
+	public:
+		T data[L];
+	};
+
+	using SNorm16Vector2 = NormalizedVector<int16, 2>;
+	using SNorm16Vector3 = NormalizedVector<int16, 3>;
+	using SNorm16Vector4 = NormalizedVector<int16, 4>;
+	using UNorm8Vector2 = NormalizedVector<uint8, 2>;
+	using UNorm8Vector3 = NormalizedVector<uint8, 3>;
+	using UNorm8Vector4 = NormalizedVector<uint8, 4>;
+
+	static_assert(sizeof(UNorm8Vector4) == sizeof(uint32));
+
+	// Global Operators
+
+	template <size_t L>
+	[[nodiscard]] NO_ODR bool operator==(const Vector<Half, L>& lhs, const Vector<Half, L>& rhs) noexcept
+	{
+		return std::equal(lhs.data, lhs.data + L, rhs.data, [](Half l, Half r) { return l.bits == r.bits; });
+	}
+
+	template <size_t L>
+	[[nodiscard]] NO_ODR bool operator!=(const Vector<Half, L>& lhs, const Vector<Half, L>& rhs) noexcept { return !(lhs == rhs); }
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR bool operator==(const NormalizedVector<T, L>& lhs, const NormalizedVector<T, L>& rhs) noexcept
+	{
+		return std::equal(lhs.data, lhs.data + L, rhs.data);
+	}
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR bool operator!=(const NormalizedVector<T, L>& lhs, const NormalizedVector<T, L>& rhs) noexcept { return !(lhs == rhs); }
+
+	// Batch Functions
+
+	namespace Detail
+	{
+		// Same arithmetic as FloatToHalf on each lane. The halves come out sign extended,
+		// so a signed saturating pack keeps them exact.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorFloatToHalf(SIMD::VectorRegister<float> vec) noexcept
+		{
+			using namespace SIMD;
+			auto bits = VectorCastInt(vec);
+			const auto sign = VectorAnd(bits, VectorLoad1(static_cast<int>(0x80000000u)));
+			bits = VectorXor(bits, sign);
+
+			const auto nan = VectorGreaterThan(bits, VectorLoad1(0x7F800000));
+			const auto special = VectorSelect(VectorLoad1(0x7E00), VectorLoad1(0x7C00), nan);
+
+			const auto denormalFloat = VectorAdd(VectorCastFloat(bits), VectorLoad1(0.5f));
+			const auto denormal = VectorSubtract(VectorCastInt(denormalFloat), VectorLoad1(0x3F000000));
+
+			const auto odd = VectorAnd(VectorShiftRight<13>(bits), VectorLoad1(1));
+			const auto rounded = VectorAdd(VectorAdd(bits, VectorLoad1(static_cast<int>(0xC8000FFFu))), odd);
+			const auto normal = VectorShiftRight<13>(rounded);
+
+			auto ret = VectorSelect(denormal, normal, VectorLessThan(bits, VectorLoad1(0x38800000)));
+			ret = VectorSelect(special, ret, VectorGreaterThan(bits, VectorLoad1(0x477FFFFF)));
+			return VectorOr(ret, VectorShiftRightArithmetic<16>(sign));
+		}
+
+		// Same arithmetic as HalfToFloat on the low word of each lane.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorHalfToFloat(SIMD::VectorRegister<int> vec) noexcept
+		{
+			using namespace SIMD;
+			const auto shifted = VectorShiftLeft<13>(VectorAnd(vec, VectorLoad1(0x7FFF)));
+			const auto exponent = VectorAnd(shifted, VectorLoad1(0x0F800000));
+			auto bits = VectorAdd(shifted, VectorLoad1(0x38000000));
+
+			const auto special = VectorEqual(exponent, VectorLoad1(0x0F800000));
+			bits = VectorAdd(bits, VectorAnd(special, VectorLoad1(0x38000000)));
+
+			const auto denormalFloat = VectorCastFloat(VectorAdd(bits, VectorLoad1(0x00800000)));
+			const auto denormal = VectorCastInt(VectorSubtract(denormalFloat, VectorLoad1(6.103515625e-05f)));
+			bits = VectorSelect(denormal, bits, VectorEqual(exponent, VectorLoad1(0)));
+
+			const auto sign = VectorShiftLeft<16>(VectorAnd(vec, VectorLoad1(0x8000)));
+			return VectorCastFloat(VectorOr(bits, sign));
+		}
+
+		// Converts four floats to and from the components packed in the low bytes of a register.
+		struct HalfCodec final
+		{
+			using Type = Half;
+
+			[[nodiscard]] static SIMD::VectorRegister<int> VECTOR_CALL Encode(SIMD::VectorRegister<float> vec) noexcept
+			{
+				using namespace SIMD;
+#if defined(HAS_F16C)
+				// F16C keeps NaN payloads, so NaNs are replaced with the quiet NaN FloatToHalf returns.
+				const auto halves = VectorConvertHalf(vec);
+				const auto nan = VectorCastInt(VectorNotEqual(vec, vec));
+				const auto quietNaN = VectorOr(VectorAnd(halves, VectorLoad16(static_cast<int16>(0x8000))), VectorLoad16(0x7E00));
+				return VectorSelect(quietNaN, halves, VectorPack32(nan, nan));
+#else
+				const auto halves = VectorFloatToHalf(vec);
+				return VectorPack32(halves, halves);
+#endif
+			}
+
+			[[nodiscard]] static SIMD::VectorRegister<float> VECTOR_CALL Decode(SIMD::VectorRegister<int> vec) noexcept
+			{
+				using namespace SIMD;
+#if defined(HAS_F16C)
+				return VectorConvertHalfFloat(vec);
+#else
+				return VectorHalfToFloat(VectorInterleaveLow16(vec, vec));
+#endif
+			}
+		};
+
+		template <class T>
+		struct NormalizedCodec final
+		{
+			using Type = T;
+			using Limits = NormalizedLimits<T>;
+
+			[[nodiscard]] static SIMD::VectorRegister<int> VECTOR_CALL Encode(SIMD::VectorRegister<float> vec) noexcept
+			{
+				using namespace SIMD;
+				const auto clamped = VectorMin(VectorMax(vec, VectorLoad1(Limits::Lowest)), VectorLoad1(1.0f));
+				const auto ints = VectorRoundInt(VectorMultiply(clamped, VectorLoad1(Limits::Scale)));
+				const auto words = VectorPack32(ints, ints);
+
+				if constexpr (std::is_signed_v<T>)
+					return words;
+				else
+					return VectorPackU16(words, words);
+			}
+
+			[[nodiscard]] static SIMD::VectorRegister<float> VECTOR_CALL Decode(SIMD::VectorRegister<int> vec) noexcept
+			{
+				using namespace SIMD;
+				VectorRegister<int> ints;
+				if constexpr (std::is_signed_v<T>)
+					ints = VectorShiftRightArithmetic<16>(VectorInterleaveLow16(vec, vec));
+				else
+					ints = VectorInterleaveLow16(VectorUnpackLowU8(vec), VectorLoad1(0));
+
+				const auto ret = VectorMultiply(VectorConvertFloat(ints), VectorLoad1(1.0f / Limits::Scale));
+				if constexpr (std::is_signed_v<T>)
+					return VectorMax(ret, VectorLoad1(Limits::Lowest));
+				else
+					return ret;
+			}
+		};
+
+		template <class T>
+		[[nodiscard]] SIMD::VectorRegister<int> LoadComponents(const T* ptr) noexcept
+		{
+			using namespace SIMD;
+			if constexpr (sizeof(T) == 2)
+				return VectorLoadPtrLow(reinterpret_cast<const int*>(ptr));
+			else
+			{
+				int bits;
+				std::memcpy(&bits, ptr, sizeof(bits));
+				return VectorLoad(bits);
+			}
+		}
+
+		template <class T>
+		void VECTOR_CALL StoreComponents(SIMD::VectorRegister<int> vec, T* ptr) noexcept
+		{
+			using namespace SIMD;
+			if constexpr (sizeof(T) == 2)
+				VectorStorePtrLow(vec, reinterpret_cast<int*>(ptr));
+			else
+			{
+				const auto bits = VectorStore1(vec);
+				std::memcpy(ptr, &bits, sizeof(bits));
+			}
+		}
+
+		// Gathers the components of four vectors into L registers, dropping the padding lanes.
+		template <size_t L>
+		void LoadVectors(const Vector<float, L>* vectors, SIMD::VectorRegister<float>(&out)[L]) noexcept
+		{
+			using namespace SIMD;
+			const auto v0 = VectorLoadPtr(vectors[0].data), v1 = VectorLoadPtr(vectors[1].data);
+			const auto v2 = VectorLoadPtr(vectors[2].data), v3 = VectorLoadPtr(vectors[3].data);
+
+			if constexpr (L == 2)
+			{
+				out[0] = VectorShuffle0101(v0, v1);
+				out[1] = VectorShuffle0101(v2, v3);
+			}
+			else if constexpr (L == 3)
+			{
+				out[0] = VectorShuffle<Swizzle::X, Swizzle::Y, Swizzle::Z, Swizzle::X>(v0, VectorShuffle<Swizzle::X, Swizzle::X, Swizzle::Z, Swizzle::Z>(v1, v0));
+				out[1] = VectorShuffle<Swizzle::Y, Swizzle::Z, Swizzle::X, Swizzle::Y>(v1, v2);
+				out[2] = VectorShuffle<Swizzle::X, Swizzle::Z, Swizzle::Y, Swizzle::Z>(VectorShuffle<Swizzle::Z, Swizzle::Z, Swizzle::X, Swizzle::X>(v2, v3), v3);
+			}
+			else
+			{
+				out[0] = v0; out[1] = v1; out[2] = v2; out[3] = v3;
+			}
+		}
+
+		// Inverse of LoadVectors. The padding lanes are zeroed like a constructed Vector.
+		template <size_t L>
+		void StoreVectors(const SIMD::VectorRegister<float>(&vec)[L], Vector<float, L>* out) noexcept
+		{
+			using namespace SIMD;
+			if constexpr (L == 2)
+			{
+				const auto zero = Zero<float>;
+				VectorStorePtr(VectorShuffle0101(vec[0], zero), out[0].data);
+				VectorStorePtr(VectorShuffle2323(vec[0], zero), out[1].data);
+				VectorStorePtr(VectorShuffle0101(vec[1], zero), out[2].data);
+				VectorStorePtr(VectorShuffle2323(vec[1], zero), out[3].data);
+			}
+			else if constexpr (L == 3)
+			{
+				const auto mask = VectorCastFloat(VectorLoad(-1, -1, -1, 0));
+				const auto v1 = VectorShuffle<Swizzle::X, Swizzle::Z, Swizzle::Y, Swizzle::Y>(VectorShuffle<Swizzle::W, Swizzle::W, Swizzle::X, Swizzle::X>(vec[0], vec[1]), vec[1]);
+				VectorStorePtr(VectorAnd(vec[0], mask), out[0].data);
+				VectorStorePtr(VectorAnd(v1, mask), out[1].data);
+				VectorStorePtr(VectorAnd(VectorShuffle<Swizzle::Z, Swizzle::W, Swizzle::X, Swizzle::X>(vec[1], vec[2]), mask), out[2].data);
+				VectorStorePtr(VectorAnd(VectorSwizzle<Swizzle::Y, Swizzle::Z, Swizzle::W, Swizzle::W>(vec[2]), mask), out[3].data);
+			}
+			else
+			{
+				for (size_t i = 0; i < 4; ++i)
+					VectorStorePtr(vec[i], out[i].data);
+			}
+		}
+
+		template <class Codec>
+		void EncodeComponents(const float* values, size_t size, typename Codec::Type* out) noexcept
+		{
+			ForEachBlock(values, size, out, [](const float* src, typename Codec::Type* dst)
+			{
+				StoreComponents(Codec::Encode(SIMD::VectorLoadPtrUnaligned(src)), dst);
+			});
+		}
+
+		template <class Codec>
+		void DecodeComponents(const typename Codec::Type* values, size_t size, float* out) noexcept
+		{
+			ForEachBlock(values, size, out, [](const typename Codec::Type* src, float* dst)
+			{
+				SIMD::VectorStorePtrUnaligned(Codec::Decode(LoadComponents(src)), dst);
+			});
+		}
+
+		template <class Codec, size_t L>
+		void EncodeVectors(const Vector<float, L>* vectors, size_t size, typename Codec::Type* out) noexcept
+		{
+			using namespace SIMD;
+			const auto encode = [](const Vector<float, L>* src, typename Codec::Type* dst)
+			{
+				VectorRegister<float> components[L];
+				LoadVectors(src, components);
+				for (size_t i = 0; i < L; ++i)
+					StoreComponents(Codec::Encode(components[i]), dst + i * 4);
+			};
+
+			ForEachBlock<1, L>(vectors, size, out, encode);
+		}
+
+		template <class Codec, size_t L>
+		void DecodeVectors(const typename Codec::Type* values, size_t size, Vector<float, L>* out) noexcept
+		{
+			using namespace SIMD;
+			const auto decode = [](const typename Codec::Type* src, Vector<float, L>* dst)
+			{
+				VectorRegister<float> components[L];
+				for (size_t i = 0; i < L; ++i)
+					components[i] = Codec::Decode(LoadComponents(src + i * 4));
+				StoreVectors(components, dst);
+			};
+
+			ForEachBlock<L, 1>(values, size, out, decode);
+		}
+
+		// Splits the packed words of four elements into their low and high halves, one lane each.
+		template <class T>
+		void LoadPackedBlock(const T* packed, SIMD::VectorRegister<int>& low, SIMD::VectorRegister<int>& high) noexcept
+		{
+			int lows[4], highs[4];
+			for (size_t i = 0; i < 4; ++i)
+			{
+				const auto bits = LoadPackedBits<T::ByteNum>(packed[i].data);
+				lows[i] = static_cast<int>(static_cast<uint32>(bits));
+				highs[i] = static_cast<int>(static_cast<uint32>(bits >> 32));
+			}
+
+			low = SIMD::VectorLoad(lows);
+			high = SIMD::VectorLoad(highs);
+		}
+
+		template <class T>
+		void StorePackedBlock(SIMD::VectorRegister<int> low, SIMD::VectorRegister<int> high, T* packed) noexcept
+		{
+			int lows[4], highs[4];
+			SIMD::VectorStore(low, lows);
+			SIMD::VectorStore(high, highs);
+			for (size_t i = 0; i < 4; ++i)
+			{
+				const auto bits = static_cast<uint64>(static_cast<uint32>(lows[i])) | (static_cast<uint64>(static_cast<uint32>(highs[i])) << 32);
+				StorePackedBits<T::ByteNum>(bits, packed[i].data);
+			}
+		}
+
+		// Adds a field to the low and high words of packed bits.
+		template <int Offset, int Width>
+		void VECTOR_CALL AddField(SIMD::VectorRegister<int> field, SIMD::VectorRegister<int>& low, SIMD::VectorRegister<int>& high) noexcept
+		{
+			using namespace SIMD;
+			if constexpr (Offset >= 32)
+				high = VectorOr(high, VectorShiftLeft<Offset - 32>(field));
+			else
+			{
+				low = VectorOr(low, VectorShiftLeft<Offset>(field));
+				if constexpr (Offset + Width > 32)
+					high = VectorOr(high, VectorShiftRight<32 - Offset>(field));
+			}
+		}
+
+		template <int Offset, int Width>
+		[[nodiscard]] SIMD::VectorRegister<int> VECTOR_CALL GetField(SIMD::VectorRegister<int> low, SIMD::VectorRegister<int> high) noexcept
+		{
+			using namespace SIMD;
+			const auto mask = VectorLoad1(static_cast<int>((1u << Width) - 1));
+			if constexpr (Offset >= 32)
+				return VectorAnd(VectorShiftRight<Offset - 32>(high), mask);
+			else if constexpr (Offset + Width <= 32)
+				return VectorAnd(VectorShiftRight<Offset>(low), mask);
+			else
+				return VectorAnd(VectorOr(VectorShiftRight<Offset>(low), VectorShiftLeft<32 - Offset>(high)), mask);
+		}
+	}
+
+	NO_ODR void ConvertToHalf(const float* values, size_t size, Half* out) noexcept
+	{
+		Detail::EncodeComponents<Detail::HalfCodec>(values, size, out);
+	}
+
+	NO_ODR void ConvertFromHalf(const Half* values, size_t size, float* out) noexcept
+	{
+		Detail::DecodeComponents<Detail::HalfCodec>(values, size, out);
+	}
+
+	template <size_t L>
+	void ConvertToHalf(const Vector<float, L>* vectors, size_t size, Vector<Half, L>* out) noexcept
+	{
+		Detail::EncodeVectors<Detail::HalfCodec>(vectors, size, reinterpret_cast<Half*>(out));
+	}
+
+	template <size_t L>
+	void ConvertFromHalf(const Vector<Half, L>* vectors, size_t size, Vector<float, L>* out) noexcept
+	{
+		Detail::DecodeVectors<Detail::HalfCodec>(reinterpret_cast<const Half*>(vectors), size, out);
+	}
+
+	template <class T>
+	void ConvertToNormalized(const float* values, size_t size, T* out) noexcept
+	{
+		Detail::EncodeComponents<Detail::NormalizedCodec<T>>(values, size, out);
+	}
+
+	template <class T>
+	void ConvertFromNormalized(const T* values, size_t size, float* out) noexcept
+	{
+		Detail::DecodeComponents<Detail::NormalizedCodec<T>>(values, size, out);
+	}
+
+	template <class T, size_t L>
+	void ConvertToNormalized(const Vector<float, L>* vectors, size_t size, NormalizedVector<T, L>* out) noexcept
+	{
+		Detail::EncodeVectors<Detail::NormalizedCodec<T>>(vectors, size, reinterpret_cast<T*>(out));
+	}
+
+	template <class T, size_t L>
+	void ConvertFromNormalized(const NormalizedVector<T, L>* vectors, size_t size, Vector<float, L>* out) noexcept
+	{
+		Detail::DecodeVectors<Detail::NormalizedCodec<T>>(reinterpret_cast<const T*>(vectors), size, out);
+	}
+}
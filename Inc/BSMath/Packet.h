@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Vector.h"
+
+namespace BSMath
+{
+	// Structure of arrays view. data[i] points to the stream of the i-th component.
+	template <class T, size_t L>
+	struct VectorSoA final
+	{
+	public:
+		constexpr VectorSoA() noexcept : data() {}
+
+		template <class... Ptrs>
+		explicit constexpr VectorSoA(T* x, Ptrs... ptrs) noexcept
+			: data{ x, ptrs... }
+		{
+			static_assert(sizeof...(Ptrs) + 1 == L, "The number of arguments is not correct");
+		}
+
+		template <class U, std::enable_if_t<std::is_convertible_v<U*, T*>, int> = 0>
+		constexpr VectorSoA(const VectorSoA<U, L>& other) noexcept : data()
+		{
+			for (size_t i = 0; i < L; ++i)
+				data[i] = other.data[i];
+		}
+
+		[[nodiscard]] Vector<std::remove_const_t<T>, L> Get(size_t idx) const noexcept
+		{
+			Vector<std::remove_const_t<T>, L> ret;
+			for (size_t i = 0; i < L; ++i)
+				ret[i] = data[i][idx];
+			return ret;
+		}
+
+		void Set(size_t idx, const Vector<T, L>& vec) const noexcept
+		{
+			for (size_t i = 0; i < L; ++i)
+				data[i][idx] = vec[i];
+		}
+
+		[[nodiscard]] constexpr T* operator[](size_t idx) const noexcept { return data[idx]; }
+
+	public:
+		T* data[L];
+	};
+
+	using Vector2SoA = VectorSoA<float, 2>;
+	using Vector3SoA = VectorSoA<float, 3>;
+	using Vector4SoA = VectorSoA<float, 4>;
+
+	// Four vectors transposed into registers. data[i] holds the i-th component of every lane.
+	template <class T, size_t L>
+	struct VectorPacket final
+	{
+	public:
+		using Register = SIMD::VectorRegister<T>;
+		constexpr static size_t Width = 4;
+
+	public:
+		VectorPacket() noexcept = default;
+
+		explicit VectorPacket(const Vector<T, L>& vec) noexcept
+		{
+			for (size_t i = 0; i < L; ++i)
+				data[i] = SIMD::VectorLoad1(vec[i]);
+		}
+
+		explicit VectorPacket(const Vector<T, L>* vecs, size_t size = Width) noexcept
+		{
+			alignas(16) T comps[L][Width]{};
+			for (size_t lane = 0; lane < size; ++lane)
+				for (size_t i = 0; i < L; ++i)
+					comps[i][lane] = vecs[lane][i];
+
+			for (size_t i = 0; i < L; ++i)
+				data[i] = SIMD::VectorLoadPtr(comps[i]);
+		}
+
+		template <class U>
+		[[nodiscard]] static VectorPacket Load(const VectorSoA<U, L>& soa, size_t idx) noexcept
+		{
+			VectorPacket ret;
+			for (size_t i = 0; i < L; ++i)
+				ret.data[i] = SIMD::VectorLoadPtrUnaligned(soa.data[i] + idx);
+			return ret;
+		}
+
+		template <class U>
+		[[nodiscard]] static VectorPacket Load(const VectorSoA<U, L>& soa, size_t idx, size_t size) noexcept
+		{
+			VectorPacket ret;
+			for (size_t i = 0; i < L; ++i)
+				ret.data[i] = SIMD::VectorLoadPtr(soa.data[i] + idx, size);
+			return ret;
+		}
+
+		void Store(const VectorSoA<T, L>& soa, size_t idx) const noexcept
+		{
+			for (size_t i = 0; i < L; ++i)
+				SIMD::VectorStorePtrUnaligned(data[i], soa.data[i] + idx);
+		}
+
+		void Store(const VectorSoA<T, L>& soa, size_t idx, size_t size) const noexcept
+		{
+			for (size_t i = 0; i < L; ++i)
+				SIMD::VectorStorePtr(data[i], soa.data[i] + idx, size);
+		}
+
+		[[nodiscard]] Vector<T, L> Get(size_t lane) const noexcept
+		{
+			Vector<T, L> ret;
+			for (size_t i = 0; i < L; ++i)
+			{
+				alignas(16) T comps[Width];
+				SIMD::VectorStorePtr(data[i], comps);
+				ret[i] = comps[lane];
+			}
+			return ret;
+		}
+
+		[[nodiscard]] constexpr Register& operator[](size_t idx) noexcept { return data[idx]; }
+		[[nodiscard]] constexpr Register operator[](size_t idx) const noexcept { return data[idx]; }
+
+	public:
+		Register data[L];
+	};
+
+	using Vector2Packet = VectorPacket<float, 2>;
+	using Vector3Packet = VectorPacket<float, 3>;
+	using Vector4Packet = VectorPacket<float, 4>;
+
+	// Global Operators
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR VectorPacket<T, L> operator+(const VectorPacket<T, L>& lhs, const VectorPacket<T, L>& rhs) noexcept
+	{
+		VectorPacket<T, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret.data[i] = SIMD::VectorAdd(lhs.data[i], rhs.data[i]);
+		return ret;
+	}
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR VectorPacket<T, L> operator-(const VectorPacket<T, L>& lhs, const VectorPacket<T, L>& rhs) noexcept
+	{
+		VectorPacket<T, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret.data[i] = SIMD::VectorSubtract(lhs.data[i], rhs.data[i]);
+		return ret;
+	}
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR VectorPacket<T, L> operator*(const VectorPacket<T, L>& lhs, const VectorPacket<T, L>& rhs) noexcept
+	{
+		VectorPacket<T, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret.data[i] = SIMD::VectorMultiply(lhs.data[i], rhs.data[i]);
+		return ret;
+	}
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR VectorPacket<T, L> operator*(const VectorPacket<T, L>& packet, SIMD::VectorRegister<T> scaler) noexcept
+	{
+		VectorPacket<T, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret.data[i] = SIMD::VectorMultiply(packet.data[i], scaler);
+		return ret;
+	}
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR SIMD::VectorRegister<T> operator|(const VectorPacket<T, L>& lhs, const VectorPacket<T, L>& rhs) noexcept
+	{
+		using namespace SIMD;
+		auto ret = VectorMultiply(lhs.data[0], rhs.data[0]);
+		for (size_t i = 1; i < L; ++i)
+			ret = VectorMultiplyAdd(lhs.data[i], rhs.data[i], ret);
+		return ret;
+	}
+
+	template <class T>
+	[[nodiscard]] NO_ODR VectorPacket<T, 3> operator^(const VectorPacket<T, 3>& lhs, const VectorPacket<T, 3>& rhs) noexcept
+	{
+		using namespace SIMD;
+		VectorPacket<T, 3> ret;
+		ret.data[0] = VectorSubtract(VectorMultiply(lhs.data[1], rhs.data[2]), VectorMultiply(lhs.data[2], rhs.data[1]));
+		ret.data[1] = VectorSubtract(VectorMultiply(lhs.data[2], rhs.data[0]), VectorMultiply(lhs.data[0], rhs.data[2]));
+		ret.data[2] = VectorSubtract(VectorMultiply(lhs.data[0], rhs.data[1]), VectorMultiply(lhs.data[1], rhs.data[0]));
+		return ret;
+	}
+
+	// Global Functions
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR VectorPacket<T, L> Min(const VectorPacket<T, L>& lhs, const VectorPacket<T, L>& rhs) noexcept
+	{
+		VectorPacket<T, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret.data[i] = SIMD::VectorMin(lhs.data[i], rhs.data[i]);
+		return ret;
+	}
+
+	template <class T, size_t L>
+	[[nodiscard]] NO_ODR VectorPacket<T, L> Max(const VectorPacket<T, L>& lhs, const VectorPacket<T, L>& rhs) noexcept
+	{
+		VectorPacket<T, L> ret;
+		for (size_t i = 0; i < L; ++i)
+			ret.data[i] = SIMD::VectorMax(lhs.data[i], rhs.data[i]);
+		return ret;
+	}
+}
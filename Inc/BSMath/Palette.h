@@ -0,0 +1,430 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "Color.h"
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Colors split into (r, b) and (0, g) word pairs, so two VectorMultiplyAddPairs16 of their
+		// differences sum to the squared RGB distance. Alpha is left out.
+		[[nodiscard]] NO_ODR int32 RedBluePair(const Color& color) noexcept
+		{
+			return static_cast<int32>((color.DWColor() >> 8) & 0x00FF00FFu);
+		}
+
+		[[nodiscard]] NO_ODR int32 GreenPair(const Color& color) noexcept
+		{
+			return static_cast<int32>(color.DWColor() & 0x00FF0000u);
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorSquaredDistance(SIMD::VectorRegister<int> lhsRB,
+			SIMD::VectorRegister<int> lhsG, SIMD::VectorRegister<int> rhsRB, SIMD::VectorRegister<int> rhsG) noexcept
+		{
+			using namespace SIMD;
+			const auto diffRB = VectorSubtract16(lhsRB, rhsRB);
+			const auto diffG = VectorSubtract16(lhsG, rhsG);
+			return VectorAdd(VectorMultiplyAddPairs16(diffRB, diffRB), VectorMultiplyAddPairs16(diffG, diffG));
+		}
+
+		// Thresholds of the 8x8 Bayer matrix in 1/64 steps.
+		constexpr uint8 BayerMatrix[8][8]
+		{
+			{  0, 32,  8, 40,  2, 34, 10, 42 },
+			{ 48, 16, 56, 24, 50, 18, 58, 26 },
+			{ 12, 44,  4, 36, 14, 46,  6, 38 },
+			{ 60, 28, 52, 20, 62, 30, 54, 22 },
+			{  3, 35, 11, 43,  1, 33,  9, 41 },
+			{ 51, 19, 59, 27, 49, 17, 57, 25 },
+			{ 15, 47,  7, 39, 13, 45,  5, 37 },
+			{ 63, 31, 55, 23, 61, 29, 53, 21 }
+		};
+
+		[[nodiscard]] NO_ODR uint8 ClampByte(int32 n) noexcept
+		{
+			return static_cast<uint8>(Clamp(n, 0, 255));
+		}
+	}
+
+	// Up to 256 colors that pixels are mapped to by index, nearest in RGB with alpha ignored.
+	// Entries are mirrored as word pairs for the search, which compares four pixels against one entry
+	// per step when mapping spans and one pixel against four entries for single lookups.
+	// Ties go to the lowest index.
+	class Palette final
+	{
+	public:
+		constexpr static size_t MaxSize = 256;
+
+		// The cache maps 5 bits per channel.
+		constexpr static size_t CacheBits = 5;
+
+	public:
+		Palette() = default;
+
+		Palette(const Color* pixels, size_t size, size_t maxColorNum, size_t iterationNum = 0)
+		{
+			Build(pixels, size, maxColorNum, iterationNum);
+		}
+
+		// Median cut of the pixels into at most maxColorNum boxes, always splitting the box with the widest
+		// channel at its median, followed by iterationNum rounds of k-means refinement.
+		// Entries are the rounded means of their pixels, alpha included.
+		// Ref: Heckbert, "Color Image Quantization for Frame Buffer Display"
+		void Build(const Color* pixels, size_t size, size_t maxColorNum, size_t iterationNum = 0);
+
+		// Takes the first MaxSize colors as they are.
+		void SetColors(const Color* inColors, size_t size);
+
+		// Precomputes the nearest entry of every cache cell center. Lookups then cost one load
+		// but may be off by up to half a cell per channel.
+		void EnableCache();
+		void DisableCache() noexcept { cache.clear(); cache.shrink_to_fit(); }
+
+		// The palette must not be empty.
+		[[nodiscard]] uint8 FindNearest(const Color& color) const noexcept;
+
+		// The Map functions leave out untouched when the palette is empty, as no index is valid.
+		void Map(const Color* pixels, size_t size, uint8* out) const noexcept;
+
+		// Adds an 8x8 Bayer threshold of up to half spread levels per channel before mapping.
+		void MapOrdered(const Color* pixels, size_t width, size_t height, uint8* out, int32 spread = 32) const;
+
+		// Floyd-Steinberg error diffusion in serpentine order.
+		void MapDiffused(const Color* pixels, size_t width, size_t height, uint8* out) const;
+
+		[[nodiscard]] const std::vector<Color>& GetColors() const noexcept { return colors; }
+		[[nodiscard]] size_t GetSize() const noexcept { return colors.size(); }
+		[[nodiscard]] bool IsCacheEnabled() const noexcept { return !cache.empty(); }
+
+		[[nodiscard]] const Color& operator[](size_t i) const noexcept { return colors[i]; }
+
+	private:
+		[[nodiscard]] SIMD::VectorRegister<int> VECTOR_CALL Search(SIMD::VectorRegister<int> pixels) const noexcept;
+		[[nodiscard]] uint8 Search(const Color& color) const noexcept;
+		void SearchSpan(const Color* pixels, size_t size, uint8* out) const noexcept;
+
+		[[nodiscard]] static size_t GetCacheIndex(const Color& color) noexcept
+		{
+			constexpr size_t Shift = 8 - CacheBits;
+			return (static_cast<size_t>(color.r >> Shift) << (CacheBits * 2)) | (static_cast<size_t>(color.g >> Shift) << CacheBits) | (color.b >> Shift);
+		}
+
+		void UpdateEntries();
+
+	private:
+		std::vector<Color> colors;
+		std::vector<int32> redBlues;
+		std::vector<int32> greens;
+		std::vector<uint8> cache;
+	};
+
+	NO_ODR void Palette::Build(const Color* pixels, size_t size, size_t maxColorNum, size_t iterationNum)
+	{
+		struct Box final
+		{
+			size_t first;
+			size_t count;
+			int32 extent;
+			uint8 channel;
+		};
+
+		std::vector<Color> work{ pixels, pixels + size };
+		const auto channelOf = [](const Color& color, uint8 channel) { return (&color.a)[channel]; };
+
+		const auto makeBox = [&](size_t first, size_t count)
+		{
+			uint8 mins[4]{ 255, 255, 255, 255 }, maxs[4]{};
+			for (size_t i = first; i < first + count; ++i)
+			{
+				for (uint8 channel = 1; channel < 4; ++channel)
+				{
+					mins[channel] = Min(mins[channel], channelOf(work[i], channel));
+					maxs[channel] = Max(maxs[channel], channelOf(work[i], channel));
+				}
+			}
+
+			Box box{ first, count, -1, 1 };
+			for (uint8 channel = 1; channel < 4; ++channel)
+			{
+				const int32 extent = maxs[channel] - mins[channel];
+				if (extent > box.extent)
+				{
+					box.extent = extent;
+					box.channel = channel;
+				}
+			}
+
+			return box;
+		};
+
+		maxColorNum = Min(maxColorNum, MaxSize);
+		std::vector<Box> boxes;
+		if (size > 0 && maxColorNum > 0)
+			boxes.push_back(makeBox(0, size));
+
+		while (!boxes.empty() && boxes.size() < maxColorNum)
+		{
+			const auto widest = std::max_element(boxes.cbegin(), boxes.cend(), [](const Box& lhs, const Box& rhs)
+			{
+				return lhs.extent < rhs.extent || (lhs.extent == rhs.extent && lhs.count < rhs.count);
+			});
+
+			if (widest->extent <= 0) break;
+
+			// Splits at the median level, so no level straddles two boxes.
+			const Box box = *widest;
+			const auto begin = work.begin() + box.first, end = begin + box.count;
+			const auto level = [&](const Color& color) { return channelOf(color, box.channel); };
+			std::nth_element(begin, begin + box.count / 2, end, [&](const Color& lhs, const Color& rhs) { return level(lhs) < level(rhs); });
+
+			const uint8 median = level(begin[box.count / 2]);
+			auto mid = std::partition(begin, end, [&](const Color& color) { return level(color) < median; });
+			if (mid == begin)
+				mid = std::partition(begin, end, [&](const Color& color) { return level(color) <= median; });
+
+			const auto half = static_cast<size_t>(mid - begin);
+			boxes[widest - boxes.cbegin()] = makeBox(box.first, half);
+			boxes.push_back(makeBox(box.first + half, box.count - half));
+		}
+
+		std::vector<Color> means;
+		means.reserve(boxes.size());
+		for (const auto& box : boxes)
+		{
+			uint64 sums[4]{};
+			for (size_t i = box.first; i < box.first + box.count; ++i)
+				for (uint8 channel = 0; channel < 4; ++channel)
+					sums[channel] += channelOf(work[i], channel);
+
+			const auto mean = [&](uint8 channel) { return static_cast<uint8>((sums[channel] + box.count / 2) / box.count); };
+			means.push_back(Color{ mean(1), mean(2), mean(3), mean(0) });
+		}
+
+		colors = std::move(means);
+		UpdateEntries();
+
+		// Lloyd's iterations on the entries. Entries left without pixels keep their color.
+		std::vector<uint8> indices(size);
+		std::vector<uint64> sums(colors.size() * 4);
+		std::vector<uint64> counts(colors.size());
+		for (size_t iter = 0; iter < iterationNum && !colors.empty(); ++iter)
+		{
+			SearchSpan(pixels, size, indices.data());
+			std::fill(sums.begin(), sums.end(), 0);
+			std::fill(counts.begin(), counts.end(), 0);
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				++counts[indices[i]];
+				for (uint8 channel = 0; channel < 4; ++channel)
+					sums[indices[i] * 4 + channel] += channelOf(pixels[i], channel);
+			}
+
+			for (size_t i = 0; i < colors.size(); ++i)
+			{
+				if (counts[i] == 0) continue;
+
+				const auto mean = [&](uint8 channel) { return static_cast<uint8>((sums[i * 4 + channel] + counts[i] / 2) / counts[i]); };
+				colors[i] = Color{ mean(1), mean(2), mean(3), mean(0) };
+			}
+
+			UpdateEntries();
+		}
+
+		if (IsCacheEnabled())
+			EnableCache();
+	}
+
+	NO_ODR void Palette::SetColors(const Color* inColors, size_t size)
+	{
+		colors.assign(inColors, inColors + Min(size, MaxSize));
+		UpdateEntries();
+
+		if (IsCacheEnabled())
+			EnableCache();
+	}
+
+	NO_ODR void Palette::UpdateEntries()
+	{
+		// Padded to whole registers with copies of the first entry, which never win a tie against it.
+		const size_t paddedSize = (colors.size() + 3) & ~size_t{ 3 };
+		redBlues.resize(paddedSize);
+		greens.resize(paddedSize);
+
+		for (size_t i = 0; i < paddedSize; ++i)
+		{
+			const auto& color = colors[i < colors.size() ? i : 0];
+			redBlues[i] = Detail::RedBluePair(color);
+			greens[i] = Detail::GreenPair(color);
+		}
+	}
+
+	NO_ODR void Palette::EnableCache()
+	{
+		constexpr size_t CellNum = size_t{ 1 } << (CacheBits * 3);
+		constexpr uint8 Shift = 8 - CacheBits, Center = 1 << (Shift - 1);
+
+		std::vector<Color> centers(CellNum);
+		for (size_t i = 0; i < CellNum; ++i)
+		{
+			const auto level = [&](size_t bit) { return static_cast<uint8>((((i >> bit) & ((1 << CacheBits) - 1)) << Shift) | Center); };
+			centers[i] = Color{ level(CacheBits * 2), level(CacheBits), level(0) };
+		}
+
+		cache.resize(CellNum);
+		SearchSpan(centers.data(), CellNum, cache.data());
+	}
+
+	NO_ODR uint8 Palette::FindNearest(const Color& color) const noexcept
+	{
+		return IsCacheEnabled() ? cache[GetCacheIndex(color)] : Search(color);
+	}
+
+	NO_ODR void Palette::Map(const Color* pixels, size_t size, uint8* out) const noexcept
+	{
+		if (colors.empty()) return;
+
+		if (IsCacheEnabled())
+		{
+			for (size_t i = 0; i < size; ++i)
+				out[i] = cache[GetCacheIndex(pixels[i])];
+		}
+		else
+			SearchSpan(pixels, size, out);
+	}
+
+	NO_ODR void Palette::MapOrdered(const Color* pixels, size_t width, size_t height, uint8* out, int32 spread) const
+	{
+		if (colors.empty()) return;
+
+		int32 offsets[8][8];
+		for (size_t y = 0; y < 8; ++y)
+			for (size_t x = 0; x < 8; ++x)
+				offsets[y][x] = ((Detail::BayerMatrix[y][x] * 2 - 63) * spread) / 128;
+
+		std::vector<Color> row(width);
+		for (size_t y = 0; y < height; ++y)
+		{
+			for (size_t x = 0; x < width; ++x)
+			{
+				const auto& pixel = pixels[y * width + x];
+				const int32 offset = offsets[y & 7][x & 7];
+				row[x] = Color{ Detail::ClampByte(pixel.r + offset), Detail::ClampByte(pixel.g + offset), Detail::ClampByte(pixel.b + offset), pixel.a };
+			}
+
+			Map(row.data(), width, out + y * width);
+		}
+	}
+
+	NO_ODR void Palette::MapDiffused(const Color* pixels, size_t width, size_t height, uint8* out) const
+	{
+		if (colors.empty()) return;
+
+		// Errors in 1/16 levels of the current and the next row, with a guard pixel on both sides.
+		std::vector<int32> errors[2]{ std::vector<int32>((width + 2) * 3), std::vector<int32>((width + 2) * 3) };
+
+		for (size_t y = 0; y < height; ++y)
+		{
+			auto& current = errors[y & 1];
+			auto& next = errors[(y + 1) & 1];
+			std::fill(next.begin(), next.end(), 0);
+
+			const bool isReversed = (y & 1) != 0;
+			const ptrdiff_t step = isReversed ? -1 : 1;
+
+			for (size_t i = 0; i < width; ++i)
+			{
+				const size_t x = isReversed ? width - 1 - i : i;
+				const auto& pixel = pixels[y * width + x];
+				const int32 levels[3]{ pixel.r, pixel.g, pixel.b };
+
+				uint8 target[3];
+				for (size_t channel = 0; channel < 3; ++channel)
+					target[channel] = Detail::ClampByte(levels[channel] + ((current[(x + 1) * 3 + channel] + 8) >> 4));
+
+				const uint8 index = FindNearest(Color{ target[0], target[1], target[2], pixel.a });
+				out[y * width + x] = index;
+
+				const uint8 chosen[3]{ colors[index].r, colors[index].g, colors[index].b };
+				for (size_t channel = 0; channel < 3; ++channel)
+				{
+					const int32 error = target[channel] - chosen[channel];
+					const ptrdiff_t center = static_cast<ptrdiff_t>((x + 1) * 3 + channel);
+					current[center + step * 3] += error * 7;
+					next[center - step * 3] += error * 3;
+					next[center] += error * 5;
+					next[center + step * 3] += error;
+				}
+			}
+		}
+	}
+
+	NO_ODR SIMD::VectorRegister<int> VECTOR_CALL Palette::Search(SIMD::VectorRegister<int> pixels) const noexcept
+	{
+		using namespace SIMD;
+		const auto rb = VectorAnd(VectorShiftRight<8>(pixels), VectorLoad1(0x00FF00FF));
+		const auto g = VectorAnd(pixels, VectorLoad1(0x00FF0000));
+
+		auto best = VectorLoad1(std::numeric_limits<int32>::max());
+		auto bestIndex = VectorLoad1(0);
+		for (size_t i = 0; i < colors.size(); ++i)
+		{
+			const auto dist = Detail::VectorSquaredDistance(rb, g, VectorLoad1(redBlues[i]), VectorLoad1(greens[i]));
+			const auto isCloser = VectorLessThan(dist, best);
+			best = VectorSelect(dist, best, isCloser);
+			bestIndex = VectorSelect(VectorLoad1(static_cast<int>(i)), bestIndex, isCloser);
+		}
+
+		return bestIndex;
+	}
+
+	NO_ODR uint8 Palette::Search(const Color& color) const noexcept
+	{
+		using namespace SIMD;
+		const auto rb = VectorLoad1(Detail::RedBluePair(color));
+		const auto g = VectorLoad1(Detail::GreenPair(color));
+
+		auto best = VectorLoad1(std::numeric_limits<int32>::max());
+		auto bestIndex = VectorLoad1(0);
+		auto index = VectorLoad(0, 1, 2, 3);
+		for (size_t i = 0; i < redBlues.size(); i += 4)
+		{
+			const auto dist = Detail::VectorSquaredDistance(rb, g, VectorLoadPtrUnaligned(redBlues.data() + i), VectorLoadPtrUnaligned(greens.data() + i));
+			const auto isCloser = VectorLessThan(dist, best);
+			best = VectorSelect(dist, best, isCloser);
+			bestIndex = VectorSelect(index, bestIndex, isCloser);
+			index = VectorAdd(index, VectorLoad1(4));
+		}
+
+		alignas(16) int32 dists[4], indices[4];
+		VectorStorePtr(best, dists);
+		VectorStorePtr(bestIndex, indices);
+
+		size_t lane = 0;
+		for (size_t i = 1; i < 4; ++i)
+		{
+			if (dists[i] < dists[lane] || (dists[i] == dists[lane] && indices[i] < indices[lane]))
+				lane = i;
+		}
+
+		return static_cast<uint8>(indices[lane]);
+	}
+
+	NO_ODR void Palette::SearchSpan(const Color* pixels, size_t size, uint8* out) const noexcept
+	{
+		using namespace SIMD;
+		const auto search = [this](const Color* src, uint8* dst)
+		{
+			const auto indices = Search(VectorLoadPtrUnaligned(reinterpret_cast<const int*>(src)));
+			const auto words = VectorPack32(indices, indices);
+			const int32 bytes = VectorStore1(VectorPackU16(words, words));
+			std::memcpy(dst, &bytes, sizeof(bytes));
+		};
+
+		Detail::ForEachBlock(pixels, size, out, search);
+	}
+}
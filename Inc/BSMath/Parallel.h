@@ -0,0 +1,35 @@
+#pragma once
+
+#include <future>
+#include <thread>
+#include <vector>
+#include "Utility.h"
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Calls func(begin, count) over contiguous chunks on up to taskNum tasks, hardware_concurrency
+		// when zero, the first on the calling thread. Chunk boundaries are multiples of minChunkSize,
+		// so only the last chunk may be smaller and small inputs aren't split at all.
+		template <class Func>
+		void ParallelChunks(size_t size, size_t minChunkSize, size_t taskNum, Func&& func)
+		{
+			if (taskNum == 0)
+				taskNum = Max(std::thread::hardware_concurrency(), 1u);
+
+			const size_t minChunkNum = (size + minChunkSize - 1) / minChunkSize;
+			taskNum = Max(Min(taskNum, minChunkNum), size_t{ 1 });
+			const size_t countPerTask = (minChunkNum + taskNum - 1) / taskNum * minChunkSize;
+
+			std::vector<std::future<void>> tasks;
+			for (size_t begin = countPerTask; begin < size; begin += countPerTask)
+				tasks.emplace_back(std::async(std::launch::async, [&func, begin, count = Min(countPerTask, size - begin)] { func(begin, count); }));
+
+			func(size_t{ 0 }, Min(countPerTask, size));
+
+			for (auto& task : tasks)
+				task.get();
+		}
+	}
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Sphere.h"
+
+namespace BSMath
+{
+	enum class PlaneSide : int8
+	{
+		Back = -1, On = 0, Front = 1
+	};
+
+	// xyz is the normal and w is the distance, so that dot(normal, point) + w is the signed distance.
+	struct alignas(16) Plane final
+	{
+	public:
+		constexpr Plane() noexcept : vec(0.0f, 0.0f, 1.0f, 0.0f) {}
+
+		explicit constexpr Plane(const Vector4& inVec) noexcept : vec(inVec) {}
+
+		explicit constexpr Plane(float a, float b, float c, float d) noexcept : vec(a, b, c, d) {}
+
+		explicit constexpr Plane(const Vector3& normal, float distance) noexcept
+			: vec(normal.x, normal.y, normal.z, distance) {}
+
+		explicit Plane(const Vector3& normal, const Vector3& point) noexcept
+			: Plane(normal, -(normal | point)) {}
+
+		explicit Plane(const Vector3& a, const Vector3& b, const Vector3& c) noexcept
+			: Plane(Vector3::GetNormal((b - a) ^ (c - a)), a) {}
+
+		[[nodiscard]] Vector3 GetNormal() const noexcept { return Vector3{ vec.x, vec.y, vec.z }; }
+		[[nodiscard]] constexpr float GetDistance() const noexcept { return vec.w; }
+
+		bool Normalize() noexcept;
+
+		[[nodiscard]] float SignedDistance(const Vector3& point) const noexcept;
+		[[nodiscard]] Vector3 Project(const Vector3& point) const noexcept;
+
+		[[nodiscard]] PlaneSide Classify(const Vector3& point, float tolerance = Epsilon) const noexcept;
+		[[nodiscard]] PlaneSide Classify(const Sphere& sphere) const noexcept;
+		[[nodiscard]] PlaneSide Classify(const AABB& box) const noexcept;
+
+		[[nodiscard]] Plane operator-() const noexcept { return Plane{ -vec }; }
+
+		[[nodiscard]] constexpr float& operator[](size_t idx) noexcept { return vec[idx]; }
+		[[nodiscard]] constexpr float operator[](size_t idx) const noexcept { return vec[idx]; }
+
+	public:
+		Vector4 vec;
+	};
+
+	namespace Detail
+	{
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL NormalizePlane(SIMD::VectorRegister<float> plane) noexcept
+		{
+			using namespace SIMD;
+			const auto normal = VectorMultiply(plane, VectorLoad(1.0f, 1.0f, 1.0f, 0.0f));
+			auto size = VectorMultiply(normal, normal);
+			size = VectorHadd(size, size);
+			size = VectorHadd(size, size);
+			return VectorMultiply(plane, VectorInvSqrt(size));
+		}
+
+		[[nodiscard]] NO_ODR float VECTOR_CALL PlaneDot(SIMD::VectorRegister<float> plane, SIMD::VectorRegister<float> point) noexcept
+		{
+			using namespace SIMD;
+			auto dist = VectorMultiply(plane, point);
+			dist = VectorHadd(dist, dist);
+			dist = VectorHadd(dist, dist);
+			return VectorStore1(dist);
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL LoadPoint(const Vector3& point) noexcept
+		{
+			return SIMD::VectorLoad(point.x, point.y, point.z, 1.0f);
+		}
+	}
+
+	NO_ODR bool Plane::Normalize() noexcept
+	{
+		if (IsNearlyZero(GetNormal().LengthSquared())) return false;
+
+		SIMD::VectorStore(Detail::NormalizePlane(SIMD::VectorLoad(vec.data)), vec.data);
+		return true;
+	}
+
+	NO_ODR float Plane::SignedDistance(const Vector3& point) const noexcept
+	{
+		return Detail::PlaneDot(SIMD::VectorLoad(vec.data), Detail::LoadPoint(point));
+	}
+
+	NO_ODR Vector3 Plane::Project(const Vector3& point) const noexcept
+	{
+		return point - GetNormal() * SignedDistance(point);
+	}
+
+	NO_ODR PlaneSide Plane::Classify(const Vector3& point, float tolerance) const noexcept
+	{
+		const float dist = SignedDistance(point);
+		return dist > tolerance ? PlaneSide::Front : (dist < -tolerance ? PlaneSide::Back : PlaneSide::On);
+	}
+
+	NO_ODR PlaneSide Plane::Classify(const Sphere& sphere) const noexcept
+	{
+		return Classify(sphere.GetCenter(), sphere.GetRadius());
+	}
+
+	NO_ODR PlaneSide Plane::Classify(const AABB& box) const noexcept
+	{
+		using namespace SIMD;
+		const float radius = Detail::PlaneDot(VectorAbs(VectorLoad(vec.data)), VectorLoad(box.GetExtent().data));
+		return Classify(box.GetCenter(), radius);
+	}
+
+	// Global Operators
+
+	[[nodiscard]] NO_ODR bool operator==(const Plane& lhs, const Plane& rhs) noexcept { return lhs.vec == rhs.vec; }
+	[[nodiscard]] NO_ODR bool operator!=(const Plane& lhs, const Plane& rhs) noexcept { return !(lhs == rhs); }
+
+	// Batch Functions
+
+	NO_ODR void SignedDistances(const Plane& plane, const VectorSoA<const float, 3>& points,
+		size_t size, float* outDistances) noexcept
+	{
+		using namespace SIMD;
+		const Vector4Packet packet{ plane.vec };
+
+		const auto getDistance = [&](const Vector3Packet& point)
+		{
+			auto dist = VectorMultiplyAdd(point[0], packet[0], packet[3]);
+			dist = VectorMultiplyAdd(point[1], packet[1], dist);
+			return VectorMultiplyAdd(point[2], packet[2], dist);
+		};
+
+		size_t idx = 0;
+		for (; idx + Vector3Packet::Width <= size; idx += Vector3Packet::Width)
+			VectorStorePtrUnaligned(getDistance(Vector3Packet::Load(points, idx)), outDistances + idx);
+
+		if (idx < size)
+			VectorStorePtr(getDistance(Vector3Packet::Load(points, idx, size - idx)), outDistances + idx, size - idx);
+	}
+
+	// Writes an outcode per point whose i-th bit is set when the point is behind planes[i].
+	// A point is inside the convex volume when its code is 0, and a polygon whose codes
+	// share a bit is entirely outside. planeNum must not exceed 32.
+	NO_ODR void ClassifyPoints(const Plane* planes, size_t planeNum, const VectorSoA<const float, 3>& points,
+		size_t size, uint32* outCodes) noexcept
+	{
+		using namespace SIMD;
+
+		const auto getCode = [&](const Vector3Packet& point)
+		{
+			auto code = Zero<int>;
+			for (size_t i = 0; i < planeNum; ++i)
+			{
+				const Vector4Packet plane{ planes[i].vec };
+				auto dist = VectorMultiplyAdd(point[0], plane[0], plane[3]);
+				dist = VectorMultiplyAdd(point[1], plane[1], dist);
+				dist = VectorMultiplyAdd(point[2], plane[2], dist);
+
+				const auto behind = VectorCastInt(VectorLessThan(dist, Zero<float>));
+				code = VectorOr(code, VectorAnd(behind, VectorLoad1(static_cast<int>(1u << i))));
+			}
+			return code;
+		};
+
+		auto* codes = reinterpret_cast<int*>(outCodes);
+
+		size_t idx = 0;
+		for (; idx + Vector3Packet::Width <= size; idx += Vector3Packet::Width)
+			VectorStorePtrUnaligned(getCode(Vector3Packet::Load(points, idx)), codes + idx);
+
+		if (idx < size)
+			VectorStorePtr(getCode(Vector3Packet::Load(points, idx, size - idx)), codes + idx, size - idx);
+	}
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+#include "AABB.h"
+#include "PackedVector.h"
+
+// Positions quantized to ComponentBits per axis on a uniform grid, for transform streams.
+// A point inside the grid decodes within half a step of itself on each axis, and frames
+// can be delta coded against the previous one so that small moves give small codes.
+namespace BSMath
+{
+	// Levels packed into the low bytes of a little endian word: x at bit 0, then y and z.
+	// 10, 16 and 21 bits fill 32, 48 and 64 bit budgets.
+	template <size_t ComponentBits>
+	struct QuantizedVector3 final
+	{
+	public:
+		static_assert(ComponentBits >= 1 && ComponentBits <= 21, "Components take 1 to 21 bits.");
+
+		static constexpr size_t ByteNum = (ComponentBits * 3 + 7) / 8;
+		static constexpr int MaxLevel = (1 << ComponentBits) - 1;
+
+	public:
+		constexpr QuantizedVector3() noexcept : data() {}
+
+		// Levels are wrapped to ComponentBits.
+		explicit QuantizedVector3(const IntVector3& levels) noexcept
+		{
+			uint64 bits = 0;
+			for (size_t i = 0; i < 3; ++i)
+				bits |= static_cast<uint64>(levels[i] & MaxLevel) << (i * ComponentBits);
+
+			Detail::StorePackedBits<ByteNum>(bits, data);
+		}
+
+		[[nodiscard]] IntVector3 GetLevels() const noexcept
+		{
+			const auto bits = Detail::LoadPackedBits<ByteNum>(data);
+
+			IntVector3 ret;
+			for (size_t i = 0; i < 3; ++i)
+				ret[i] = static_cast<int>(bits >> (i * ComponentBits)) & MaxLevel;
+			return ret;
+		}
+
+	public:
+		uint8 data[ByteNum];
+	};
+
+	using QuantizedVector32 = QuantizedVector3<10>;
+	using QuantizedVector48 = QuantizedVector3<16>;
+	using QuantizedVector64 = QuantizedVector3<21>;
+
+	// Level n of an axis lies at origin + n * step. Points are clamped to the levels,
+	// so those outside the grid lose the error bound.
+	struct alignas(16) QuantizationGrid final
+	{
+	public:
+		constexpr QuantizationGrid() noexcept : origin(), step() {}
+
+		explicit constexpr QuantizationGrid(const Vector3& inOrigin, const Vector3& inStep) noexcept
+			: origin(inOrigin), step(inStep) {}
+
+		// Spreads the levels of ComponentBits over the bounds, both ends included.
+		explicit QuantizationGrid(const AABB& bounds, size_t componentBits) noexcept
+			: origin(bounds.min), step(bounds.GetSize() / static_cast<float>((1 << componentBits) - 1)) {}
+
+		// Zero for flat axes, which always quantize to level 0.
+		[[nodiscard]] Vector3 GetInverseStep() const noexcept;
+
+		[[nodiscard]] Vector3 GetMaxError() const noexcept { return step * 0.5f; }
+
+		template <size_t ComponentBits>
+		[[nodiscard]] QuantizedVector3<ComponentBits> Quantize(const Vector3& vec) const noexcept;
+
+		template <size_t ComponentBits>
+		[[nodiscard]] Vector3 Dequantize(const QuantizedVector3<ComponentBits>& quantized) const noexcept;
+
+		// Batch versions. Quantize matches the above bit for bit, while Dequantize may round
+		// differently where the compiler fuses its multiply and add into an FMA.
+		template <size_t ComponentBits>
+		void Quantize(const Vector3* vecs, size_t size, QuantizedVector3<ComponentBits>* out) const noexcept;
+
+		template <size_t ComponentBits>
+		void Dequantize(const QuantizedVector3<ComponentBits>* quantized, size_t size, Vector3* out) const noexcept;
+
+	public:
+		Vector3 origin;
+		Vector3 step;
+	};
+
+	NO_ODR Vector3 QuantizationGrid::GetInverseStep() const noexcept
+	{
+		Vector3 ret;
+		for (size_t i = 0; i < 3; ++i)
+			ret[i] = step[i] > 0.0f ? 1.0f / step[i] : 0.0f;
+		return ret;
+	}
+
+	template <size_t ComponentBits>
+	NO_ODR QuantizedVector3<ComponentBits> QuantizationGrid::Quantize(const Vector3& vec) const noexcept
+	{
+		constexpr auto MaxLevel = static_cast<float>(QuantizedVector3<ComponentBits>::MaxLevel);
+		const auto scaled = (vec - origin) * GetInverseStep();
+
+		IntVector3 levels;
+		for (size_t i = 0; i < 3; ++i)
+			levels[i] = static_cast<int>(std::lrint(Min(Max(scaled[i], 0.0f), MaxLevel)));
+		return QuantizedVector3<ComponentBits>{ levels };
+	}
+
+	template <size_t ComponentBits>
+	NO_ODR Vector3 QuantizationGrid::Dequantize(const QuantizedVector3<ComponentBits>& quantized) const noexcept
+	{
+		const auto levels = quantized.GetLevels();
+		const Vector3 vec{ static_cast<float>(levels.x), static_cast<float>(levels.y), static_cast<float>(levels.z) };
+		return vec * step + origin;
+	}
+
+	// Global Operators
+
+	template <size_t ComponentBits>
+	[[nodiscard]] NO_ODR bool operator==(const QuantizedVector3<ComponentBits>& lhs, const QuantizedVector3<ComponentBits>& rhs) noexcept
+	{
+		return std::memcmp(lhs.data, rhs.data, QuantizedVector3<ComponentBits>::ByteNum) == 0;
+	}
+
+	template <size_t ComponentBits>
+	[[nodiscard]] NO_ODR bool operator!=(const QuantizedVector3<ComponentBits>& lhs, const QuantizedVector3<ComponentBits>& rhs) noexcept { return !(lhs == rhs); }
+
+	// Batch Functions
+
+	namespace Detail
+	{
+		template <size_t ComponentBits>
+		void LoadLevels(const QuantizedVector3<ComponentBits>* quantized, SIMD::VectorRegister<int>(&levels)[3]) noexcept
+		{
+			constexpr auto Bits = static_cast<int>(ComponentBits);
+
+			SIMD::VectorRegister<int> low, high;
+			LoadPackedBlock(quantized, low, high);
+			levels[0] = GetField<0, Bits>(low, high);
+			levels[1] = GetField<Bits, Bits>(low, high);
+			levels[2] = GetField<Bits * 2, Bits>(low, high);
+		}
+
+		template <size_t ComponentBits>
+		void StoreLevels(const SIMD::VectorRegister<int>(&levels)[3], QuantizedVector3<ComponentBits>* out) noexcept
+		{
+			constexpr auto Bits = static_cast<int>(ComponentBits);
+
+			auto low = SIMD::VectorLoad1(0), high = SIMD::VectorLoad1(0);
+			AddField<0, Bits>(levels[0], low, high);
+			AddField<Bits, Bits>(levels[1], low, high);
+			AddField<Bits * 2, Bits>(levels[2], low, high);
+			StorePackedBlock(low, high, out);
+		}
+
+		// The grid is passed in SoA form, one register per axis.
+		template <size_t ComponentBits>
+		void QuantizeVectors(const Vector3* vecs, const SIMD::VectorRegister<float>(&origin)[3],
+			const SIMD::VectorRegister<float>(&inverseStep)[3], QuantizedVector3<ComponentBits>* out) noexcept
+		{
+			using namespace SIMD;
+			const auto maxLevel = VectorLoad1(static_cast<float>(QuantizedVector3<ComponentBits>::MaxLevel));
+
+			VectorRegister<float> lanes[4]{ VectorLoadPtr(vecs[0].data), VectorLoadPtr(vecs[1].data), VectorLoadPtr(vecs[2].data), VectorLoadPtr(vecs[3].data) };
+			VectorTranspose(lanes);
+
+			VectorRegister<int> levels[3];
+			for (size_t i = 0; i < 3; ++i)
+			{
+				const auto scaled = VectorMultiply(VectorSubtract(lanes[i], origin[i]), inverseStep[i]);
+				levels[i] = VectorRoundInt(VectorMin(VectorMax(scaled, VectorLoad1(0.0f)), maxLevel));
+			}
+
+			StoreLevels(levels, out);
+		}
+
+		template <size_t ComponentBits>
+		void DequantizeVectors(const QuantizedVector3<ComponentBits>* quantized, const SIMD::VectorRegister<float>(&origin)[3],
+			const SIMD::VectorRegister<float>(&step)[3], Vector3* out) noexcept
+		{
+			using namespace SIMD;
+
+			VectorRegister<int> levels[3];
+			LoadLevels(quantized, levels);
+
+			VectorRegister<float> lanes[4];
+			for (size_t i = 0; i < 3; ++i)
+				lanes[i] = VectorAdd(VectorMultiply(VectorConvertFloat(levels[i]), step[i]), origin[i]);
+			lanes[3] = VectorLoad1(0.0f);
+			VectorTranspose(lanes);
+
+			for (size_t i = 0; i < 4; ++i)
+				VectorStorePtr(lanes[i], out[i].data);
+		}
+
+		// Differences wrap around the level range and are zigzag coded, so moves of n levels
+		// either way give codes of at most 2n.
+		template <size_t ComponentBits>
+		void EncodeDeltas(const QuantizedVector3<ComponentBits>* current, const QuantizedVector3<ComponentBits>* previous, QuantizedVector3<ComponentBits>* out) noexcept
+		{
+			using namespace SIMD;
+			const auto mask = VectorLoad1(QuantizedVector3<ComponentBits>::MaxLevel);
+
+			VectorRegister<int> levels[3], previousLevels[3];
+			LoadLevels(current, levels);
+			LoadLevels(previous, previousLevels);
+
+			for (size_t i = 0; i < 3; ++i)
+			{
+				const auto delta = VectorAnd(VectorSubtract(levels[i], previousLevels[i]), mask);
+				const auto sign = VectorSubtract(VectorLoad1(0), VectorShiftRight<static_cast<int>(ComponentBits) - 1>(delta));
+				levels[i] = VectorAnd(VectorXor(VectorShiftLeft<1>(delta), sign), mask);
+			}
+
+			StoreLevels(levels, out);
+		}
+
+		template <size_t ComponentBits>
+		void DecodeDeltas(const QuantizedVector3<ComponentBits>* deltas, const QuantizedVector3<ComponentBits>* previous, QuantizedVector3<ComponentBits>* out) noexcept
+		{
+			using namespace SIMD;
+			const auto mask = VectorLoad1(QuantizedVector3<ComponentBits>::MaxLevel);
+
+			VectorRegister<int> levels[3], previousLevels[3];
+			LoadLevels(deltas, levels);
+			LoadLevels(previous, previousLevels);
+
+			for (size_t i = 0; i < 3; ++i)
+			{
+				const auto sign = VectorSubtract(VectorLoad1(0), VectorAnd(levels[i], VectorLoad1(1)));
+				const auto delta = VectorXor(VectorShiftRight<1>(levels[i]), sign);
+				levels[i] = VectorAnd(VectorAdd(previousLevels[i], delta), mask);
+			}
+
+			StoreLevels(levels, out);
+		}
+
+		NO_ODR void ReplicateComponents(const Vector3& vec, SIMD::VectorRegister<float>(&out)[3]) noexcept
+		{
+			for (size_t i = 0; i < 3; ++i)
+				out[i] = SIMD::VectorLoad1(vec[i]);
+		}
+	}
+
+	template <size_t ComponentBits>
+	NO_ODR void QuantizationGrid::Quantize(const Vector3* vecs, size_t size, QuantizedVector3<ComponentBits>* out) const noexcept
+	{
+		SIMD::VectorRegister<float> originComponents[3], inverseStepComponents[3];
+		Detail::ReplicateComponents(origin, originComponents);
+		Detail::ReplicateComponents(GetInverseStep(), inverseStepComponents);
+
+		Detail::ForEachBlock(vecs, size, out, [&](const Vector3* block, QuantizedVector3<ComponentBits>* outBlock)
+		{
+			Detail::QuantizeVectors(block, originComponents, inverseStepComponents, outBlock);
+		});
+	}
+
+	template <size_t ComponentBits>
+	NO_ODR void QuantizationGrid::Dequantize(const QuantizedVector3<ComponentBits>* quantized, size_t size, Vector3* out) const noexcept
+	{
+		SIMD::VectorRegister<float> originComponents[3], stepComponents[3];
+		Detail::ReplicateComponents(origin, originComponents);
+		Detail::ReplicateComponents(step, stepComponents);
+
+		Detail::ForEachBlock(quantized, size, out, [&](const QuantizedVector3<ComponentBits>* block, Vector3* outBlock)
+		{
+			Detail::DequantizeVectors(block, originComponents, stepComponents, outBlock);
+		});
+	}
+
+	// Codes each frame against the previous one. Decoding against the same previous frame
+	// restores the current one exactly.
+	template <size_t ComponentBits>
+	void EncodeDelta(const QuantizedVector3<ComponentBits>* current, const QuantizedVector3<ComponentBits>* previous, size_t size, QuantizedVector3<ComponentBits>* out) noexcept
+	{
+		Detail::ForEachBlock(current, previous, size, out, Detail::EncodeDeltas<ComponentBits>);
+	}
+
+	template <size_t ComponentBits>
+	void DecodeDelta(const QuantizedVector3<ComponentBits>* deltas, const QuantizedVector3<ComponentBits>* previous, size_t size, QuantizedVector3<ComponentBits>* out) noexcept
+	{
+		Detail::ForEachBlock(deltas, previous, size, out, Detail::DecodeDeltas<ComponentBits>);
+	}
+}
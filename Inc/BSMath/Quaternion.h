@@ -42,28 +42,33 @@ namespace BSMath
 
 	inline const Quaternion Quaternion::Identity{};
 
-	NO_ODR Quaternion& Quaternion::operator*=(const Quaternion& other) noexcept
+	namespace Detail
 	{
-		using namespace SIMD;
-		
-		const static auto SignMask0 = VectorLoad( 1.f, -1.f,  1.f, -1.f);
-		const static auto SignMask1 = VectorLoad( 1.f,  1.f, -1.f, -1.f);
-		const static auto SignMask2 = VectorLoad(-1.f,  1.f,  1.f, -1.f);
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorQuaternionMultiply(SIMD::VectorRegister<float> lhs, SIMD::VectorRegister<float> rhs) noexcept
+		{
+			using namespace SIMD;
 
-		const auto lhs = VectorLoadPtr(&x);
-		const auto rhs = VectorLoadPtr(&other.x);
-		auto result = VectorMultiply(VectorReplicate<Swizzle::W>(lhs), rhs);
+			const auto SignMask0 = VectorLoad( 1.f, -1.f,  1.f, -1.f);
+			const auto SignMask1 = VectorLoad( 1.f,  1.f, -1.f, -1.f);
+			const auto SignMask2 = VectorLoad(-1.f,  1.f,  1.f, -1.f);
 
-		auto tmp = VectorMultiply(VectorReplicate<Swizzle::X>(lhs), VectorSwizzle<Swizzle::W, Swizzle::Z, Swizzle::Y, Swizzle::X>(rhs));
-		result = VectorAdd(VectorMultiply(tmp, SignMask0), result);
+			auto result = VectorMultiply(VectorReplicate<Swizzle::W>(lhs), rhs);
 
-		tmp = VectorMultiply(VectorReplicate<Swizzle::Y>(lhs), VectorSwizzle<Swizzle::Z, Swizzle::W, Swizzle::X, Swizzle::Y>(rhs));
-		result = VectorAdd(VectorMultiply(tmp, SignMask1), result);
+			auto tmp = VectorMultiply(VectorReplicate<Swizzle::X>(lhs), VectorSwizzle<Swizzle::W, Swizzle::Z, Swizzle::Y, Swizzle::X>(rhs));
+			result = VectorAdd(VectorMultiply(tmp, SignMask0), result);
 
-		tmp = VectorMultiply(VectorReplicate<Swizzle::Z>(lhs), VectorSwizzle<Swizzle::Y, Swizzle::X, Swizzle::W, Swizzle::Z>(rhs));
-		result = VectorAdd(VectorMultiply(tmp, SignMask2), result);
+			tmp = VectorMultiply(VectorReplicate<Swizzle::Y>(lhs), VectorSwizzle<Swizzle::Z, Swizzle::W, Swizzle::X, Swizzle::Y>(rhs));
+			result = VectorAdd(VectorMultiply(tmp, SignMask1), result);
+
+			tmp = VectorMultiply(VectorReplicate<Swizzle::Z>(lhs), VectorSwizzle<Swizzle::Y, Swizzle::X, Swizzle::W, Swizzle::Z>(rhs));
+			return VectorAdd(VectorMultiply(tmp, SignMask2), result);
+		}
+	}
 
-		VectorStorePtr(result, &x);
+	NO_ODR Quaternion& Quaternion::operator*=(const Quaternion& other) noexcept
+	{
+		using namespace SIMD;
+		VectorStorePtr(Detail::VectorQuaternionMultiply(VectorLoadPtr(&x), VectorLoadPtr(&other.x)), &x);
 		return *this;
 	}
 
@@ -161,4 +166,14 @@ namespace BSMath
 		VectorStorePtr(result, &ret.x);
 		return ret;
 	}
+
+	// Quaternion's Hash
+	template <>
+	struct Hash<Quaternion> final : public FloatHashRange<Quaternion, 4> {};
+
+	template <>
+	struct QuantizedHash<Quaternion> final : public QuantizedHashRange<Quaternion, 4>
+	{
+		using QuantizedHashRange::QuantizedHashRange;
+	};
 }
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Color.h"
+#include "Rotator.h"
+#include "Sampling.h"
+
+// Free functions drawing from a generator owned by the calling thread.
+// The generator is seeded on its first use in each thread, so these are safe to call from any job
+// without constructing or sharing a Random.
+namespace BSMath::Rand
+{
+	[[nodiscard]] NO_ODR DefaultRandomEngine& GetEngine()
+	{
+		thread_local DefaultRandomEngine engine{ static_cast<DefaultRandomEngine::result_type>(Detail::NextSeed()) };
+		return engine;
+	}
+
+	// Restarts the generator of the calling thread for reproducible results.
+	NO_ODR void SetSeed(uint32 seed)
+	{
+		GetEngine().seed(seed);
+	}
+
+	[[nodiscard]] NO_ODR float Float(float min = 0.0f, float max = 1.0f)
+	{
+		return std::uniform_real_distribution<float>{ min, max }(GetEngine());
+	}
+
+	[[nodiscard]] NO_ODR int Int(int min, int max)
+	{
+		return std::uniform_int_distribution<int>{ min, max }(GetEngine());
+	}
+
+	[[nodiscard]] NO_ODR bool Bool()
+	{
+		return (GetEngine()() & 1u) != 0u;
+	}
+
+	[[nodiscard]] NO_ODR BSMath::Vector2 Vector2(float min = 0.0f, float max = 1.0f)
+	{
+		return VectorDistribution<float, 2>{}(GetEngine(), VectorDistribution<float, 2>::param_type{ min, max });
+	}
+
+	[[nodiscard]] NO_ODR BSMath::Vector3 Vector3(float min = 0.0f, float max = 1.0f)
+	{
+		return VectorDistribution<float, 3>{}(GetEngine(), VectorDistribution<float, 3>::param_type{ min, max });
+	}
+
+	[[nodiscard]] NO_ODR BSMath::Vector4 Vector4(float min = 0.0f, float max = 1.0f)
+	{
+		return VectorDistribution<float, 4>{}(GetEngine(), VectorDistribution<float, 4>::param_type{ min, max });
+	}
+
+	[[nodiscard]] NO_ODR BSMath::Vector3 UnitVector3()
+	{
+		return UnitSphereDistribution{}(GetEngine());
+	}
+
+	[[nodiscard]] NO_ODR BSMath::Quaternion Quaternion()
+	{
+		return QuaternionDistribution{}(GetEngine());
+	}
+
+	[[nodiscard]] NO_ODR BSMath::Rotator Rotator()
+	{
+		return RotatorDistribution{}(GetEngine());
+	}
+
+	[[nodiscard]] NO_ODR BSMath::Color Color()
+	{
+		return ColorDistribution{}(GetEngine());
+	}
+
+	// Bulk version of Float.
+	NO_ODR void Fill(float* out, size_t size, float min = 0.0f, float max = 1.0f)
+	{
+		GetEngine().FillUniform(out, size, min, max);
+	}
+}
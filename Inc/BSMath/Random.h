@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <random>
+#include "Parallel.h"
 
 namespace BSMath
 {
@@ -19,6 +22,531 @@ namespace BSMath
 		public:
 			constexpr static bool value = decltype(Test<Distributor>(0))::value;
 		};
+
+		template <class Distributor, class Engine, class T, class = void>
+		struct HasFill : std::false_type {};
+
+		template <class Distributor, class Engine, class T>
+		struct HasFill<Distributor, Engine, T, std::void_t<decltype(std::declval<Distributor&>().Fill(
+			std::declval<Engine&>(), std::declval<T*>(), size_t{}))>> : std::true_type {};
+
+		template <class Engine, class = void>
+		struct IsVectorEngine : std::false_type {};
+
+		template <class Engine>
+		struct IsVectorEngine<Engine, std::void_t<decltype(std::declval<Engine&>().FillUniform(
+			std::declval<float*>(), size_t{}, 0.0f, 1.0f))>> : std::true_type {};
+
+		template <class Distributor>
+		struct IsUniformDistribution : std::false_type {};
+
+		template <>
+		struct IsUniformDistribution<std::uniform_int_distribution<int>> : std::true_type {};
+
+		template <>
+		struct IsUniformDistribution<std::uniform_real_distribution<float>> : std::true_type {};
+
+		// Ref: https://prng.di.unimi.it/splitmix64.c
+		[[nodiscard]] NO_ODR uint64 SplitMix64(uint64& state) noexcept
+		{
+			uint64 ret = (state += 0x9E3779B97F4A7C15ull);
+			ret = (ret ^ (ret >> 30)) * 0xBF58476D1CE4E5B9ull;
+			ret = (ret ^ (ret >> 27)) * 0x94D049BB133111EBull;
+			return ret ^ (ret >> 31);
+		}
+
+		// Seeds for default constructed generators. std::random_device is read once per thread,
+		// and every later seed is the next value of a per-thread SplitMix64 stream.
+		[[nodiscard]] NO_ODR uint64 NextSeed()
+		{
+			thread_local uint64 state = (static_cast<uint64>(std::random_device{}()) << 32) ^ std::random_device{}();
+			return SplitMix64(state);
+		}
+
+		template <int N>
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorRotateLeft(SIMD::VectorRegister<int> vec) noexcept
+		{
+			using namespace SIMD;
+			return VectorOr(VectorShiftLeft<N>(vec), VectorShiftRight<32 - N>(vec));
+		}
+
+		// Maps random bits to [min, max). The top 24 bits fill the mantissa exactly, and the
+		// result is clamped below max, which the multiply-add can round up to.
+		struct UniformFloatConverter final
+		{
+		public:
+			UniformFloatConverter(float min, float max) noexcept
+				: scale(SIMD::VectorLoad1((max - min) * (1.0f / 16777216.0f))), offset(SIMD::VectorLoad1(min)),
+				limit(SIMD::VectorLoad1(max > min ? std::nextafter(max, min) : min)) {}
+
+			[[nodiscard]] SIMD::VectorRegister<float> VECTOR_CALL operator()(SIMD::VectorRegister<int> bits) const noexcept
+			{
+				using namespace SIMD;
+				return VectorMin(VectorMultiplyAdd(VectorConvertFloat(VectorShiftRight<8>(bits)), scale, offset), limit);
+			}
+
+		private:
+			SIMD::VectorRegister<float> scale;
+			SIMD::VectorRegister<float> offset;
+			SIMD::VectorRegister<float> limit;
+		};
+
+		// Maps random bits to [min, max] by a multiply-shift whose bias is below (max - min) / 2^32.
+		struct UniformIntConverter final
+		{
+		public:
+			UniformIntConverter(int min, int max) noexcept
+				: range(static_cast<uint32>(max) - static_cast<uint32>(min) + 1u),
+				rangeReg(SIMD::VectorLoad1(static_cast<int>(range))), offset(SIMD::VectorLoad1(min)) {}
+
+			[[nodiscard]] SIMD::VectorRegister<int> VECTOR_CALL operator()(SIMD::VectorRegister<int> bits) const noexcept
+			{
+				using namespace SIMD;
+				return range == 0u ? bits : VectorAdd(VectorMultiplyHigh(bits, rangeReg), offset);
+			}
+
+		private:
+			uint32 range;
+			SIMD::VectorRegister<int> rangeReg;
+			SIMD::VectorRegister<int> offset;
+		};
+	}
+
+	// xoshiro128++ running LaneNum independent streams in SSE registers.
+	// It satisfies UniformRandomBitGenerator for the std distributions,
+	// and the Fill functions produce LaneNum values per step for bulk generation.
+	// Ref: Blackman, Vigna, "Scrambled Linear Pseudorandom Number Generators"
+	template <size_t LaneNum>
+	class BasicXoshiro128 final
+	{
+		static_assert(LaneNum % 4 == 0, "LaneNum must be a multiple of the register width");
+
+	public:
+		using result_type = uint32;
+		constexpr static size_t RegisterNum = LaneNum / 4;
+
+		[[nodiscard]] constexpr static result_type min() noexcept { return 0u; }
+		[[nodiscard]] constexpr static result_type max() noexcept { return 0xFFFFFFFFu; }
+
+	public:
+		explicit BasicXoshiro128(result_type inSeed = 0u) noexcept { seed(inSeed); }
+
+		void seed(result_type inSeed) noexcept;
+
+		result_type operator()() noexcept
+		{
+			if (index == LaneNum)
+			{
+				Store(buffer);
+				index = 0;
+			}
+			return buffer[index++];
+		}
+
+		void Generate(SIMD::VectorRegister<int>(&out)[RegisterNum]) noexcept;
+
+		void Fill(uint32* out, size_t size) noexcept;
+
+		void FillUniform(float* out, size_t size, float min = 0.0f, float max = 1.0f) noexcept;
+		void FillUniform(int* out, size_t size, int min, int max) noexcept;
+
+	private:
+		void Store(uint32* out) noexcept;
+
+		template <class T, class Func>
+		void FillImpl(T* out, size_t size, Func&& func) noexcept;
+
+	private:
+		SIMD::VectorRegister<int> state[4][RegisterNum];
+		alignas(16) uint32 buffer[LaneNum];
+		size_t index = LaneNum;
+	};
+
+	using Xoshiro128 = BasicXoshiro128<8>;
+
+	template <size_t LaneNum>
+	NO_ODR void BasicXoshiro128<LaneNum>::seed(result_type inSeed) noexcept
+	{
+		using namespace SIMD;
+		uint64 mixer = inSeed;
+
+		for (size_t reg = 0; reg < RegisterNum; ++reg)
+		{
+			alignas(16) int words[4][4];
+			for (size_t lane = 0; lane < 4; ++lane)
+			{
+				for (size_t word = 0; word < 4; word += 2)
+				{
+					const uint64 bits = Detail::SplitMix64(mixer);
+					words[word][lane] = static_cast<int>(static_cast<uint32>(bits));
+					words[word + 1][lane] = static_cast<int>(static_cast<uint32>(bits >> 32));
+				}
+			}
+
+			for (size_t word = 0; word < 4; ++word)
+				state[word][reg] = VectorLoadPtr(words[word]);
+		}
+
+		index = LaneNum;
+	}
+
+	template <size_t LaneNum>
+	NO_ODR void BasicXoshiro128<LaneNum>::Generate(SIMD::VectorRegister<int>(&out)[RegisterNum]) noexcept
+	{
+		using namespace SIMD;
+
+		for (size_t reg = 0; reg < RegisterNum; ++reg)
+		{
+			auto& s0 = state[0][reg];
+			auto& s1 = state[1][reg];
+			auto& s2 = state[2][reg];
+			auto& s3 = state[3][reg];
+
+			out[reg] = VectorAdd(Detail::VectorRotateLeft<7>(VectorAdd(s0, s3)), s0);
+
+			const auto t = VectorShiftLeft<9>(s1);
+			s2 = VectorXor(s2, s0);
+			s3 = VectorXor(s3, s1);
+			s1 = VectorXor(s1, s2);
+			s0 = VectorXor(s0, s3);
+			s2 = VectorXor(s2, t);
+			s3 = Detail::VectorRotateLeft<11>(s3);
+		}
+	}
+
+	template <size_t LaneNum>
+	NO_ODR void BasicXoshiro128<LaneNum>::Store(uint32* out) noexcept
+	{
+		SIMD::VectorRegister<int> regs[RegisterNum];
+		Generate(regs);
+
+		for (size_t reg = 0; reg < RegisterNum; ++reg)
+			SIMD::VectorStorePtrUnaligned(regs[reg], reinterpret_cast<int*>(out) + reg * 4);
+	}
+
+	template <size_t LaneNum>
+	template <class T, class Func>
+	NO_ODR void BasicXoshiro128<LaneNum>::FillImpl(T* out, size_t size, Func&& func) noexcept
+	{
+		using namespace SIMD;
+		VectorRegister<int> regs[RegisterNum];
+
+		size_t idx = 0;
+		for (; idx + LaneNum <= size; idx += LaneNum)
+		{
+			Generate(regs);
+			for (size_t reg = 0; reg < RegisterNum; ++reg)
+				VectorStorePtrUnaligned(func(regs[reg]), out + idx + reg * 4);
+		}
+
+		if (idx == size) return;
+
+		Generate(regs);
+		alignas(16) T remain[LaneNum];
+		for (size_t reg = 0; reg < RegisterNum; ++reg)
+			VectorStorePtr(func(regs[reg]), remain + reg * 4);
+
+		std::copy_n(remain, size - idx, out + idx);
+	}
+
+	template <size_t LaneNum>
+	NO_ODR void BasicXoshiro128<LaneNum>::Fill(uint32* out, size_t size) noexcept
+	{
+		FillImpl(reinterpret_cast<int*>(out), size, [](SIMD::VectorRegister<int> bits) { return bits; });
+	}
+
+	template <size_t LaneNum>
+	NO_ODR void BasicXoshiro128<LaneNum>::FillUniform(float* out, size_t size, float min, float max) noexcept
+	{
+		FillImpl(out, size, Detail::UniformFloatConverter{ min, max });
+	}
+
+	template <size_t LaneNum>
+	NO_ODR void BasicXoshiro128<LaneNum>::FillUniform(int* out, size_t size, int min, int max) noexcept
+	{
+		FillImpl(out, size, Detail::UniformIntConverter{ min, max });
+	}
+
+	// Counter-based generator. The value at an index of a stream is a pure function of
+	// (seed, stream, index), so any part of a stream can be produced on any thread with Seek
+	// and a split fill is bit-identical to a sequential one.
+	// Ref: Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC 2011
+	class Philox4x32 final
+	{
+	public:
+		using result_type = uint32;
+
+		// Values per counter, and counters per bulk step.
+		constexpr static size_t BlockSize = 4;
+		constexpr static size_t ChunkSize = BlockSize * 4;
+
+		[[nodiscard]] constexpr static result_type min() noexcept { return 0u; }
+		[[nodiscard]] constexpr static result_type max() noexcept { return 0xFFFFFFFFu; }
+
+	public:
+		explicit Philox4x32(uint64 inSeed = 0u, uint64 inStream = 0u) noexcept
+			: key(inSeed), stream(inStream) {}
+
+		void seed(result_type inSeed) noexcept
+		{
+			key = inSeed;
+			Seek(0u);
+		}
+
+		void SetStream(uint64 inStream) noexcept
+		{
+			stream = inStream;
+			Seek(0u);
+		}
+
+		void Seek(uint64 inIndex) noexcept
+		{
+			index = inIndex;
+			bufferBlock = ~0ull;
+		}
+
+		void discard(uint64 num) noexcept { index += num; }
+
+		[[nodiscard]] uint64 Tell() const noexcept { return index; }
+		[[nodiscard]] uint64 GetStream() const noexcept { return stream; }
+
+		result_type operator()() noexcept
+		{
+			const uint64 block = index / BlockSize;
+			if (block != bufferBlock)
+			{
+				GenerateBlock(block, buffer);
+				bufferBlock = block;
+			}
+			return buffer[index++ % BlockSize];
+		}
+
+		[[nodiscard]] result_type Get(uint64 idx) const noexcept
+		{
+			uint32 block[BlockSize];
+			GenerateBlock(idx / BlockSize, block);
+			return block[idx % BlockSize];
+		}
+
+		void Fill(uint32* out, size_t size) noexcept;
+		void FillUniform(float* out, size_t size, float min = 0.0f, float max = 1.0f) noexcept;
+		void FillUniform(int* out, size_t size, int min, int max) noexcept;
+
+	private:
+		void GenerateBlock(uint64 block, uint32(&out)[BlockSize]) const noexcept;
+		void GenerateChunk(uint64 block, SIMD::VectorRegister<int>(&out)[4]) const noexcept;
+
+		template <class T, class Func>
+		void FillImpl(T* out, size_t size, Func&& func) noexcept;
+
+	private:
+		constexpr static uint32 Multiplier[2]{ 0xD2511F53u, 0xCD9E8D57u };
+		constexpr static uint32 KeyBump[2]{ 0x9E3779B9u, 0xBB67AE85u };
+		constexpr static size_t RoundNum = 10;
+
+		uint64 key;
+		uint64 stream;
+		uint64 index = 0u;
+		uint64 bufferBlock = ~0ull;
+		uint32 buffer[BlockSize]{};
+	};
+
+	NO_ODR void Philox4x32::GenerateBlock(uint64 block, uint32(&out)[BlockSize]) const noexcept
+	{
+		uint32 counter[4]
+		{
+			static_cast<uint32>(block), static_cast<uint32>(block >> 32),
+			static_cast<uint32>(stream), static_cast<uint32>(stream >> 32)
+		};
+
+		uint32 k0 = static_cast<uint32>(key), k1 = static_cast<uint32>(key >> 32);
+		for (size_t round = 0; round < RoundNum; ++round)
+		{
+			const uint64 p0 = static_cast<uint64>(Multiplier[0]) * counter[0];
+			const uint64 p1 = static_cast<uint64>(Multiplier[1]) * counter[2];
+
+			counter[0] = static_cast<uint32>(p1 >> 32) ^ counter[1] ^ k0;
+			counter[1] = static_cast<uint32>(p1);
+			counter[2] = static_cast<uint32>(p0 >> 32) ^ counter[3] ^ k1;
+			counter[3] = static_cast<uint32>(p0);
+
+			k0 += KeyBump[0];
+			k1 += KeyBump[1];
+		}
+
+		std::copy_n(counter, BlockSize, out);
+	}
+
+	NO_ODR void Philox4x32::GenerateChunk(uint64 block, SIMD::VectorRegister<int>(&out)[4]) const noexcept
+	{
+		using namespace SIMD;
+
+		// Each register holds one counter word of four consecutive blocks.
+		const auto low = [block](uint64 i) { return static_cast<int>(static_cast<uint32>(block + i)); };
+		const auto high = [block](uint64 i) { return static_cast<int>(static_cast<uint32>((block + i) >> 32)); };
+
+		auto& c = out;
+		c[0] = VectorLoad(low(0), low(1), low(2), low(3));
+		c[1] = VectorLoad(high(0), high(1), high(2), high(3));
+		c[2] = VectorLoad1(static_cast<int>(static_cast<uint32>(stream)));
+		c[3] = VectorLoad1(static_cast<int>(static_cast<uint32>(stream >> 32)));
+
+		const auto m0 = VectorLoad1(static_cast<int>(Multiplier[0]));
+		const auto m1 = VectorLoad1(static_cast<int>(Multiplier[1]));
+
+		uint32 k0 = static_cast<uint32>(key), k1 = static_cast<uint32>(key >> 32);
+		for (size_t round = 0; round < RoundNum; ++round)
+		{
+			const auto hi0 = VectorMultiplyHigh(c[0], m0);
+			const auto lo0 = VectorMultiply(c[0], m0);
+			const auto hi1 = VectorMultiplyHigh(c[2], m1);
+			const auto lo1 = VectorMultiply(c[2], m1);
+
+			c[0] = VectorXor(VectorXor(hi1, c[1]), VectorLoad1(static_cast<int>(k0)));
+			c[1] = lo1;
+			c[2] = VectorXor(VectorXor(hi0, c[3]), VectorLoad1(static_cast<int>(k1)));
+			c[3] = lo0;
+
+			k0 += KeyBump[0];
+			k1 += KeyBump[1];
+		}
+
+		// Back to the value order, one block per register.
+		VectorTranspose(c);
+	}
+
+	template <class T, class Func>
+	NO_ODR void Philox4x32::FillImpl(T* out, size_t size, Func&& func) noexcept
+	{
+		using namespace SIMD;
+		VectorRegister<int> chunk[4];
+		alignas(16) T remain[ChunkSize];
+
+		uint64 block = index / ChunkSize * 4;
+		size_t skip = static_cast<size_t>(index % ChunkSize);
+		index += size;
+
+		while (size > 0)
+		{
+			GenerateChunk(block, chunk);
+			block += 4;
+
+			if (skip == 0 && size >= ChunkSize)
+			{
+				for (size_t i = 0; i < 4; ++i)
+					VectorStorePtrUnaligned(func(chunk[i]), out + i * 4);
+
+				out += ChunkSize;
+				size -= ChunkSize;
+				continue;
+			}
+
+			for (size_t i = 0; i < 4; ++i)
+				VectorStorePtr(func(chunk[i]), remain + i * 4);
+
+			const size_t num = Min(ChunkSize - skip, size);
+			std::copy_n(remain + skip, num, out);
+
+			out += num;
+			size -= num;
+			skip = 0;
+		}
+	}
+
+	NO_ODR void Philox4x32::Fill(uint32* out, size_t size) noexcept
+	{
+		FillImpl(reinterpret_cast<int*>(out), size, [](SIMD::VectorRegister<int> bits) { return bits; });
+	}
+
+	NO_ODR void Philox4x32::FillUniform(float* out, size_t size, float min, float max) noexcept
+	{
+		FillImpl(out, size, Detail::UniformFloatConverter{ min, max });
+	}
+
+	NO_ODR void Philox4x32::FillUniform(int* out, size_t size, int min, int max) noexcept
+	{
+		FillImpl(out, size, Detail::UniformIntConverter{ min, max });
+	}
+
+	// PCG-XSH-RR with 64 bit state. The whole engine is 16 bytes, for short-lived generators
+	// where the state and seeding cost of the SIMD engines does not pay off.
+	// Ref: O'Neill, "PCG: A Family of Simple Fast Space-Efficient Statistically Good Algorithms for Random Number Generation"
+	class Pcg32 final
+	{
+	public:
+		using result_type = uint32;
+
+		[[nodiscard]] constexpr static result_type min() noexcept { return 0u; }
+		[[nodiscard]] constexpr static result_type max() noexcept { return 0xFFFFFFFFu; }
+
+	public:
+		explicit Pcg32(uint64 inSeed = 0u, uint64 inStream = 0u) noexcept { seed(inSeed, inStream); }
+
+		void seed(uint64 inSeed, uint64 inStream = 0u) noexcept
+		{
+			state = 0u;
+			increment = (inStream << 1) | 1u;
+			(*this)();
+			state += inSeed;
+			(*this)();
+		}
+
+		result_type operator()() noexcept
+		{
+			const uint64 old = state;
+			state = old * Multiplier + increment;
+
+			const uint32 xorShifted = static_cast<uint32>(((old >> 18) ^ old) >> 27);
+			const uint32 rotation = static_cast<uint32>(old >> 59);
+			return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+		}
+
+		// Jumps ahead in O(log num) by squaring the LCG step.
+		// Ref: Brown, "Random Number Generation with Arbitrary Stride"
+		void discard(uint64 num) noexcept
+		{
+			uint64 multiplier = Multiplier, addend = increment;
+			uint64 accMultiplier = 1u, accAddend = 0u;
+
+			for (; num > 0; num >>= 1)
+			{
+				if (num & 1u)
+				{
+					accMultiplier *= multiplier;
+					accAddend = accAddend * multiplier + addend;
+				}
+
+				addend *= multiplier + 1u;
+				multiplier *= multiplier;
+			}
+
+			state = accMultiplier * state + accAddend;
+		}
+
+	private:
+		constexpr static uint64 Multiplier = 6364136223846793005ull;
+
+		uint64 state;
+		uint64 increment;
+	};
+
+	// Calls func(engine, begin, count) on up to taskNum tasks, each with a copy of engine sought to begin,
+	// then advances engine past size values. Any taskNum gives the same values.
+	template <class Func>
+	NO_ODR void ParallelFill(Philox4x32& engine, size_t size, Func&& func, size_t taskNum = 0)
+	{
+		// A multiple of the bulk step keeps chunk boundaries on whole steps.
+		constexpr size_t MinChunkSize = Philox4x32::ChunkSize << 8;
+		const uint64 start = engine.Tell();
+
+		Detail::ParallelChunks(size, MinChunkSize, taskNum, [&](size_t begin, size_t count)
+		{
+			Philox4x32 local = engine;
+			local.Seek(start + begin);
+			func(local, begin, count);
+		});
+
+		engine.Seek(start + size);
 	}
 
 	template <class T, class Engine, class Distributor, bool = Detail::HasParam<Distributor>::value>
@@ -32,8 +560,8 @@ namespace BSMath
 		using Parameter = typename Distributor::param_type;
 
 	public:
-		Random() : engine(std::random_device{}()), distributor() {}
-		Random(const Parameter& param) : engine(std::random_device{}()), distributor(param) {}
+		Random() : engine(static_cast<Seed>(Detail::NextSeed())), distributor() {}
+		Random(const Parameter& param) : engine(static_cast<Seed>(Detail::NextSeed())), distributor(param) {}
 
 		T operator()() noexcept
 		{
@@ -45,6 +573,26 @@ namespace BSMath
 			return distributor(engine, param);
 		}
 
+		void Fill(T* out, size_t size)
+		{
+			if constexpr (Detail::HasFill<Distributor, Engine, T>::value)
+				distributor.Fill(engine, out, size);
+			else if constexpr (Detail::IsVectorEngine<Engine>::value && Detail::IsUniformDistribution<Distributor>::value)
+				engine.FillUniform(out, size, distributor.a(), distributor.b());
+			else
+				std::generate_n(out, size, [this] { return distributor(engine); });
+		}
+
+		void Fill(T* out, size_t size, const Parameter& param)
+		{
+			if constexpr (Detail::HasFill<Distributor, Engine, T>::value)
+				distributor.Fill(engine, out, size, param);
+			else if constexpr (Detail::IsVectorEngine<Engine>::value && Detail::IsUniformDistribution<Distributor>::value)
+				engine.FillUniform(out, size, param.a(), param.b());
+			else
+				std::generate_n(out, size, [&] { return distributor(engine, param); });
+		}
+
 		void SetSeed(Seed seed)
 		{
 			engine.seed(seed);
@@ -62,13 +610,21 @@ namespace BSMath
 		using Seed = typename Engine::result_type;
 
 	public:
-		Random() : engine(std::random_device{}()), distributor() {}
+		Random() : engine(static_cast<Seed>(Detail::NextSeed())), distributor() {}
 
 		T operator()() noexcept
 		{
 			return distributor(engine);
 		}
 
+		void Fill(T* out, size_t size)
+		{
+			if constexpr (Detail::HasFill<Distributor, Engine, T>::value)
+				distributor.Fill(engine, out, size);
+			else
+				std::generate_n(out, size, [this] { return distributor(engine); });
+		}
+
 		void SetSeed(Seed seed)
 		{
 			engine.seed(seed);
@@ -79,7 +635,9 @@ namespace BSMath
 		Distributor distributor;
 	};
 	
-	using UniformIntRandom = Random<int, std::mt19937, std::uniform_int_distribution<int>>;
-	using UniformFloatRandom = Random<float, std::mt19937, std::uniform_real_distribution<float>>;
-	using NormalFloatRandom = Random<float, std::mt19937, std::normal_distribution<float>>;
+	using DefaultRandomEngine = Xoshiro128;
+
+	using UniformIntRandom = Random<int, DefaultRandomEngine, std::uniform_int_distribution<int>>;
+	using UniformFloatRandom = Random<float, DefaultRandomEngine, std::uniform_real_distribution<float>>;
+	using NormalFloatRandom = Random<float, DefaultRandomEngine, std::normal_distribution<float>>;
 }
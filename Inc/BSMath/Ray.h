@@ -0,0 +1,258 @@
+#pragma once
+
+#include "AABB.h"
+#include "Packet.h"
+
+namespace BSMath
+{
+	// Intersection functions return the distance along the direction to the nearest hit,
+	// or Infinity when there is no hit. A ray starting inside a volume hits at distance 0.
+	struct alignas(16) Ray final
+	{
+	public:
+		constexpr Ray() noexcept
+			: origin(), direction(0.0f, 0.0f, 1.0f), invDirection(Infinity, Infinity, 1.0f) {}
+
+		explicit Ray(const Vector3& inOrigin, const Vector3& inDirection) noexcept
+			: origin(), direction(), invDirection()
+		{
+			Set(inOrigin, inDirection);
+		}
+
+		void Set(const Vector3& inOrigin, const Vector3& inDirection) noexcept
+		{
+			using namespace SIMD;
+			origin = inOrigin;
+			direction = inDirection;
+			VectorStore(VectorDivide(One<float>, VectorLoad(direction.data)), invDirection.data);
+		}
+
+		[[nodiscard]] Vector3 GetPoint(float distance) const noexcept
+		{
+			return origin + direction * distance;
+		}
+
+		[[nodiscard]] float Intersect(const AABB& box) const noexcept;
+		[[nodiscard]] float Intersect(const Vector3& center, float radius) const noexcept;
+		[[nodiscard]] float Intersect(const Vector3& v0, const Vector3& v1, const Vector3& v2) const noexcept;
+
+	public:
+		Vector3 origin;
+		Vector3 direction;
+		Vector3 invDirection;
+	};
+
+	// Four rays transposed into registers. Only the first size lanes are meaningful.
+	struct RayPacket final
+	{
+	public:
+		constexpr static size_t Width = Vector3Packet::Width;
+
+	public:
+		RayPacket() noexcept = default;
+
+		explicit RayPacket(const Ray& ray) noexcept
+			: origin(ray.origin), direction(ray.direction), invDirection(ray.invDirection) {}
+
+		explicit RayPacket(const Ray* rays, size_t size = Width) noexcept
+		{
+			Vector3 origins[Width], directions[Width], invDirections[Width];
+			for (size_t i = 0; i < size; ++i)
+			{
+				origins[i] = rays[i].origin;
+				directions[i] = rays[i].direction;
+				invDirections[i] = rays[i].invDirection;
+			}
+
+			origin = Vector3Packet{ origins, size };
+			direction = Vector3Packet{ directions, size };
+			invDirection = Vector3Packet{ invDirections, size };
+		}
+
+		[[nodiscard]] SIMD::VectorRegister<float> Intersect(const AABB& box) const noexcept;
+		[[nodiscard]] SIMD::VectorRegister<float> Intersect(const Vector3& center, float radius) const noexcept;
+		[[nodiscard]] SIMD::VectorRegister<float> Intersect(const Vector3& v0, const Vector3& v1, const Vector3& v2) const noexcept;
+
+	public:
+		Vector3Packet origin;
+		Vector3Packet direction;
+		Vector3Packet invDirection;
+	};
+
+	namespace Detail
+	{
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> IntersectBoxPacket(const Vector3Packet& origin,
+			const Vector3Packet& invDirection, const Vector3Packet& min, const Vector3Packet& max) noexcept
+		{
+			// Ref: Williams et al., "An Efficient and Robust Ray-Box Intersection Algorithm"
+
+			using namespace SIMD;
+			const auto t0 = (min - origin) * invDirection;
+			const auto t1 = (max - origin) * invDirection;
+
+			// A ray lying in a slab plane gives 0 * inf = NaN there, and one parallel inside the slab
+			// gives t0 + t1 = -inf + inf = NaN. Neither slab bounds the ray, so its bounds are turned
+			// into NaN and passed first to VectorMax and VectorMin, which return their second operand
+			// on NaN and so keep the running bounds. A ray in a face plane touches the closed box.
+			const auto allBits = VectorCastFloat(VectorLoad1(-1));
+			auto tNear = VectorLoad1(0.0f);
+			auto tFar = VectorLoad1(Infinity);
+			for (size_t i = 0; i < 3; ++i)
+			{
+				const auto sum = VectorAdd(t0[i], t1[i]);
+				const auto isUnbounded = VectorAndNot(VectorEqual(sum, sum), allBits);
+				tNear = VectorMax(VectorOr(VectorMin(t0[i], t1[i]), isUnbounded), tNear);
+				tFar = VectorMin(VectorOr(VectorMax(t0[i], t1[i]), isUnbounded), tFar);
+			}
+
+			return VectorSelect(tNear, VectorLoad1(Infinity), VectorLessEqual(tNear, tFar));
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> IntersectSpherePacket(const Vector3Packet& origin,
+			const Vector3Packet& direction, const Vector3Packet& center, SIMD::VectorRegister<float> radius) noexcept
+		{
+			using namespace SIMD;
+			const auto oc = origin - center;
+			const auto a = direction | direction;
+			const auto b = oc | direction;
+			const auto c = VectorSubtract(oc | oc, VectorMultiply(radius, radius));
+
+			const auto disc = VectorSubtract(VectorMultiply(b, b), VectorMultiply(a, c));
+			const auto root = VectorSqrt(VectorMax(disc, Zero<float>));
+			const auto invA = VectorDivide(One<float>, a);
+			const auto negB = VectorNegate(b);
+
+			const auto t0 = VectorMultiply(VectorSubtract(negB, root), invA);
+			const auto t1 = VectorMultiply(VectorAdd(negB, root), invA);
+			const auto hit = VectorAnd(VectorGreaterEqual(disc, Zero<float>), VectorGreaterEqual(t1, Zero<float>));
+			return VectorSelect(VectorMax(t0, Zero<float>), VectorLoad1(Infinity), hit);
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> IntersectTrianglePacket(const Vector3Packet& origin,
+			const Vector3Packet& direction, const Vector3Packet& v0, const Vector3Packet& v1, const Vector3Packet& v2) noexcept
+		{
+			// Ref: Moller, Trumbore, "Fast, Minimum Storage Ray/Triangle Intersection"
+
+			using namespace SIMD;
+			const auto e1 = v1 - v0;
+			const auto e2 = v2 - v0;
+			const auto p = direction ^ e2;
+			const auto det = e1 | p;
+			const auto invDet = VectorDivide(One<float>, det);
+
+			const auto s = origin - v0;
+			const auto u = VectorMultiply(s | p, invDet);
+			const auto q = s ^ e1;
+			const auto v = VectorMultiply(direction | q, invDet);
+			const auto t = VectorMultiply(e2 | q, invDet);
+
+			// det is |e1| * |e2| * |direction| times the sine terms, so the parallel test is relative to
+			// that product. Compared squared, which saves the square roots.
+			const auto scale = VectorMultiply(VectorMultiply(e1 | e1, e2 | e2), direction | direction);
+			auto hit = VectorGreaterThan(VectorMultiply(det, det), VectorMultiply(scale, VectorLoad1(Epsilon * Epsilon)));
+			hit = VectorAnd(hit, VectorGreaterEqual(u, Zero<float>));
+			hit = VectorAnd(hit, VectorGreaterEqual(v, Zero<float>));
+			hit = VectorAnd(hit, VectorLessEqual(VectorAdd(u, v), One<float>));
+			hit = VectorAnd(hit, VectorGreaterEqual(t, Zero<float>));
+			return VectorSelect(t, VectorLoad1(Infinity), hit);
+		}
+	}
+
+	NO_ODR SIMD::VectorRegister<float> RayPacket::Intersect(const AABB& box) const noexcept
+	{
+		return Detail::IntersectBoxPacket(origin, invDirection, Vector3Packet{ box.min }, Vector3Packet{ box.max });
+	}
+
+	NO_ODR SIMD::VectorRegister<float> RayPacket::Intersect(const Vector3& center, float radius) const noexcept
+	{
+		return Detail::IntersectSpherePacket(origin, direction, Vector3Packet{ center }, SIMD::VectorLoad1(radius));
+	}
+
+	NO_ODR SIMD::VectorRegister<float> RayPacket::Intersect(const Vector3& v0, const Vector3& v1, const Vector3& v2) const noexcept
+	{
+		return Detail::IntersectTrianglePacket(origin, direction, Vector3Packet{ v0 }, Vector3Packet{ v1 }, Vector3Packet{ v2 });
+	}
+
+	NO_ODR float Ray::Intersect(const AABB& box) const noexcept
+	{
+		return SIMD::VectorStore1(RayPacket{ *this }.Intersect(box));
+	}
+
+	NO_ODR float Ray::Intersect(const Vector3& center, float radius) const noexcept
+	{
+		return SIMD::VectorStore1(RayPacket{ *this }.Intersect(center, radius));
+	}
+
+	NO_ODR float Ray::Intersect(const Vector3& v0, const Vector3& v1, const Vector3& v2) const noexcept
+	{
+		return SIMD::VectorStore1(RayPacket{ *this }.Intersect(v0, v1, v2));
+	}
+
+	// Batch functions test one ray against many primitives and write one distance per primitive.
+
+	NO_ODR void IntersectBoxes(const Ray& ray, const VectorSoA<const float, 3>& mins,
+		const VectorSoA<const float, 3>& maxs, size_t size, float* outDistances) noexcept
+	{
+		using namespace SIMD;
+		const RayPacket packet{ ray };
+
+		size_t idx = 0;
+		for (; idx + RayPacket::Width <= size; idx += RayPacket::Width)
+		{
+			const auto dist = Detail::IntersectBoxPacket(packet.origin, packet.invDirection,
+				Vector3Packet::Load(mins, idx), Vector3Packet::Load(maxs, idx));
+			VectorStorePtrUnaligned(dist, outDistances + idx);
+		}
+
+		if (idx == size) return;
+
+		const size_t remain = size - idx;
+		const auto dist = Detail::IntersectBoxPacket(packet.origin, packet.invDirection,
+			Vector3Packet::Load(mins, idx, remain), Vector3Packet::Load(maxs, idx, remain));
+		VectorStorePtr(dist, outDistances + idx, remain);
+	}
+
+	NO_ODR void IntersectSpheres(const Ray& ray, const VectorSoA<const float, 3>& centers,
+		const float* radii, size_t size, float* outDistances) noexcept
+	{
+		using namespace SIMD;
+		const RayPacket packet{ ray };
+
+		size_t idx = 0;
+		for (; idx + RayPacket::Width <= size; idx += RayPacket::Width)
+		{
+			const auto dist = Detail::IntersectSpherePacket(packet.origin, packet.direction,
+				Vector3Packet::Load(centers, idx), VectorLoadPtrUnaligned(radii + idx));
+			VectorStorePtrUnaligned(dist, outDistances + idx);
+		}
+
+		if (idx == size) return;
+
+		const size_t remain = size - idx;
+		const auto dist = Detail::IntersectSpherePacket(packet.origin, packet.direction,
+			Vector3Packet::Load(centers, idx, remain), VectorLoadPtr(radii + idx, remain));
+		VectorStorePtr(dist, outDistances + idx, remain);
+	}
+
+	NO_ODR void IntersectTriangles(const Ray& ray, const VectorSoA<const float, 3>& v0s,
+		const VectorSoA<const float, 3>& v1s, const VectorSoA<const float, 3>& v2s, size_t size, float* outDistances) noexcept
+	{
+		using namespace SIMD;
+		const RayPacket packet{ ray };
+
+		size_t idx = 0;
+		for (; idx + RayPacket::Width <= size; idx += RayPacket::Width)
+		{
+			const auto dist = Detail::IntersectTrianglePacket(packet.origin, packet.direction,
+				Vector3Packet::Load(v0s, idx), Vector3Packet::Load(v1s, idx), Vector3Packet::Load(v2s, idx));
+			VectorStorePtrUnaligned(dist, outDistances + idx);
+		}
+
+		if (idx == size) return;
+
+		const size_t remain = size - idx;
+		const auto dist = Detail::IntersectTrianglePacket(packet.origin, packet.direction,
+			Vector3Packet::Load(v0s, idx, remain), Vector3Packet::Load(v1s, idx, remain), Vector3Packet::Load(v2s, idx, remain));
+		VectorStorePtr(dist, outDistances + idx, remain);
+	}
+}
@@ -149,7 +149,13 @@ namespace BSMath
 
 	// Rotator's Hash
 	template <>
-	struct Hash<Rotator> final : public HashRange<Rotator, sizeof(float) * 3> {};
+	struct Hash<Rotator> final : public FloatHashRange<Rotator, 3> {};
+
+	template <>
+	struct QuantizedHash<Rotator> final : public QuantizedHashRange<Rotator, 3>
+	{
+		using QuantizedHashRange::QuantizedHashRange;
+	};
 
 	// Rotator's Random
 	class RotatorDistribution final
@@ -163,7 +169,18 @@ namespace BSMath
 			std::uniform_real_distribution<float> dist{ 0.0f, 360.0f };
 			return Rotator{ dist(engine), dist(engine), dist(engine) };
 		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size)
+		{
+			static_assert(sizeof(result_type) == sizeof(float) * 4);
+
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+				engine.FillUniform(reinterpret_cast<float*>(out), size * 4, 0.0f, 360.0f);
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine); });
+		}
 	};
 
-	using RotatorRandom = Random<Rotator, std::mt19937, RotatorDistribution>;
+	using RotatorRandom = Random<Rotator, DefaultRandomEngine, RotatorDistribution>;
 }
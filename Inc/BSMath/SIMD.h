@@ -4,6 +4,17 @@
 #include <type_traits>
 #include "Basic.h"
 
+#if defined(__SSSE3__) || defined(__AVX__)
+#   include <tmmintrin.h>
+#   define HAS_SSSE3
+#endif
+
+// MSVC has no F16C flag and implies it from /arch:AVX2, while GCC and Clang need -mf16c.
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#   include <immintrin.h>
+#   define HAS_F16C
+#endif
+
 #if defined(_MSC_VER) && !defined(_M_ARM) && !defined(_M_ARM64) \
     && !defined(_M_HYBRID_X86_ARM64) && (!_MANAGED) && (!_M_CEE) \
     && (!defined(_M_IX86_FP) || (_M_IX86_FP > 1)) && !defined(_XM_NO_INTRINSICS_) && !defined(_XM_VECTORCALL_)
@@ -69,6 +80,22 @@ namespace BSMath::SIMD
         return _mm_load_si128(reinterpret_cast<const __m128i*>(vec));
     }
 
+    [[nodiscard]] NO_ODR VectorRegister<float> VectorLoadPtrUnaligned(const float* vec) noexcept
+    {
+        return _mm_loadu_ps(vec);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VectorLoadPtrUnaligned(const int* vec) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(vec));
+    }
+
+    // Loads 64 bits to the low half and zeroes the high half. The pointer may be unaligned.
+    [[nodiscard]] NO_ODR VectorRegister<int> VectorLoadPtrLow(const int* vec) noexcept
+    {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(vec));
+    }
+
     [[nodiscard]] NO_ODR VectorRegister<float> VectorLoadPtr(const float* vec, size_t size) noexcept
     {
         float arr[4]{};
@@ -129,6 +156,22 @@ namespace BSMath::SIMD
         _mm_store_si128(reinterpret_cast<VectorRegister<int>*>(ptr), vec);
     }
 
+    NO_ODR void VECTOR_CALL VectorStorePtrUnaligned(VectorRegister<float> vec, float* ptr) noexcept
+    {
+        _mm_storeu_ps(ptr, vec);
+    }
+
+    NO_ODR void VECTOR_CALL VectorStorePtrUnaligned(VectorRegister<int> vec, int* ptr) noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<VectorRegister<int>*>(ptr), vec);
+    }
+
+    // Stores the low 64 bits. The pointer may be unaligned.
+    NO_ODR void VECTOR_CALL VectorStorePtrLow(VectorRegister<int> vec, int* ptr) noexcept
+    {
+        _mm_storel_epi64(reinterpret_cast<VectorRegister<int>*>(ptr), vec);
+    }
+
     NO_ODR void VECTOR_CALL VectorStorePtr(VectorRegister<float> vec, float* ptr, size_t size) noexcept
     {
         float arr[4];
@@ -181,6 +224,78 @@ namespace BSMath::SIMD
         return _mm_cvtsi128_si32(vec);
     }
 
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorCastInt(VectorRegister<float> vec) noexcept
+    {
+        return _mm_castps_si128(vec);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorCastFloat(VectorRegister<int> vec) noexcept
+    {
+        return _mm_castsi128_ps(vec);
+    }
+
+    // Truncates toward zero.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorConvertInt(VectorRegister<float> vec) noexcept
+    {
+        return _mm_cvttps_epi32(vec);
+    }
+
+    // Rounds to nearest even.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorRoundInt(VectorRegister<float> vec) noexcept
+    {
+        return _mm_cvtps_epi32(vec);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorConvertFloat(VectorRegister<int> vec) noexcept
+    {
+        return _mm_cvtepi32_ps(vec);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorFloorInt(VectorRegister<float> vec) noexcept
+    {
+        const auto trunc = _mm_cvttps_epi32(vec);
+        const auto greater = _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(trunc), vec));
+        return _mm_add_epi32(trunc, greater);
+    }
+
+    template <int N>
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorShiftLeft(VectorRegister<int> vec) noexcept
+    {
+        return _mm_slli_epi32(vec, N);
+    }
+
+    // Shifts in zeros regardless of the sign.
+    template <int N>
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorShiftRight(VectorRegister<int> vec) noexcept
+    {
+        return _mm_srli_epi32(vec, N);
+    }
+
+    // Shifts in copies of the sign bit.
+    template <int N>
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorShiftRightArithmetic(VectorRegister<int> vec) noexcept
+    {
+        return _mm_srai_epi32(vec, N);
+    }
+
+    // Rows become columns.
+    NO_ODR void VECTOR_CALL VectorTranspose(VectorRegister<int>(&vec)[4]) noexcept
+    {
+        const auto xy01 = _mm_unpacklo_epi32(vec[0], vec[1]);
+        const auto xy23 = _mm_unpacklo_epi32(vec[2], vec[3]);
+        const auto zw01 = _mm_unpackhi_epi32(vec[0], vec[1]);
+        const auto zw23 = _mm_unpackhi_epi32(vec[2], vec[3]);
+        vec[0] = _mm_unpacklo_epi64(xy01, xy23);
+        vec[1] = _mm_unpackhi_epi64(xy01, xy23);
+        vec[2] = _mm_unpacklo_epi64(zw01, zw23);
+        vec[3] = _mm_unpackhi_epi64(zw01, zw23);
+    }
+
+    NO_ODR void VECTOR_CALL VectorTranspose(VectorRegister<float>(&vec)[4]) noexcept
+    {
+        _MM_TRANSPOSE4_PS(vec[0], vec[1], vec[2], vec[3]);
+    }
+
     template <Swizzle X, Swizzle Y, Swizzle Z, Swizzle W>
     [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorSwizzle(VectorRegister<float> vec) noexcept
     {
@@ -287,6 +402,11 @@ namespace BSMath::SIMD
         return _mm_andnot_si128(lhs, rhs);
     }
 
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorSelect(VectorRegister<float> lhs, VectorRegister<float> rhs, VectorRegister<float> mask) noexcept
+    {
+        return VectorXor(rhs, VectorAnd(mask, VectorXor(lhs, rhs)));
+    }
+
     [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorSelect(VectorRegister<int> lhs, VectorRegister<int> rhs, VectorRegister<int> mask) noexcept
     {
         return VectorXor(rhs, VectorAnd(mask, VectorXor(lhs, rhs)));
@@ -392,7 +512,26 @@ namespace BSMath::SIMD
     {
         const VectorRegister<int> tmp1 = _mm_mul_epu32(lhs, rhs);
         const VectorRegister<int> tmp2 = _mm_mul_epu32(_mm_srli_si128(lhs, 4), _mm_srli_si128(rhs, 4));
-        return _mm_unpacklo_epi32(VectorSwizzle<Swizzle::Z, Swizzle::Y, Swizzle::Z, Swizzle::X>(tmp1), tmp2);
+        return _mm_unpacklo_epi32(VectorSwizzle<Swizzle::X, Swizzle::Z, Swizzle::X, Swizzle::Z>(tmp1),
+            VectorSwizzle<Swizzle::X, Swizzle::Z, Swizzle::X, Swizzle::Z>(tmp2));
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorMultiplyAdd(VectorRegister<float> lhs, VectorRegister<float> rhs, VectorRegister<float> addend) noexcept
+    {
+        return VectorAdd(VectorMultiply(lhs, rhs), addend);
+    }
+
+    // High 32 bits of the unsigned 64 bit products.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorMultiplyHigh(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        const auto even = _mm_mul_epu32(lhs, rhs);
+        const auto odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+        return _mm_or_si128(_mm_srli_epi64(even, 32), _mm_and_si128(odd, _mm_set_epi32(-1, 0, -1, 0)));
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorMultiplyAdd(VectorRegister<int> lhs, VectorRegister<int> rhs, VectorRegister<int> addend) noexcept
+    {
+        return VectorAdd(VectorMultiply(lhs, rhs), addend);
     }
 
     [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorDivide(VectorRegister<float> lhs, VectorRegister<float> rhs) noexcept
@@ -450,6 +589,48 @@ namespace BSMath::SIMD
         return VectorSelect(lhs, rhs, _mm_cmpgt_epi32(lhs, rhs));
     }
 
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorAbs(VectorRegister<float> vec) noexcept
+    {
+        return VectorAndNot(VectorLoad1(-0.0f), vec);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorNegate(VectorRegister<float> vec) noexcept
+    {
+        return VectorXor(vec, VectorLoad1(-0.0f));
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorSqrt(VectorRegister<float> vec) noexcept
+    {
+        return _mm_sqrt_ps(vec);
+    }
+
+    // Minimax polynomials for angles in [-Pi, Pi]. The angle is reflected into [-Pi/2, Pi/2] first.
+    // Ref: DirectXMath XMVectorSinCos
+    NO_ODR void VECTOR_CALL VectorSinCos(VectorRegister<float> vec, VectorRegister<float>& outSin, VectorRegister<float>& outCos) noexcept
+    {
+        const auto signMask = VectorLoad1(-0.0f);
+        const auto reflected = VectorSubtract(VectorOr(VectorAnd(vec, signMask), VectorLoad1(3.141592654f)), vec);
+        const auto inRange = VectorLessEqual(VectorAbs(vec), VectorLoad1(1.570796327f));
+
+        const auto x = VectorSelect(vec, reflected, inRange);
+        const auto sign = VectorSelect(VectorLoad1(1.0f), VectorLoad1(-1.0f), inRange);
+        const auto x2 = VectorMultiply(x, x);
+
+        auto sin = VectorMultiplyAdd(VectorLoad1(-2.3889859e-08f), x2, VectorLoad1(2.7525562e-06f));
+        sin = VectorMultiplyAdd(sin, x2, VectorLoad1(-0.00019840874f));
+        sin = VectorMultiplyAdd(sin, x2, VectorLoad1(0.0083333310f));
+        sin = VectorMultiplyAdd(sin, x2, VectorLoad1(-0.16666667f));
+        sin = VectorMultiplyAdd(sin, x2, VectorLoad1(1.0f));
+        outSin = VectorMultiply(sin, x);
+
+        auto cos = VectorMultiplyAdd(VectorLoad1(-2.6051615e-07f), x2, VectorLoad1(2.4760495e-05f));
+        cos = VectorMultiplyAdd(cos, x2, VectorLoad1(-0.0013888378f));
+        cos = VectorMultiplyAdd(cos, x2, VectorLoad1(0.041666638f));
+        cos = VectorMultiplyAdd(cos, x2, VectorLoad1(-0.5f));
+        cos = VectorMultiplyAdd(cos, x2, VectorLoad1(1.0f));
+        outCos = VectorMultiply(cos, sign);
+    }
+
     [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorInvSqrt(VectorRegister<float> vec, size_t iterationNum = 2) noexcept
     {
         const auto oneHalf = VectorLoad1(0.5f);
@@ -473,4 +654,149 @@ namespace BSMath::SIMD
     {
         return VectorStore1(VectorInvSqrt(VectorLoad1(n), iterationNum));
     }
+
+    // Packed 8 and 16 bit lanes. Integer registers are reinterpreted as sixteen unsigned bytes
+    // or eight 16 bit words.
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorAddSaturateU8(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_adds_epu8(lhs, rhs);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorSubtractSaturateU8(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_subs_epu8(lhs, rhs);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorMinU8(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_min_epu8(lhs, rhs);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorMaxU8(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_max_epu8(lhs, rhs);
+    }
+
+    // Zero extends the low eight bytes to words.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorUnpackLowU8(VectorRegister<int> vec) noexcept
+    {
+        return _mm_unpacklo_epi8(vec, _mm_setzero_si128());
+    }
+
+    // Zero extends the high eight bytes to words.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorUnpackHighU8(VectorRegister<int> vec) noexcept
+    {
+        return _mm_unpackhi_epi8(vec, _mm_setzero_si128());
+    }
+
+    // Interleaves the low eight bytes of both registers, starting with lhs.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorInterleaveLowU8(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_unpacklo_epi8(lhs, rhs);
+    }
+
+    // Interleaves the high eight bytes of both registers, starting with lhs.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorInterleaveHighU8(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_unpackhi_epi8(lhs, rhs);
+    }
+
+    // Interleaves the low four words of both registers, starting with lhs.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorInterleaveLow16(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_unpacklo_epi16(lhs, rhs);
+    }
+
+    // Interleaves the high four words of both registers, starting with lhs.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorInterleaveHigh16(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_unpackhi_epi16(lhs, rhs);
+    }
+
+    // Packs the words of both registers back to bytes with unsigned saturation.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorPackU16(VectorRegister<int> low, VectorRegister<int> high) noexcept
+    {
+        return _mm_packus_epi16(low, high);
+    }
+
+    // Packs the 32 bit lanes of both registers to words with signed saturation.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorPack32(VectorRegister<int> low, VectorRegister<int> high) noexcept
+    {
+        return _mm_packs_epi32(low, high);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VectorLoad16(int16 n) noexcept
+    {
+        return _mm_set1_epi16(n);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorAdd16(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_add_epi16(lhs, rhs);
+    }
+
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorSubtract16(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_sub_epi16(lhs, rhs);
+    }
+
+    // Low 16 bits of the products.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorMultiply16(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_mullo_epi16(lhs, rhs);
+    }
+
+    // High 16 bits of the unsigned products.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorMultiplyHighU16(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_mulhi_epu16(lhs, rhs);
+    }
+
+    // Multiplies signed words and adds adjacent products into 32 bit lanes.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorMultiplyAddPairs16(VectorRegister<int> lhs, VectorRegister<int> rhs) noexcept
+    {
+        return _mm_madd_epi16(lhs, rhs);
+    }
+
+    template <int N>
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorShiftLeft16(VectorRegister<int> vec) noexcept
+    {
+        return _mm_slli_epi16(vec, N);
+    }
+
+    template <int N>
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorShiftRight16(VectorRegister<int> vec) noexcept
+    {
+        return _mm_srli_epi16(vec, N);
+    }
+
+#if defined(HAS_SSSE3)
+    // Picks the byte of vec indexed by each byte of control, or zero where its high bit is set.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorShuffleBytes(VectorRegister<int> vec, VectorRegister<int> control) noexcept
+    {
+        return _mm_shuffle_epi8(vec, control);
+    }
+#endif
+
+#if defined(HAS_F16C)
+    // Converts to half floats in the low four words, rounding to nearest even.
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorConvertHalf(VectorRegister<float> vec) noexcept
+    {
+        return _mm_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT);
+    }
+
+    // Converts the half floats in the low four words.
+    [[nodiscard]] NO_ODR VectorRegister<float> VECTOR_CALL VectorConvertHalfFloat(VectorRegister<int> vec) noexcept
+    {
+        return _mm_cvtph_ps(vec);
+    }
+#endif
+
+    // Swizzles the words of each 64 bit half alike.
+    template <Swizzle X, Swizzle Y, Swizzle Z, Swizzle W>
+    [[nodiscard]] NO_ODR VectorRegister<int> VECTOR_CALL VectorSwizzle16(VectorRegister<int> vec) noexcept
+    {
+        return _mm_shufflehi_epi16(_mm_shufflelo_epi16(vec, GET_MASK(X, Y, Z, W)), GET_MASK(X, Y, Z, W));
+    }
 }
@@ -0,0 +1,269 @@
+#pragma once
+
+#include "Quaternion.h"
+#include "Random.h"
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Draws UniformNum uniform [0, 1) streams in batches and lets kernel turn four samples at a time,
+		// one component per register, into output elements that each span a whole register.
+		template <size_t UniformNum, class Engine, class T, class Kernel>
+		void FillSamples(Engine& engine, T* out, size_t size, Kernel&& kernel)
+		{
+			static_assert(sizeof(T) == sizeof(float) * 4);
+			using namespace SIMD;
+
+			constexpr size_t BatchSize = 64;
+			alignas(16) float uniforms[UniformNum][BatchSize];
+
+			while (size > 0)
+			{
+				const size_t num = Min(size, BatchSize);
+				for (size_t i = 0; i < UniformNum; ++i)
+					engine.FillUniform(uniforms[i], (num + 3) & ~size_t{ 3 });
+
+				for (size_t idx = 0; idx < num; idx += 4)
+				{
+					VectorRegister<float> u[UniformNum];
+					for (size_t i = 0; i < UniformNum; ++i)
+						u[i] = VectorLoadPtr(uniforms[i] + idx);
+
+					VectorRegister<float> lanes[4]{ Zero<float>, Zero<float>, Zero<float>, Zero<float> };
+					kernel(u, lanes);
+					VectorTranspose(lanes);
+
+					const size_t laneNum = Min(num - idx, size_t{ 4 });
+					for (size_t lane = 0; lane < laneNum; ++lane)
+						VectorStorePtr(lanes[lane], reinterpret_cast<float*>(out + idx + lane));
+				}
+
+				out += num;
+				size -= num;
+			}
+		}
+
+		// Angles are drawn from [-Pi, Pi) so VectorSinCos needs no range reduction.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL UniformToAngle(SIMD::VectorRegister<float> u) noexcept
+		{
+			using namespace SIMD;
+			return VectorMultiplyAdd(u, VectorLoad1(2.0f * Pi), VectorLoad1(-Pi));
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL OneMinusSquare(SIMD::VectorRegister<float> vec) noexcept
+		{
+			using namespace SIMD;
+			return VectorMax(VectorSubtract(VectorLoad1(1.0f), VectorMultiply(vec, vec)), Zero<float>);
+		}
+
+		template <class Engine>
+		[[nodiscard]] float UniformAngle(Engine& engine)
+		{
+			return std::uniform_real_distribution<float>{ -Pi, Pi }(engine);
+		}
+
+		template <class Engine>
+		[[nodiscard]] float Uniform(Engine& engine)
+		{
+			return std::uniform_real_distribution<float>{}(engine);
+		}
+	}
+
+	// Uniform point on the surface of the unit sphere.
+	class UnitSphereDistribution final
+	{
+	public:
+		using result_type = Vector3;
+
+		template <class Engine>
+		[[nodiscard]] result_type operator()(Engine& engine)
+		{
+			const float z = 1.0f - 2.0f * Detail::Uniform(engine);
+			const float r = Sqrt(Max(1.0f - z * z, 0.0f));
+			const float angle = Detail::UniformAngle(engine);
+			return Vector3{ r * Cos(angle), r * Sin(angle), z };
+		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size)
+		{
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+			{
+				Detail::FillSamples<2>(engine, out, size, [](const SIMD::VectorRegister<float>(&u)[2], SIMD::VectorRegister<float>(&lanes)[4])
+				{
+					using namespace SIMD;
+					lanes[2] = VectorMultiplyAdd(u[0], VectorLoad1(-2.0f), VectorLoad1(1.0f));
+					const auto r = VectorSqrt(Detail::OneMinusSquare(lanes[2]));
+
+					VectorRegister<float> sin, cos;
+					VectorSinCos(Detail::UniformToAngle(u[1]), sin, cos);
+					lanes[0] = VectorMultiply(r, cos);
+					lanes[1] = VectorMultiply(r, sin);
+				});
+			}
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine); });
+		}
+	};
+
+	// Uniform point inside the unit ball. The radius is the largest of three uniforms,
+	// whose distribution is r^3 as the volume requires.
+	class UnitBallDistribution final
+	{
+	public:
+		using result_type = Vector3;
+
+		template <class Engine>
+		[[nodiscard]] result_type operator()(Engine& engine)
+		{
+			const float radius = Max(Max(Detail::Uniform(engine), Detail::Uniform(engine)), Detail::Uniform(engine));
+			return UnitSphereDistribution{}(engine) * radius;
+		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size)
+		{
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+			{
+				Detail::FillSamples<5>(engine, out, size, [](const SIMD::VectorRegister<float>(&u)[5], SIMD::VectorRegister<float>(&lanes)[4])
+				{
+					using namespace SIMD;
+					const auto radius = VectorMax(VectorMax(u[2], u[3]), u[4]);
+					const auto z = VectorMultiplyAdd(u[0], VectorLoad1(-2.0f), VectorLoad1(1.0f));
+					const auto r = VectorMultiply(VectorSqrt(Detail::OneMinusSquare(z)), radius);
+
+					VectorRegister<float> sin, cos;
+					VectorSinCos(Detail::UniformToAngle(u[1]), sin, cos);
+					lanes[0] = VectorMultiply(r, cos);
+					lanes[1] = VectorMultiply(r, sin);
+					lanes[2] = VectorMultiply(z, radius);
+				});
+			}
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine); });
+		}
+	};
+
+	// Uniform point inside the unit disk.
+	class UnitDiskDistribution final
+	{
+	public:
+		using result_type = Vector2;
+
+		template <class Engine>
+		[[nodiscard]] result_type operator()(Engine& engine)
+		{
+			const float r = Sqrt(Detail::Uniform(engine));
+			const float angle = Detail::UniformAngle(engine);
+			return Vector2{ r * Cos(angle), r * Sin(angle) };
+		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size)
+		{
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+			{
+				Detail::FillSamples<2>(engine, out, size, [](const SIMD::VectorRegister<float>(&u)[2], SIMD::VectorRegister<float>(&lanes)[4])
+				{
+					using namespace SIMD;
+					const auto r = VectorSqrt(u[0]);
+
+					VectorRegister<float> sin, cos;
+					VectorSinCos(Detail::UniformToAngle(u[1]), sin, cos);
+					lanes[0] = VectorMultiply(r, cos);
+					lanes[1] = VectorMultiply(r, sin);
+				});
+			}
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine); });
+		}
+	};
+
+	// Direction on the hemisphere around Vector3::Up with a density proportional to the cosine
+	// of its angle to Up. A uniform disk sample is lifted onto the hemisphere.
+	// Ref: Pharr, Jakob, Humphreys, "Physically Based Rendering", 13.6.3 Cosine-Weighted Hemisphere Sampling
+	class CosineHemisphereDistribution final
+	{
+	public:
+		using result_type = Vector3;
+
+		template <class Engine>
+		[[nodiscard]] result_type operator()(Engine& engine)
+		{
+			const float u = Detail::Uniform(engine);
+			const float r = Sqrt(u);
+			const float angle = Detail::UniformAngle(engine);
+			return Vector3{ r * Cos(angle), Sqrt(1.0f - u), r * Sin(angle) };
+		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size)
+		{
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+			{
+				Detail::FillSamples<2>(engine, out, size, [](const SIMD::VectorRegister<float>(&u)[2], SIMD::VectorRegister<float>(&lanes)[4])
+				{
+					using namespace SIMD;
+					const auto r = VectorSqrt(u[0]);
+
+					VectorRegister<float> sin, cos;
+					VectorSinCos(Detail::UniformToAngle(u[1]), sin, cos);
+					lanes[0] = VectorMultiply(r, cos);
+					lanes[1] = VectorSqrt(VectorSubtract(VectorLoad1(1.0f), u[0]));
+					lanes[2] = VectorMultiply(r, sin);
+				});
+			}
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine); });
+		}
+	};
+
+	// Uniformly distributed rotation. Uniform Euler angles from RotatorDistribution are not.
+	// Ref: Shoemake, "Uniform Random Rotations", Graphics Gems III
+	class QuaternionDistribution final
+	{
+	public:
+		using result_type = Quaternion;
+
+		template <class Engine>
+		[[nodiscard]] result_type operator()(Engine& engine)
+		{
+			const float u = Detail::Uniform(engine);
+			const float a = Sqrt(1.0f - u), b = Sqrt(u);
+			const float angle1 = Detail::UniformAngle(engine);
+			const float angle2 = Detail::UniformAngle(engine);
+			return Quaternion{ a * Sin(angle1), a * Cos(angle1), b * Sin(angle2), b * Cos(angle2) };
+		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size)
+		{
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+			{
+				Detail::FillSamples<3>(engine, out, size, [](const SIMD::VectorRegister<float>(&u)[3], SIMD::VectorRegister<float>(&lanes)[4])
+				{
+					using namespace SIMD;
+					const auto a = VectorSqrt(VectorSubtract(VectorLoad1(1.0f), u[0]));
+					const auto b = VectorSqrt(u[0]);
+
+					VectorRegister<float> sin1, cos1, sin2, cos2;
+					VectorSinCos(Detail::UniformToAngle(u[1]), sin1, cos1);
+					VectorSinCos(Detail::UniformToAngle(u[2]), sin2, cos2);
+					lanes[0] = VectorMultiply(a, sin1);
+					lanes[1] = VectorMultiply(a, cos1);
+					lanes[2] = VectorMultiply(b, sin2);
+					lanes[3] = VectorMultiply(b, cos2);
+				});
+			}
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine); });
+		}
+	};
+
+	using UnitSphereRandom = Random<Vector3, DefaultRandomEngine, UnitSphereDistribution>;
+	using UnitBallRandom = Random<Vector3, DefaultRandomEngine, UnitBallDistribution>;
+	using UnitDiskRandom = Random<Vector2, DefaultRandomEngine, UnitDiskDistribution>;
+	using CosineHemisphereRandom = Random<Vector3, DefaultRandomEngine, CosineHemisphereDistribution>;
+	using QuaternionRandom = Random<Quaternion, DefaultRandomEngine, QuaternionDistribution>;
+}
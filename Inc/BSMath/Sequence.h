@@ -0,0 +1,410 @@
+#pragma once
+
+#include "Vector.h"
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Radical inverses of the first Size integers. Larger integers split into a table lookup
+		// for the low digits and a short loop for the rest.
+		template <uint32 Base>
+		struct RadicalInverse final
+		{
+		public:
+			constexpr static uint32 DigitNum = Base == 2 ? 10 : Base == 3 ? 6 : 4;
+			constexpr static uint32 Size = Base == 2 ? 1024 : Base == 3 ? 729 : 625;
+
+		public:
+			constexpr RadicalInverse() noexcept : table()
+			{
+				for (uint32 i = 0; i < Size; ++i)
+					table[i] = static_cast<float>(High(i) * Size);
+			}
+
+			[[nodiscard]] float operator()(uint32 index) const noexcept
+			{
+				return table[index % Size] + static_cast<float>(High(index / Size));
+			}
+
+			// Radical inverse of index shifted right by DigitNum digits.
+			[[nodiscard]] constexpr static double High(uint32 index) noexcept
+			{
+				double ret = 0.0, factor = 1.0 / (static_cast<double>(Base) * Size);
+				for (; index > 0; index /= Base, factor /= Base)
+					ret += (index % Base) * factor;
+				return ret;
+			}
+
+		public:
+			float table[Size];
+		};
+
+		template <uint32 Base>
+		inline constexpr RadicalInverse<Base> RadicalInverseTable{};
+
+		// Points of the first three Sobol dimensions, from the primitive polynomials 1, x + 1 and x^2 + x + 1.
+		// A point is the XOR of the direction numbers of the set index bits, so it is looked up
+		// one index byte at a time.
+		// Ref: Joe, Kuo, "Constructing Sobol sequences with better two-dimensional projections"
+		struct SobolDirections final
+		{
+		public:
+			constexpr SobolDirections() noexcept : data()
+			{
+				uint32 directions[3][32]{};
+				for (uint32 bit = 0; bit < 32; ++bit)
+				{
+					directions[0][bit] = 1u << (31 - bit);
+					directions[1][bit] = bit == 0 ? 1u << 31 : directions[1][bit - 1] ^ (directions[1][bit - 1] >> 1);
+					directions[2][bit] = bit == 0 ? 1u << 31 : bit == 1 ? 3u << 30
+						: directions[2][bit - 1] ^ directions[2][bit - 2] ^ (directions[2][bit - 2] >> 2);
+				}
+
+				for (size_t dim = 0; dim < 3; ++dim)
+					for (uint32 byte = 0; byte < 4; ++byte)
+						for (uint32 value = 0; value < 256; ++value)
+							for (uint32 bit = 0; bit < 8; ++bit)
+								if (value & (1u << bit))
+									data[dim][byte][value] ^= directions[dim][byte * 8 + bit];
+			}
+
+			[[nodiscard]] constexpr uint32 operator()(size_t dim, uint32 index) const noexcept
+			{
+				return data[dim][0][index & 0xFFu] ^ data[dim][1][(index >> 8) & 0xFFu]
+					^ data[dim][2][(index >> 16) & 0xFFu] ^ data[dim][3][index >> 24];
+			}
+
+		public:
+			uint32 data[3][4][256];
+		};
+
+		inline constexpr SobolDirections SobolDirectionTable{};
+
+		[[nodiscard]] NO_ODR uint32 ReverseBits(uint32 n) noexcept
+		{
+			n = ((n >> 1) & 0x55555555u) | ((n & 0x55555555u) << 1);
+			n = ((n >> 2) & 0x33333333u) | ((n & 0x33333333u) << 2);
+			n = ((n >> 4) & 0x0F0F0F0Fu) | ((n & 0x0F0F0F0Fu) << 4);
+			n = ((n >> 8) & 0x00FF00FFu) | ((n & 0x00FF00FFu) << 8);
+			return (n >> 16) | (n << 16);
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorReverseBits(SIMD::VectorRegister<int> vec) noexcept
+		{
+			using namespace SIMD;
+			const auto swap = [](VectorRegister<int> n, VectorRegister<int> mask, auto shift)
+			{
+				constexpr int N = decltype(shift)::value;
+				return VectorOr(VectorAnd(VectorShiftRight<N>(n), mask), VectorShiftLeft<N>(VectorAnd(n, mask)));
+			};
+
+			vec = swap(vec, VectorLoad1(0x55555555), std::integral_constant<int, 1>{});
+			vec = swap(vec, VectorLoad1(0x33333333), std::integral_constant<int, 2>{});
+			vec = swap(vec, VectorLoad1(0x0F0F0F0F), std::integral_constant<int, 4>{});
+			vec = swap(vec, VectorLoad1(0x00FF00FF), std::integral_constant<int, 8>{});
+			return VectorOr(VectorShiftRight<16>(vec), VectorShiftLeft<16>(vec));
+		}
+
+		// Nested uniform (Owen) scramble by a hash applied to the reversed bits.
+		// Ref: Burley, "Practical Hash-based Owen Scrambling", JCGT 2020
+		[[nodiscard]] NO_ODR uint32 OwenScramble(uint32 n, uint32 seed) noexcept
+		{
+			n = ReverseBits(n) + seed;
+			n ^= n * 0x6C50B47Cu;
+			n ^= n * 0xB82F1E52u;
+			n ^= n * 0xC7AFE638u;
+			n ^= n * 0x8D22F6E6u;
+			return ReverseBits(n);
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<int> VECTOR_CALL VectorOwenScramble(SIMD::VectorRegister<int> vec, SIMD::VectorRegister<int> seed) noexcept
+		{
+			using namespace SIMD;
+			vec = VectorAdd(VectorReverseBits(vec), seed);
+			vec = VectorXor(vec, VectorMultiply(vec, VectorLoad1(static_cast<int>(0x6C50B47Cu))));
+			vec = VectorXor(vec, VectorMultiply(vec, VectorLoad1(static_cast<int>(0xB82F1E52u))));
+			vec = VectorXor(vec, VectorMultiply(vec, VectorLoad1(static_cast<int>(0xC7AFE638u))));
+			vec = VectorXor(vec, VectorMultiply(vec, VectorLoad1(static_cast<int>(0x8D22F6E6u))));
+			return VectorReverseBits(vec);
+		}
+
+		[[nodiscard]] NO_ODR float BitsToFloat(uint32 bits) noexcept
+		{
+			return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+		}
+
+		// Wraps values of [0, 2) back into [0, 1).
+		[[nodiscard]] NO_ODR float WrapUnit(float n) noexcept
+		{
+			return n >= 1.0f ? n - 1.0f : n;
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorWrapUnit(SIMD::VectorRegister<float> vec) noexcept
+		{
+			using namespace SIMD;
+			const auto one = VectorLoad1(1.0f);
+			return VectorSubtract(vec, VectorAnd(VectorGreaterEqual(vec, one), one));
+		}
+
+		// Writes the points from index on, generating four per step with sequence.GenerateBlock.
+		template <class Sequence, class T>
+		void FillSequence(const Sequence& sequence, uint32 index, T* out, size_t size) noexcept
+		{
+			static_assert(sizeof(T) == sizeof(float) * 4);
+			using namespace SIMD;
+
+			uint32 block = index / 4;
+			size_t skip = index % 4;
+
+			while (size > 0)
+			{
+				VectorRegister<float> lanes[4]{ Zero<float>, Zero<float>, Zero<float>, Zero<float> };
+				sequence.GenerateBlock(block++, lanes);
+				VectorTranspose(lanes);
+
+				if (skip == 0 && size >= 4)
+				{
+					for (size_t lane = 0; lane < 4; ++lane)
+						VectorStorePtr(lanes[lane], reinterpret_cast<float*>(out + lane));
+
+					out += 4;
+					size -= 4;
+					continue;
+				}
+
+				const size_t num = Min(4 - skip, size);
+				for (size_t lane = 0; lane < num; ++lane)
+					VectorStorePtr(lanes[skip + lane], reinterpret_cast<float*>(out + lane));
+
+				out += num;
+				size -= num;
+				skip = 0;
+			}
+		}
+	}
+
+	// Low-discrepancy point sets in [0, 1)^L. They share the Random<> interface, and the point
+	// at any index is computed directly, so workers can Seek to their own slice of a stream.
+	// A nonzero seed randomizes the sequence while keeping its stratification.
+
+	// Halton sequence in bases 2, 3 and 5, randomized by a toroidal shift.
+	template <size_t L>
+	class HaltonSequence final
+	{
+		static_assert(L == 2 || L == 3, "Only 2 and 3 dimensions are supported");
+
+	public:
+		using Seed = uint32;
+		using result_type = Vector<float, L>;
+
+	public:
+		explicit HaltonSequence(Seed inSeed = 0u) noexcept { SetSeed(inSeed); }
+
+		void SetSeed(Seed inSeed) noexcept
+		{
+			uint64 mixer = inSeed;
+			for (size_t i = 0; i < L; ++i)
+				shift[i] = inSeed == 0u ? 0.0f : Detail::BitsToFloat(static_cast<uint32>(Detail::SplitMix64(mixer)));
+			index = 0u;
+		}
+
+		void Seek(uint32 inIndex) noexcept { index = inIndex; }
+		[[nodiscard]] uint32 Tell() const noexcept { return index; }
+
+		result_type operator()() noexcept { return Get(index++); }
+
+		[[nodiscard]] result_type Get(uint32 idx) const noexcept
+		{
+			result_type ret;
+			ret[0] = Detail::WrapUnit(Detail::RadicalInverseTable<2>(idx) + shift[0]);
+			ret[1] = Detail::WrapUnit(Detail::RadicalInverseTable<3>(idx) + shift[1]);
+			if constexpr (L == 3)
+				ret[2] = Detail::WrapUnit(Detail::RadicalInverseTable<5>(idx) + shift[2]);
+			return ret;
+		}
+
+		void Fill(result_type* out, size_t size) noexcept
+		{
+			Detail::FillSequence(*this, index, out, size);
+			index += static_cast<uint32>(size);
+		}
+
+		// Points 4 * block to 4 * block + 3, one component per register.
+		void GenerateBlock(uint32 block, SIMD::VectorRegister<float>(&out)[4]) const noexcept
+		{
+			out[0] = Generate(Detail::RadicalInverseTable<2>, block * 4, shift[0]);
+			out[1] = Generate(Detail::RadicalInverseTable<3>, block * 4, shift[1]);
+			if constexpr (L == 3)
+				out[2] = Generate(Detail::RadicalInverseTable<5>, block * 4, shift[2]);
+		}
+
+	private:
+		template <uint32 Base>
+		[[nodiscard]] static SIMD::VectorRegister<float> Generate(const Detail::RadicalInverse<Base>& inverse, uint32 first, float inShift) noexcept
+		{
+			using namespace SIMD;
+			const uint32 low = first % inverse.Size;
+
+			// Four consecutive indices share their high digits unless they cross a table boundary.
+			VectorRegister<float> ret;
+			if (low + 4 <= inverse.Size)
+				ret = VectorAdd(VectorLoadPtrUnaligned(inverse.table + low), VectorLoad1(static_cast<float>(inverse.High(first / inverse.Size))));
+			else
+				ret = VectorLoad(inverse(first), inverse(first + 1), inverse(first + 2), inverse(first + 3));
+
+			return Detail::VectorWrapUnit(VectorAdd(ret, VectorLoad1(inShift)));
+		}
+
+	private:
+		float shift[L];
+		uint32 index = 0u;
+	};
+
+	// Sobol sequence with Owen scrambling. Every power-of-two prefix of a dimension stays stratified.
+	template <size_t L>
+	class SobolSequence final
+	{
+		static_assert(L == 2 || L == 3, "Only 2 and 3 dimensions are supported");
+
+	public:
+		using Seed = uint32;
+		using result_type = Vector<float, L>;
+
+	public:
+		explicit SobolSequence(Seed inSeed = 0u) noexcept { SetSeed(inSeed); }
+
+		void SetSeed(Seed inSeed) noexcept
+		{
+			uint64 mixer = inSeed;
+			scrambled = inSeed != 0u;
+			for (size_t i = 0; i < L; ++i)
+				scrambles[i] = static_cast<uint32>(Detail::SplitMix64(mixer));
+			index = 0u;
+		}
+
+		void Seek(uint32 inIndex) noexcept { index = inIndex; }
+		[[nodiscard]] uint32 Tell() const noexcept { return index; }
+
+		result_type operator()() noexcept { return Get(index++); }
+
+		[[nodiscard]] result_type Get(uint32 idx) const noexcept
+		{
+			result_type ret;
+			for (size_t i = 0; i < L; ++i)
+			{
+				const uint32 bits = Detail::SobolDirectionTable(i, idx);
+				ret[i] = Detail::BitsToFloat(scrambled ? Detail::OwenScramble(bits, scrambles[i]) : bits);
+			}
+			return ret;
+		}
+
+		void Fill(result_type* out, size_t size) noexcept
+		{
+			Detail::FillSequence(*this, index, out, size);
+			index += static_cast<uint32>(size);
+		}
+
+		// Points 4 * block to 4 * block + 3, one component per register.
+		// The sequence is linear over the bits of the index, so they are the point at 4 * block
+		// combined with the points 0 to 3.
+		void GenerateBlock(uint32 block, SIMD::VectorRegister<float>(&out)[4]) const noexcept
+		{
+			using namespace SIMD;
+			const Detail::UniformFloatConverter converter{ 0.0f, 1.0f };
+
+			for (size_t i = 0; i < L; ++i)
+			{
+				const auto low = VectorLoadPtrUnaligned(reinterpret_cast<const int*>(Detail::SobolDirectionTable.data[i][0]));
+
+				auto bits = VectorXor(VectorLoad1(static_cast<int>(Detail::SobolDirectionTable(i, block * 4))), low);
+				if (scrambled)
+					bits = Detail::VectorOwenScramble(bits, VectorLoad1(static_cast<int>(scrambles[i])));
+
+				out[i] = converter(bits);
+			}
+		}
+
+	private:
+		uint32 scrambles[L];
+		uint32 index = 0u;
+		bool scrambled = false;
+	};
+
+	// Additive recurrence on the generalized golden ratio, kept in 32 bit fixed point so that
+	// the points of large indices are as exact as the first ones.
+	// Ref: Roberts, "The Unreasonable Effectiveness of Quasirandom Sequences"
+	template <size_t L>
+	class RSequence final
+	{
+		static_assert(L == 2 || L == 3, "Only 2 and 3 dimensions are supported");
+
+	public:
+		using Seed = uint32;
+		using result_type = Vector<float, L>;
+
+	public:
+		explicit RSequence(Seed inSeed = 0u) noexcept { SetSeed(inSeed); }
+
+		void SetSeed(Seed inSeed) noexcept
+		{
+			uint64 mixer = inSeed;
+			for (size_t i = 0; i < L; ++i)
+				offsets[i] = 0x80000000u + (inSeed == 0u ? 0u : static_cast<uint32>(Detail::SplitMix64(mixer)));
+			index = 0u;
+		}
+
+		void Seek(uint32 inIndex) noexcept { index = inIndex; }
+		[[nodiscard]] uint32 Tell() const noexcept { return index; }
+
+		result_type operator()() noexcept { return Get(index++); }
+
+		[[nodiscard]] result_type Get(uint32 idx) const noexcept
+		{
+			result_type ret;
+			for (size_t i = 0; i < L; ++i)
+				ret[i] = Detail::BitsToFloat(offsets[i] + idx * Alpha[i]);
+			return ret;
+		}
+
+		// The recurrence is an addition modulo 2^32, so each point takes one register add.
+		void Fill(result_type* out, size_t size) noexcept
+		{
+			using namespace SIMD;
+			const Detail::UniformFloatConverter converter{ 0.0f, 1.0f };
+
+			alignas(16) int start[4]{}, step[4]{};
+			for (size_t i = 0; i < L; ++i)
+			{
+				start[i] = static_cast<int>(offsets[i] + index * Alpha[i]);
+				step[i] = static_cast<int>(Alpha[i]);
+			}
+
+			auto bits = VectorLoadPtr(start);
+			const auto stepReg = VectorLoadPtr(step);
+			for (size_t i = 0; i < size; ++i, bits = VectorAdd(bits, stepReg))
+				VectorStorePtr(converter(bits), out[i].data);
+
+			index += static_cast<uint32>(size);
+		}
+
+	private:
+		// Powers of 1 / g in 2^-32 units, where g is the positive root of x^(L + 1) = x + 1.
+		constexpr static uint32 Alpha[3]
+		{
+			L == 2 ? 0xC13FA9A9u : 0xD1B54A33u,
+			L == 2 ? 0x91E10DA6u : 0xABC98389u,
+			L == 2 ? 0u : 0x8CB92BA7u
+		};
+
+		uint32 offsets[L];
+		uint32 index = 0u;
+	};
+
+	using Vector2HaltonSequence = HaltonSequence<2>;
+	using Vector3HaltonSequence = HaltonSequence<3>;
+	using Vector2SobolSequence = SobolSequence<2>;
+	using Vector3SobolSequence = SobolSequence<3>;
+	using R2Sequence = RSequence<2>;
+	using R3Sequence = RSequence<3>;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "DualQuaternion.h"
+#include "Parallel.h"
+
+// Linear blend skinning over a Matrix4 palette, and chunked parallel skinning for either
+// palette. Vertex streams follow the dual quaternion kernels: four bone indices per vertex in
+// a row of indices, their weights in a Vector4 with unused slots taking a zero weight.
+namespace BSMath
+{
+	namespace Detail
+	{
+		// Small meshes are skinned on the calling thread alone.
+		constexpr size_t SkinningChunkSize = 1 << 12;
+
+		// The four bone matrices are summed row by row into registers, so each vertex
+		// costs one 4x4 blend and one row vector product whatever its normals.
+		template <bool HasNormals>
+		void SkinVertices(const Matrix4* bones, const uint16* indices, const Vector4* weights, const Vector3* positions,
+			const Vector3* normals, size_t size, Vector3* outPositions, Vector3* outNormals) noexcept
+		{
+			using namespace SIMD;
+			for (size_t i = 0; i < size; ++i)
+			{
+				const auto* index = indices + i * 4;
+				const auto weight = VectorLoadPtr(weights[i].data);
+
+				VectorRegister<float> rows[4];
+				const auto blend = [&](const Matrix4& bone, VectorRegister<float> boneWeight, auto isFirst)
+				{
+					for (size_t j = 0; j < 4; ++j)
+					{
+						const auto row = VectorMultiply(VectorLoadPtr(bone[j]), boneWeight);
+						if constexpr (decltype(isFirst)::value)
+							rows[j] = row;
+						else
+							rows[j] = VectorAdd(rows[j], row);
+					}
+				};
+
+				blend(bones[index[0]], VectorReplicate<Swizzle::X>(weight), std::true_type{});
+				blend(bones[index[1]], VectorReplicate<Swizzle::Y>(weight), std::false_type{});
+				blend(bones[index[2]], VectorReplicate<Swizzle::Z>(weight), std::false_type{});
+				blend(bones[index[3]], VectorReplicate<Swizzle::W>(weight), std::false_type{});
+
+				const auto position = VectorLoadPtr(positions[i].data);
+				auto result = VectorAdd(VectorMultiply(VectorReplicate<Swizzle::X>(position), rows[0]), rows[3]);
+				result = VectorAdd(result, VectorMultiply(VectorReplicate<Swizzle::Y>(position), rows[1]));
+				result = VectorAdd(result, VectorMultiply(VectorReplicate<Swizzle::Z>(position), rows[2]));
+				outPositions[i] = ToVector3(result);
+
+				if constexpr (HasNormals)
+				{
+					const auto normal = VectorLoadPtr(normals[i].data);
+					auto skinned = VectorMultiply(VectorReplicate<Swizzle::X>(normal), rows[0]);
+					skinned = VectorAdd(skinned, VectorMultiply(VectorReplicate<Swizzle::Y>(normal), rows[1]));
+					skinned = VectorAdd(skinned, VectorMultiply(VectorReplicate<Swizzle::Z>(normal), rows[2]));
+					skinned = VectorAnd(skinned, VectorCastFloat(VectorLoad(-1, -1, -1, 0)));
+					outNormals[i] = ToVector3(VectorMultiply(skinned, VectorInvSqrt(VectorQuaternionDot(skinned, skinned))));
+				}
+			}
+		}
+	}
+
+	// Normals are carried by the blended 3x3 and renormalized, which is exact for
+	// rigid and uniformly scaled bones. Each vertex's weights must not sum to zero.
+	NO_ODR void SkinVertices(const Matrix4* bones, const uint16* indices, const Vector4* weights,
+		const Vector3* positions, size_t size, Vector3* out) noexcept
+	{
+		Detail::SkinVertices<false>(bones, indices, weights, positions, nullptr, size, out, nullptr);
+	}
+
+	NO_ODR void SkinVertices(const Matrix4* bones, const uint16* indices, const Vector4* weights,
+		const Vector3* positions, const Vector3* normals, size_t size, Vector3* outPositions, Vector3* outNormals) noexcept
+	{
+		Detail::SkinVertices<true>(bones, indices, weights, positions, normals, size, outPositions, outNormals);
+	}
+
+	// SkinVertices split into contiguous chunks over taskNum tasks, hardware_concurrency when zero.
+	// Bone is Matrix4 or DualQuaternion, and the output matches a single call for any taskNum.
+	template <class Bone>
+	void ParallelSkinVertices(const Bone* bones, const uint16* indices, const Vector4* weights,
+		const Vector3* positions, size_t size, Vector3* out, size_t taskNum = 0)
+	{
+		Detail::ParallelChunks(size, Detail::SkinningChunkSize, taskNum, [&](size_t begin, size_t count)
+		{
+			SkinVertices(bones, indices + begin * 4, weights + begin, positions + begin, count, out + begin);
+		});
+	}
+
+	template <class Bone>
+	void ParallelSkinVertices(const Bone* bones, const uint16* indices, const Vector4* weights, const Vector3* positions,
+		const Vector3* normals, size_t size, Vector3* outPositions, Vector3* outNormals, size_t taskNum = 0)
+	{
+		Detail::ParallelChunks(size, Detail::SkinningChunkSize, taskNum, [&](size_t begin, size_t count)
+		{
+			SkinVertices(bones, indices + begin * 4, weights + begin, positions + begin, normals + begin,
+				count, outPositions + begin, outNormals + begin);
+		});
+	}
+}
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <vector>
+#include "Packet.h"
+
+namespace BSMath
+{
+	namespace Detail
+	{
+		struct GridSlot final
+		{
+			constexpr static uint32 Empty = 0xFFFFFFFFu;
+
+			int32 x, y, z;
+			uint32 cell;
+		};
+
+		[[nodiscard]] NO_ODR uint32 HashCell(int32 x, int32 y, int32 z) noexcept
+		{
+			uint64 hash = static_cast<uint32>(x) * 0x9E3779B97F4A7C15ull;
+			hash ^= static_cast<uint32>(y) * 0xC2B2AE3D27D4EB4Full;
+			hash ^= static_cast<uint32>(z) * 0x165667B19E3779F9ull;
+			hash ^= hash >> 32;
+			hash *= 0xD6E8FEB86659FD93ull;
+			return static_cast<uint32>(hash ^ (hash >> 32));
+		}
+	}
+
+	// Uniform grid over an unbounded space. Points are bucketed by cell with a counting sort,
+	// so each cell is a contiguous range of the point arrays and the open-addressed table only
+	// maps a cell to its range. Rebuilding reuses the previous storage.
+	class SpatialHashGrid final
+	{
+	public:
+		SpatialHashGrid() = default;
+
+		explicit SpatialHashGrid(float inCellSize) noexcept { SetCellSize(inCellSize); }
+
+		SpatialHashGrid(float inCellSize, const Vector3* points, size_t size)
+		{
+			SetCellSize(inCellSize);
+			Build(points, size);
+		}
+
+		// Takes effect on the next Build.
+		void SetCellSize(float inCellSize) noexcept
+		{
+			cellSize = inCellSize;
+			invCellSize = 1.0f / inCellSize;
+		}
+
+		void Build(const Vector3* points, size_t size);
+		void Clear() noexcept;
+
+		[[nodiscard]] IntVector3 GetCell(const Vector3& point) const noexcept;
+
+		// Calls func(index) for every point in the cell.
+		template <class Func>
+		void QueryCell(const IntVector3& cell, Func&& func) const;
+
+		// Calls func(index) for every point within radius of center.
+		template <class Func>
+		void Query(const Vector3& center, float radius, Func&& func) const;
+
+		[[nodiscard]] float GetCellSize() const noexcept { return cellSize; }
+		[[nodiscard]] size_t GetCellNum() const noexcept { return offsets.empty() ? 0 : offsets.size() - 1; }
+		[[nodiscard]] size_t GetSize() const noexcept { return indices.size(); }
+
+	private:
+		[[nodiscard]] const Detail::GridSlot* FindSlot(int32 x, int32 y, int32 z) const noexcept;
+
+		template <class Func>
+		void QueryRange(uint32 cell, const Vector3Packet& center, SIMD::VectorRegister<float> radiusSquared, Func&& func) const;
+
+	private:
+		std::vector<Detail::GridSlot> slots;
+		std::vector<uint32> offsets;
+		std::vector<uint32> indices;
+		std::vector<float> xs, ys, zs;
+		std::vector<uint32> pointCells;
+		float cellSize = 1.0f;
+		float invCellSize = 1.0f;
+	};
+
+	NO_ODR void SpatialHashGrid::Build(const Vector3* points, size_t size)
+	{
+		using namespace SIMD;
+
+		size_t capacity = 16;
+		while (capacity < size * 2) capacity <<= 1;
+		const size_t mask = capacity - 1;
+
+		slots.assign(capacity, Detail::GridSlot{ 0, 0, 0, Detail::GridSlot::Empty });
+		offsets.assign(size + 1, 0);
+		pointCells.resize(size);
+
+		const auto scale = VectorLoad1(invCellSize);
+		uint32 cellNum = 0;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			int key[4];
+			VectorStore(VectorFloorInt(VectorMultiply(VectorLoad(points[i].data), scale)), key);
+
+			size_t idx = Detail::HashCell(key[0], key[1], key[2]) & mask;
+			while (slots[idx].cell != Detail::GridSlot::Empty
+				&& (slots[idx].x != key[0] || slots[idx].y != key[1] || slots[idx].z != key[2]))
+				idx = (idx + 1) & mask;
+
+			if (slots[idx].cell == Detail::GridSlot::Empty)
+				slots[idx] = Detail::GridSlot{ key[0], key[1], key[2], cellNum++ };
+
+			pointCells[i] = slots[idx].cell;
+			++offsets[slots[idx].cell];
+		}
+
+		// Inclusive prefix sum gives the end of each cell, and the reverse scatter walks it back
+		// to the beginning while keeping points in input order within a cell.
+		offsets.resize(cellNum + 1);
+		for (uint32 cell = 1; cell <= cellNum; ++cell)
+			offsets[cell] += offsets[cell - 1];
+
+		indices.resize(size);
+		xs.resize(size);
+		ys.resize(size);
+		zs.resize(size);
+
+		for (size_t i = size; i-- > 0;)
+		{
+			const uint32 pos = --offsets[pointCells[i]];
+			indices[pos] = static_cast<uint32>(i);
+			xs[pos] = points[i].x;
+			ys[pos] = points[i].y;
+			zs[pos] = points[i].z;
+		}
+	}
+
+	NO_ODR void SpatialHashGrid::Clear() noexcept
+	{
+		slots.clear();
+		offsets.clear();
+		indices.clear();
+		xs.clear();
+		ys.clear();
+		zs.clear();
+	}
+
+	NO_ODR IntVector3 SpatialHashGrid::GetCell(const Vector3& point) const noexcept
+	{
+		using namespace SIMD;
+		int key[4];
+		VectorStore(VectorFloorInt(VectorMultiply(VectorLoad(point.data), VectorLoad1(invCellSize))), key);
+		return IntVector3{ key[0], key[1], key[2] };
+	}
+
+	NO_ODR const Detail::GridSlot* SpatialHashGrid::FindSlot(int32 x, int32 y, int32 z) const noexcept
+	{
+		if (slots.empty()) return nullptr;
+
+		const size_t mask = slots.size() - 1;
+		for (size_t idx = Detail::HashCell(x, y, z) & mask;; idx = (idx + 1) & mask)
+		{
+			const auto& slot = slots[idx];
+			if (slot.cell == Detail::GridSlot::Empty) return nullptr;
+			if (slot.x == x && slot.y == y && slot.z == z) return &slot;
+		}
+	}
+
+	template <class Func>
+	void SpatialHashGrid::QueryCell(const IntVector3& cell, Func&& func) const
+	{
+		const auto* slot = FindSlot(cell.x, cell.y, cell.z);
+		if (slot == nullptr) return;
+
+		for (uint32 pos = offsets[slot->cell]; pos < offsets[slot->cell + 1]; ++pos)
+			func(indices[pos]);
+	}
+
+	template <class Func>
+	void SpatialHashGrid::QueryRange(uint32 cell, const Vector3Packet& center, SIMD::VectorRegister<float> radiusSquared, Func&& func) const
+	{
+		using namespace SIMD;
+		const VectorSoA<const float, 3> soa{ xs.data(), ys.data(), zs.data() };
+		const uint32 end = offsets[cell + 1];
+
+		for (uint32 pos = offsets[cell]; pos < end; pos += Vector3Packet::Width)
+		{
+			const size_t num = Min<size_t>(end - pos, Vector3Packet::Width);
+			const auto diff = Vector3Packet::Load(soa, pos, num) - center;
+			const int hit = VectorMoveMask(VectorLessEqual(diff | diff, radiusSquared)) & ((1 << num) - 1);
+
+			for (size_t lane = 0; lane < num; ++lane)
+				if (hit & (1 << lane))
+					func(indices[pos + lane]);
+		}
+	}
+
+	template <class Func>
+	void SpatialHashGrid::Query(const Vector3& center, float radius, Func&& func) const
+	{
+		if (radius < 0.0f || slots.empty()) return;
+
+		const Vector3Packet centerPacket{ center };
+		const auto radiusSquared = SIMD::VectorLoad1(radius * radius);
+
+		// Cells past the int range, as huge or infinite radii reach, don't saturate in GetCell:
+		// the truncating conversion returns INT_MIN for overflow either way, so the cell box
+		// would be garbage. Such queries test every occupied cell instead.
+		constexpr float MaxCell = 2147483520.0f;
+		const float reach = radius * invCellSize;
+		const bool isBounded = Abs(center.x * invCellSize) + reach < MaxCell
+			&& Abs(center.y * invCellSize) + reach < MaxCell && Abs(center.z * invCellSize) + reach < MaxCell;
+
+		if (!isBounded)
+		{
+			for (const auto& slot : slots)
+				if (slot.cell != Detail::GridSlot::Empty)
+					QueryRange(slot.cell, centerPacket, radiusSquared, func);
+			return;
+		}
+
+		const auto lo = GetCell(Vector3{ center.x - radius, center.y - radius, center.z - radius });
+		const auto hi = GetCell(Vector3{ center.x + radius, center.y + radius, center.z + radius });
+
+		// Probing every covered cell costs more than walking the table once for large radii.
+		// The count is taken in double as the sides can span the whole int range.
+		const double rangeNum = (static_cast<double>(hi.x) - lo.x + 1.0)
+			* (static_cast<double>(hi.y) - lo.y + 1.0) * (static_cast<double>(hi.z) - lo.z + 1.0);
+		if (rangeNum > static_cast<double>(slots.size()))
+		{
+			for (const auto& slot : slots)
+			{
+				if (slot.cell == Detail::GridSlot::Empty) continue;
+				if (slot.x < lo.x || slot.x > hi.x || slot.y < lo.y || slot.y > hi.y || slot.z < lo.z || slot.z > hi.z) continue;
+				QueryRange(slot.cell, centerPacket, radiusSquared, func);
+			}
+			return;
+		}
+
+		for (int32 z = lo.z; z <= hi.z; ++z)
+			for (int32 y = lo.y; y <= hi.y; ++y)
+				for (int32 x = lo.x; x <= hi.x; ++x)
+					if (const auto* slot = FindSlot(x, y, z))
+						QueryRange(slot->cell, centerPacket, radiusSquared, func);
+	}
+}
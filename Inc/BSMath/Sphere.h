@@ -0,0 +1,87 @@
+#pragma once
+
+#include "AABB.h"
+#include "Packet.h"
+
+namespace BSMath
+{
+	// xyz is the center and w is the radius.
+	struct alignas(16) Sphere final
+	{
+	public:
+		constexpr Sphere() noexcept : vec() {}
+
+		explicit constexpr Sphere(const Vector4& inVec) noexcept : vec(inVec) {}
+
+		explicit constexpr Sphere(const Vector3& center, float radius) noexcept
+			: vec(center.x, center.y, center.z, radius) {}
+
+		explicit Sphere(const AABB& box) noexcept
+			: Sphere(box.GetCenter(), box.GetExtent().Length()) {}
+
+		[[nodiscard]] Vector3 GetCenter() const noexcept { return Vector3{ vec.x, vec.y, vec.z }; }
+		[[nodiscard]] constexpr float GetRadius() const noexcept { return vec.w; }
+
+		[[nodiscard]] float SignedDistance(const Vector3& point) const noexcept
+		{
+			return Vector3::Distance(point, GetCenter()) - vec.w;
+		}
+
+		[[nodiscard]] Vector3 Project(const Vector3& point) const noexcept
+		{
+			const auto center = GetCenter();
+			return center + Vector3::GetNormal(point - center) * vec.w;
+		}
+
+		[[nodiscard]] bool IsInside(const Vector3& point) const noexcept
+		{
+			return Vector3::DistanceSquared(point, GetCenter()) <= vec.w * vec.w;
+		}
+
+		[[nodiscard]] bool Intersect(const Sphere& other) const noexcept
+		{
+			const float radius = vec.w + other.vec.w;
+			return Vector3::DistanceSquared(GetCenter(), other.GetCenter()) <= radius * radius;
+		}
+
+		[[nodiscard]] bool Intersect(const AABB& box) const noexcept
+		{
+			const auto center = GetCenter();
+			return Vector3::DistanceSquared(center, Clamp(center, box.min, box.max)) <= vec.w * vec.w;
+		}
+
+		[[nodiscard]] constexpr float& operator[](size_t idx) noexcept { return vec[idx]; }
+		[[nodiscard]] constexpr float operator[](size_t idx) const noexcept { return vec[idx]; }
+
+	public:
+		Vector4 vec;
+	};
+
+	// Global Operators
+
+	[[nodiscard]] NO_ODR bool operator==(const Sphere& lhs, const Sphere& rhs) noexcept { return lhs.vec == rhs.vec; }
+	[[nodiscard]] NO_ODR bool operator!=(const Sphere& lhs, const Sphere& rhs) noexcept { return !(lhs == rhs); }
+
+	// Batch Functions
+
+	NO_ODR void SignedDistances(const Sphere& sphere, const VectorSoA<const float, 3>& points,
+		size_t size, float* outDistances) noexcept
+	{
+		using namespace SIMD;
+		const Vector3Packet center{ sphere.GetCenter() };
+		const auto radius = VectorLoad1(sphere.GetRadius());
+
+		const auto getDistance = [&](const Vector3Packet& point)
+		{
+			const auto diff = point - center;
+			return VectorSubtract(VectorSqrt(diff | diff), radius);
+		};
+
+		size_t idx = 0;
+		for (; idx + Vector3Packet::Width <= size; idx += Vector3Packet::Width)
+			VectorStorePtrUnaligned(getDistance(Vector3Packet::Load(points, idx)), outDistances + idx);
+
+		if (idx < size)
+			VectorStorePtr(getDistance(Vector3Packet::Load(points, idx, size - idx)), outDistances + idx, size - idx);
+	}
+}
@@ -0,0 +1,291 @@
+#pragma once
+
+#include "Matrix.h"
+#include "Quaternion.h"
+
+// Translation, rotation and scale kept apart, so that hierarchies compose and invert with
+// quaternion products instead of 4x4 multiplies. Points are scaled, rotated and then translated.
+// Matrices follow the row vector convention of Creator::Matrix. Like Quaternion and DualQuaternion,
+// lhs * rhs applies rhs first, so it equals rhs.ToMatrix4() * lhs.ToMatrix4().
+namespace BSMath
+{
+	struct alignas(16) Transform final
+	{
+	public:
+		static const Transform Identity;
+
+	public:
+		constexpr Transform() noexcept : translation(), rotation(), scale(1.0f, 1.0f, 1.0f) {}
+
+		explicit constexpr Transform(const Vector3& inTranslation, const Quaternion& inRotation, const Vector3& inScale) noexcept
+			: translation(inTranslation), rotation(inRotation), scale(inScale) {}
+
+		[[nodiscard]] Vector3 TransformPoint(const Vector3& point) const noexcept;
+		[[nodiscard]] Vector3 TransformDirection(const Vector3& direction) const noexcept;
+
+		// Exact for any non-zero scale, unlike GetInvert.
+		[[nodiscard]] Vector3 InverseTransformPoint(const Vector3& point) const noexcept;
+		[[nodiscard]] Vector3 InverseTransformDirection(const Vector3& direction) const noexcept;
+
+		// A TRS can't hold the shear of a non-uniform scale under rotation,
+		// so this and composing are exact only for uniform scales.
+		[[nodiscard]] Transform GetInvert() const noexcept;
+
+		[[nodiscard]] Matrix4 ToMatrix4() const noexcept;
+
+		Transform& operator*=(const Transform& other) noexcept;
+
+	public:
+		Vector3 translation;
+		Quaternion rotation;
+		Vector3 scale;
+	};
+
+	inline const Transform Transform::Identity{};
+
+	namespace Detail
+	{
+		// (lhs * rhs.yzx - lhs.yzx * rhs).yzx, a shuffle less than the usual form.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorCross(SIMD::VectorRegister<float> lhs, SIMD::VectorRegister<float> rhs) noexcept
+		{
+			using namespace SIMD;
+			const auto first = VectorMultiply(lhs, VectorSwizzle<Swizzle::Y, Swizzle::Z, Swizzle::X, Swizzle::W>(rhs));
+			const auto second = VectorMultiply(VectorSwizzle<Swizzle::Y, Swizzle::Z, Swizzle::X, Swizzle::W>(lhs), rhs);
+			return VectorSwizzle<Swizzle::Y, Swizzle::Z, Swizzle::X, Swizzle::W>(VectorSubtract(first, second));
+		}
+
+		// The dot product in every lane, in two shuffles where VectorHadd takes six each.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorQuaternionDot(SIMD::VectorRegister<float> lhs, SIMD::VectorRegister<float> rhs) noexcept
+		{
+			using namespace SIMD;
+			auto ret = VectorMultiply(lhs, rhs);
+			ret = VectorAdd(ret, VectorSwizzle<Swizzle::Y, Swizzle::X, Swizzle::W, Swizzle::Z>(ret));
+			return VectorAdd(ret, VectorSwizzle<Swizzle::Z, Swizzle::W, Swizzle::X, Swizzle::Y>(ret));
+		}
+
+		// v + 2w(q x v) + 2q x (q x v), cheaper than two quaternion products.
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorRotate(SIMD::VectorRegister<float> quat, SIMD::VectorRegister<float> vec) noexcept
+		{
+			using namespace SIMD;
+			auto cross = VectorCross(quat, vec);
+			cross = VectorAdd(cross, cross);
+			return VectorAdd(VectorAdd(vec, VectorMultiply(VectorReplicate<Swizzle::W>(quat), cross)), VectorCross(quat, cross));
+		}
+
+		[[nodiscard]] NO_ODR SIMD::VectorRegister<float> VECTOR_CALL VectorConjugate(SIMD::VectorRegister<float> quat) noexcept
+		{
+			using namespace SIMD;
+			return VectorXor(quat, VectorLoad(-0.0f, -0.0f, -0.0f, 0.0f));
+		}
+
+		// The padding lane is zeroed like a constructed Vector.
+		[[nodiscard]] NO_ODR Vector3 VECTOR_CALL ToVector3(SIMD::VectorRegister<float> vec) noexcept
+		{
+			using namespace SIMD;
+			Vector3 ret;
+			VectorStorePtr(VectorAnd(vec, VectorCastFloat(VectorLoad(-1, -1, -1, 0))), ret.data);
+			return ret;
+		}
+
+		// lhs * rhs, applying rhs first. Registers are loaded before storing, so out may alias either operand.
+		NO_ODR void ComposeTransforms(const Transform& lhs, const Transform& rhs, Transform& out) noexcept
+		{
+			using namespace SIMD;
+			const auto lhsRotation = VectorLoadPtr(&lhs.rotation.x);
+			const auto lhsScale = VectorLoadPtr(lhs.scale.data);
+			const auto translation = VectorAdd(VectorRotate(lhsRotation, VectorMultiply(VectorLoadPtr(rhs.translation.data), lhsScale)), VectorLoadPtr(lhs.translation.data));
+			const auto rotation = VectorQuaternionMultiply(lhsRotation, VectorLoadPtr(&rhs.rotation.x));
+			const auto scale = VectorMultiply(VectorLoadPtr(rhs.scale.data), lhsScale);
+
+			out.translation = ToVector3(translation);
+			VectorStorePtr(rotation, &out.rotation.x);
+			out.scale = ToVector3(scale);
+		}
+
+		// Translation and scale are linear, and the rotation is normalized along the shorter arc.
+		NO_ODR void LerpTransforms(const Transform& a, const Transform& b, float t, Transform& out) noexcept
+		{
+			using namespace SIMD;
+			const auto ratio = VectorLoad1(t);
+			const auto lerp = [ratio](VectorRegister<float> lhs, VectorRegister<float> rhs)
+			{
+				return VectorAdd(lhs, VectorMultiply(VectorSubtract(rhs, lhs), ratio));
+			};
+
+			const auto lhsRotation = VectorLoadPtr(&a.rotation.x);
+			auto rhsRotation = VectorLoadPtr(&b.rotation.x);
+			const auto cosine = VectorQuaternionDot(lhsRotation, rhsRotation);
+			rhsRotation = VectorXor(rhsRotation, VectorAnd(cosine, VectorLoad1(-0.0f)));
+
+			auto rotation = lerp(lhsRotation, rhsRotation);
+			rotation = VectorMultiply(rotation, VectorInvSqrt(VectorQuaternionDot(rotation, rotation)));
+
+			out.translation = ToVector3(lerp(VectorLoadPtr(a.translation.data), VectorLoadPtr(b.translation.data)));
+			VectorStorePtr(rotation, &out.rotation.x);
+			out.scale = ToVector3(lerp(VectorLoadPtr(a.scale.data), VectorLoadPtr(b.scale.data)));
+		}
+	}
+
+	NO_ODR Vector3 Transform::TransformPoint(const Vector3& point) const noexcept
+	{
+		using namespace SIMD;
+		const auto scaled = VectorMultiply(VectorLoadPtr(point.data), VectorLoadPtr(scale.data));
+		return Detail::ToVector3(VectorAdd(Detail::VectorRotate(VectorLoadPtr(&rotation.x), scaled), VectorLoadPtr(translation.data)));
+	}
+
+	NO_ODR Vector3 Transform::TransformDirection(const Vector3& direction) const noexcept
+	{
+		using namespace SIMD;
+		const auto scaled = VectorMultiply(VectorLoadPtr(direction.data), VectorLoadPtr(scale.data));
+		return Detail::ToVector3(Detail::VectorRotate(VectorLoadPtr(&rotation.x), scaled));
+	}
+
+	NO_ODR Vector3 Transform::InverseTransformPoint(const Vector3& point) const noexcept
+	{
+		using namespace SIMD;
+		const auto translated = VectorSubtract(VectorLoadPtr(point.data), VectorLoadPtr(translation.data));
+		const auto rotated = Detail::VectorRotate(Detail::VectorConjugate(VectorLoadPtr(&rotation.x)), translated);
+		return Detail::ToVector3(VectorDivide(rotated, VectorLoadPtr(scale.data)));
+	}
+
+	NO_ODR Vector3 Transform::InverseTransformDirection(const Vector3& direction) const noexcept
+	{
+		using namespace SIMD;
+		const auto rotated = Detail::VectorRotate(Detail::VectorConjugate(VectorLoadPtr(&rotation.x)), VectorLoadPtr(direction.data));
+		return Detail::ToVector3(VectorDivide(rotated, VectorLoadPtr(scale.data)));
+	}
+
+	NO_ODR Transform Transform::GetInvert() const noexcept
+	{
+		using namespace SIMD;
+		const auto inverseRotation = Detail::VectorConjugate(VectorLoadPtr(&rotation.x));
+		const auto inverseScale = VectorDivide(VectorLoad1(1.0f), VectorLoadPtr(scale.data));
+		const auto inverseTranslation = VectorMultiply(Detail::VectorRotate(inverseRotation, VectorNegate(VectorLoadPtr(translation.data))), inverseScale);
+
+		Transform ret;
+		ret.translation = Detail::ToVector3(inverseTranslation);
+		VectorStorePtr(inverseRotation, &ret.rotation.x);
+		ret.scale = Detail::ToVector3(inverseScale);
+		return ret;
+	}
+
+	NO_ODR Matrix4 Transform::ToMatrix4() const noexcept
+	{
+		// Each row is a rotated basis vector times its scale.
+		const float x2 = rotation.x + rotation.x, y2 = rotation.y + rotation.y, z2 = rotation.z + rotation.z;
+		const float xx = rotation.x * x2, xy = rotation.x * y2, xz = rotation.x * z2;
+		const float yy = rotation.y * y2, yz = rotation.y * z2, zz = rotation.z * z2;
+		const float wx = rotation.w * x2, wy = rotation.w * y2, wz = rotation.w * z2;
+
+		return Matrix4
+		{
+			(1.0f - (yy + zz)) * scale.x,         (xy + wz) * scale.x,         (xz - wy) * scale.x, 0.0f,
+			        (xy - wz) * scale.y, (1.0f - (xx + zz)) * scale.y,         (yz + wx) * scale.y, 0.0f,
+			        (xz + wy) * scale.z,         (yz - wx) * scale.z, (1.0f - (xx + yy)) * scale.z, 0.0f,
+			              translation.x,               translation.y,               translation.z, 1.0f
+		};
+	}
+
+	NO_ODR Transform& Transform::operator*=(const Transform& other) noexcept
+	{
+		Detail::ComposeTransforms(*this, other, *this);
+		return *this;
+	}
+
+	// Global Operators
+
+	[[nodiscard]] NO_ODR bool operator==(const Transform& lhs, const Transform& rhs) noexcept
+	{
+		return lhs.translation == rhs.translation && lhs.rotation == rhs.rotation && lhs.scale == rhs.scale;
+	}
+
+	[[nodiscard]] NO_ODR bool operator!=(const Transform& lhs, const Transform& rhs) noexcept { return !(lhs == rhs); }
+
+	[[nodiscard]] NO_ODR Transform operator*(const Transform& lhs, const Transform& rhs) noexcept
+	{
+		return Transform{ lhs } *= rhs;
+	}
+
+	// Global Functions
+
+	[[nodiscard]] NO_ODR bool IsNearlyEqual(const Transform& lhs, const Transform& rhs, float tolerance = Epsilon) noexcept
+	{
+		return IsNearlyEqual(lhs.translation, rhs.translation, tolerance)
+			&& IsNearlyEqual(lhs.rotation, rhs.rotation, tolerance)
+			&& IsNearlyEqual(lhs.scale, rhs.scale, tolerance);
+	}
+
+	[[nodiscard]] NO_ODR Transform Lerp(const Transform& a, const Transform& b, float t) noexcept
+	{
+		Transform ret;
+		Detail::LerpTransforms(a, b, t, ret);
+		return ret;
+	}
+
+	// Batch Functions
+
+	NO_ODR void Compose(const Transform* lhs, const Transform* rhs, size_t size, Transform* out) noexcept
+	{
+		for (size_t i = 0; i < size; ++i)
+			Detail::ComposeTransforms(lhs[i], rhs[i], out[i]);
+	}
+
+	// World is parent world * local. Parents come before their children, and roots have a negative parent.
+	NO_ODR void ToWorld(const Transform* locals, const int32* parents, size_t size, Transform* out) noexcept
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (parents[i] < 0)
+				out[i] = locals[i];
+			else
+				Detail::ComposeTransforms(out[parents[i]], locals[i], out[i]);
+		}
+	}
+
+	NO_ODR void Lerp(const Transform* a, const Transform* b, float t, size_t size, Transform* out) noexcept
+	{
+		for (size_t i = 0; i < size; ++i)
+			Detail::LerpTransforms(a[i], b[i], t, out[i]);
+	}
+
+	NO_ODR void ToMatrices(const Transform* transforms, size_t size, Matrix4* out) noexcept
+	{
+		for (size_t i = 0; i < size; ++i)
+			out[i] = transforms[i].ToMatrix4();
+	}
+
+	namespace Detail
+	{
+		// Transforms by the rows of the matrix, which costs less per point than the quaternion.
+		template <bool HasTranslation>
+		void TransformVectors(const Transform& transform, const Vector3* vecs, size_t size, Vector3* out) noexcept
+		{
+			using namespace SIMD;
+			const auto matrix = transform.ToMatrix4();
+			const auto row0 = VectorLoadPtr(matrix[0]), row1 = VectorLoadPtr(matrix[1]), row2 = VectorLoadPtr(matrix[2]);
+			const auto row3 = VectorLoadPtr(transform.translation.data);
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				const auto vec = VectorLoadPtr(vecs[i].data);
+				auto result = VectorMultiply(VectorReplicate<Swizzle::X>(vec), row0);
+				result = VectorAdd(result, VectorMultiply(VectorReplicate<Swizzle::Y>(vec), row1));
+				result = VectorAdd(result, VectorMultiply(VectorReplicate<Swizzle::Z>(vec), row2));
+				if constexpr (HasTranslation)
+					result = VectorAdd(result, row3);
+
+				out[i] = ToVector3(result);
+			}
+		}
+	}
+
+	NO_ODR void TransformPoints(const Transform& transform, const Vector3* points, size_t size, Vector3* out) noexcept
+	{
+		Detail::TransformVectors<true>(transform, points, size, out);
+	}
+
+	NO_ODR void TransformDirections(const Transform& transform, const Vector3* directions, size_t size, Vector3* out) noexcept
+	{
+		Detail::TransformVectors<false>(transform, directions, size, out);
+	}
+}
@@ -495,7 +495,14 @@ namespace BSMath
 
 	// Vector's Hash
 	template <class T, size_t L>
-	struct Hash<Vector<T, L>> final : public HashRange<Vector<T, L>, sizeof(T) * L> {};
+	struct Hash<Vector<T, L>> final : public std::conditional_t<std::is_floating_point_v<T>,
+		FloatHashRange<Vector<T, L>, L>, HashRange<Vector<T, L>, sizeof(T) * L>> {};
+
+	template <size_t L>
+	struct QuantizedHash<Vector<float, L>> final : public QuantizedHashRange<Vector<float, L>, L>
+	{
+		using QuantizedHashRange<Vector<float, L>, L>::QuantizedHashRange;
+	};
 
 	// Vector's Random
 	template <class T, size_t L>
@@ -528,12 +535,24 @@ namespace BSMath
 				ret[i] = dist(engine);
 			return ret;
 		}
+
+		template <class Engine>
+		void Fill(Engine& engine, result_type* out, size_t size, const param_type& params = param_type{})
+		{
+			// Every vector spans a whole register, so a SIMD engine fills the padding lanes too.
+			static_assert(sizeof(result_type) == sizeof(T) * 4);
+
+			if constexpr (Detail::IsVectorEngine<Engine>::value)
+				engine.FillUniform(reinterpret_cast<T*>(out), size * 4, params.a(), params.b());
+			else
+				std::generate_n(out, size, [&] { return (*this)(engine, params); });
+		}
 	};
 
-	using Vector2Random = Random<Vector2, std::mt19937, VectorDistribution<float, 2>>;
-	using IntVector2Random = Random<IntVector2, std::mt19937, VectorDistribution<int, 2>>;
-	using Vector3Random = Random<Vector3, std::mt19937, VectorDistribution<float, 3>>;
-	using IntVector3Random = Random<IntVector3, std::mt19937, VectorDistribution<int, 3>>;
-	using Vector4Random = Random<Vector4, std::mt19937, VectorDistribution<float, 4>>;
-	using IntVector4Random = Random<IntVector4, std::mt19937, VectorDistribution<int, 4>>;
+	using Vector2Random = Random<Vector2, DefaultRandomEngine, VectorDistribution<float, 2>>;
+	using IntVector2Random = Random<IntVector2, DefaultRandomEngine, VectorDistribution<int, 2>>;
+	using Vector3Random = Random<Vector3, DefaultRandomEngine, VectorDistribution<float, 3>>;
+	using IntVector3Random = Random<IntVector3, DefaultRandomEngine, VectorDistribution<int, 3>>;
+	using Vector4Random = Random<Vector4, DefaultRandomEngine, VectorDistribution<float, 4>>;
+	using IntVector4Random = Random<IntVector4, DefaultRandomEngine, VectorDistribution<int, 4>>;
 }
@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+#include "BSMath/AABB.h"
+
+using namespace BSMath;
+
+TEST(AABBTest, Constructor)
+{
+	const Vector3 points[3]{ Vector3{ 1.0f, -2.0f, 3.0f }, Vector3{ -1.0f, 2.0f, 0.0f }, Vector3{ 0.0f, 0.0f, -3.0f } };
+	const AABB box{ points, 3 };
+	const AABB target{ Vector3{ -1.0f, -2.0f, -3.0f }, Vector3{ 1.0f, 2.0f, 3.0f } };
+
+	EXPECT_EQ(box, target);
+	EXPECT_FALSE(AABB::Empty.IsValid());
+	EXPECT_EQ(AABB::Empty + target, target);
+}
+
+TEST(AABBTest, Size)
+{
+	const AABB box{ Vector3{ 0.0f, 0.0f, 0.0f }, Vector3{ 2.0f, 4.0f, 6.0f } };
+
+	EXPECT_EQ(box.GetCenter(), (Vector3{ 1.0f, 2.0f, 3.0f }));
+	EXPECT_EQ(box.GetExtent(), (Vector3{ 1.0f, 2.0f, 3.0f }));
+	EXPECT_EQ(box.GetSize(), (Vector3{ 2.0f, 4.0f, 6.0f }));
+	EXPECT_NEAR(box.SurfaceArea(), 88.0f, Epsilon);
+}
+
+TEST(AABBTest, Intersect)
+{
+	const AABB box{ -Vector3::One, Vector3::One };
+
+	EXPECT_TRUE(box.IsInside(Vector3::Zero));
+	EXPECT_TRUE(box.IsInside(Vector3::One));
+	EXPECT_FALSE(box.IsInside(Vector3::One * 2.0f));
+
+	EXPECT_TRUE(box.Intersect(AABB{ Vector3::Zero, Vector3::One * 2.0f }));
+	EXPECT_FALSE(box.Intersect(AABB{ Vector3::One * 2.0f, Vector3::One * 3.0f }));
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Bvh.h"
+
+using namespace BSMath;
+
+namespace
+{
+	std::vector<AABB> MakeBoxes(size_t size)
+	{
+		std::mt19937 engine{ 0 };
+		std::uniform_real_distribution<float> pos{ -100.0f, 100.0f };
+		std::uniform_real_distribution<float> extent{ 0.1f, 2.0f };
+
+		std::vector<AABB> boxes(size);
+		for (auto& box : boxes)
+		{
+			const Vector3 center{ pos(engine), pos(engine), pos(engine) };
+			const Vector3 half{ extent(engine), extent(engine), extent(engine) };
+			box.Set(center - half, center + half);
+		}
+		return boxes;
+	}
+}
+
+TEST(BvhTest, Build)
+{
+	const auto boxes = MakeBoxes(40000);
+	const Bvh bvh{ boxes.data(), boxes.size() };
+
+	auto indices = bvh.GetIndices();
+	std::sort(indices.begin(), indices.end());
+	for (size_t i = 0; i < indices.size(); ++i)
+		EXPECT_EQ(indices[i], i);
+
+	EXPECT_EQ(Bvh{}.Raycast(Ray{}, [](uint32) { return 0.0f; }), Infinity);
+
+	const Bvh single{ boxes.data(), 1 };
+	EXPECT_EQ(single.GetNodes().size(), 1);
+}
+
+TEST(BvhTest, Raycast)
+{
+	const auto boxes = MakeBoxes(40000);
+	const Bvh bvh{ boxes.data(), boxes.size() };
+
+	std::mt19937 engine{ 1 };
+	std::uniform_real_distribution<float> dist{ -1.0f, 1.0f };
+
+	for (size_t i = 0; i < 64; ++i)
+	{
+		const Ray ray{ Vector3::Zero, Vector3{ dist(engine), dist(engine), dist(engine) } };
+
+		float expected = Infinity;
+		for (const auto& box : boxes)
+			expected = Min(expected, ray.Intersect(box));
+
+		uint32 index = 0;
+		const float result = bvh.Raycast(ray, [&](uint32 idx) { return ray.Intersect(boxes[idx]); }, &index);
+		EXPECT_EQ(result, expected);
+
+		if (result != Infinity)
+		{
+			EXPECT_EQ(ray.Intersect(boxes[index]), result);
+		}
+	}
+}
+
+TEST(BvhTest, Query)
+{
+	const auto boxes = MakeBoxes(40000);
+	const Bvh bvh{ boxes.data(), boxes.size() };
+	const AABB query{ Vector3{ -10.0f, -20.0f, -5.0f }, Vector3{ 15.0f, 10.0f, 5.0f } };
+
+	std::vector<uint32> expected;
+	for (uint32 i = 0; i < boxes.size(); ++i)
+		if (query.Intersect(boxes[i]))
+			expected.push_back(i);
+
+	std::vector<uint32> result;
+	bvh.Query(query, [&](uint32 idx)
+	{
+		if (query.Intersect(boxes[idx]))
+			result.push_back(idx);
+	});
+	std::sort(result.begin(), result.end());
+
+	EXPECT_FALSE(expected.empty());
+	EXPECT_EQ(result, expected);
+}
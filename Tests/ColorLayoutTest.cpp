@@ -0,0 +1,87 @@
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/ColorLayout.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	template <ColorLayout Layout>
+	std::vector<PackedColor<Layout>> MakePackedColors(size_t size, uint32 seed)
+	{
+		const auto colors = MakeColors(size, seed);
+		return std::vector<PackedColor<Layout>>(colors.begin(), colors.end());
+	}
+
+	template <ColorLayout From, ColorLayout To>
+	void CheckConvert()
+	{
+		for (size_t size = 0; size < 23; ++size)
+		{
+			const auto colors = MakePackedColors<From>(size, static_cast<uint32>(size));
+			std::vector<PackedColor<To>> out(size);
+			ConvertLayout(colors.data(), size, out.data());
+
+			for (size_t i = 0; i < size; ++i)
+				EXPECT_EQ(out[i], PackedColor<To>{ colors[i].ToColor() });
+		}
+	}
+
+	template <ColorLayout From>
+	void CheckConvertFrom()
+	{
+		CheckConvert<From, ColorLayout::ARGB>();
+		CheckConvert<From, ColorLayout::RGBA>();
+		CheckConvert<From, ColorLayout::BGRA>();
+		CheckConvert<From, ColorLayout::ABGR>();
+	}
+}
+
+TEST(ColorLayoutTest, Layout)
+{
+	const RGBA8 rgba{ 1, 2, 3, 4 };
+	const BGRA8 bgra{ 1, 2, 3, 4 };
+	const ARGB8 argb{ Color{ 1, 2, 3, 4 } };
+	const uint8 rgbaBytes[]{ 1, 2, 3, 4 }, bgraBytes[]{ 3, 2, 1, 4 }, argbBytes[]{ 4, 1, 2, 3 };
+
+	EXPECT_EQ(std::memcmp(&rgba, rgbaBytes, 4), 0);
+	EXPECT_EQ(std::memcmp(&bgra, bgraBytes, 4), 0);
+	EXPECT_EQ(std::memcmp(&argb, argbBytes, 4), 0);
+	const Color color{ 1, 2, 3, 4 };
+	EXPECT_EQ(std::memcmp(&argb, &color, 4), 0);
+	EXPECT_EQ(bgra.ToColor(), (Color{ 1, 2, 3, 4 }));
+	EXPECT_EQ(RGBA8{}.ToColor(), Color::White);
+}
+
+TEST(ColorLayoutTest, Convert)
+{
+	CheckConvertFrom<ColorLayout::ARGB>();
+	CheckConvertFrom<ColorLayout::RGBA>();
+	CheckConvertFrom<ColorLayout::BGRA>();
+	CheckConvertFrom<ColorLayout::ABGR>();
+
+	// In place.
+	auto colors = MakePackedColors<ColorLayout::RGBA>(13, 1u);
+	const auto expected = colors;
+	auto* bgra = reinterpret_cast<BGRA8*>(colors.data());
+	ConvertLayout(colors.data(), colors.size(), bgra);
+	for (size_t i = 0; i < colors.size(); ++i)
+		EXPECT_EQ(bgra[i].ToColor(), expected[i].ToColor());
+}
+
+TEST(ColorLayoutTest, Colors)
+{
+	const auto colors = MakePackedColors<ColorLayout::BGRA>(37, 2u);
+	std::vector<Color> unpacked(colors.size());
+	ToColors(colors.data(), colors.size(), unpacked.data());
+
+	for (size_t i = 0; i < colors.size(); ++i)
+		EXPECT_EQ(unpacked[i], colors[i].ToColor());
+
+	std::vector<BGRA8> packed(colors.size());
+	FromColors(unpacked.data(), unpacked.size(), packed.data());
+	EXPECT_EQ(packed, colors);
+}
@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/ColorSpace.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	struct YCbCrReference final
+	{
+		explicit YCbCrReference(YCbCrFormat format)
+		{
+			const bool isBT709 = format == YCbCrFormat::BT709 || format == YCbCrFormat::BT709Full;
+			const bool isFull = format == YCbCrFormat::BT601Full || format == YCbCrFormat::BT709Full;
+			kr = isBT709 ? 0.2126 : 0.299;
+			kb = isBT709 ? 0.0722 : 0.114;
+			yScale = isFull ? 1.0 : 219.0 / 255.0;
+			cScale = isFull ? 1.0 : 224.0 / 255.0;
+			yOffset = isFull ? 0.0 : 16.0;
+		}
+
+		static int Round(double n)
+		{
+			return std::clamp(static_cast<int>(std::floor(n + 0.5)), 0, 255);
+		}
+
+		int Y(const Color& c) const { return Round(yOffset + yScale * Luma(c)); }
+		int Cb(const Color& c) const { return Round(128.0 + cScale * (c.b - Luma(c)) / (2.0 * (1.0 - kb))); }
+		int Cr(const Color& c) const { return Round(128.0 + cScale * (c.r - Luma(c)) / (2.0 * (1.0 - kr))); }
+
+		Color ToRGB(const YCbCrColor& c) const
+		{
+			const double y = (c.y - yOffset) / yScale, cb = (c.cb - 128.0) / cScale, cr = (c.cr - 128.0) / cScale;
+			const double r = y + 2.0 * (1.0 - kr) * cr, b = y + 2.0 * (1.0 - kb) * cb;
+			const double g = (y - kr * r - kb * b) / (1.0 - kr - kb);
+			return Color{ static_cast<uint8>(Round(r)), static_cast<uint8>(Round(g)), static_cast<uint8>(Round(b)), c.a };
+		}
+
+		double Luma(const Color& c) const { return kr * c.r + (1.0 - kr - kb) * c.g + kb * c.b; }
+
+		double kr, kb, yScale, cScale, yOffset;
+	};
+
+	constexpr YCbCrFormat Formats[]{ YCbCrFormat::BT601, YCbCrFormat::BT709, YCbCrFormat::BT601Full, YCbCrFormat::BT709Full };
+
+	void ExpectNear(const HSVColor& lhs, const HSVColor& rhs)
+	{
+		EXPECT_NEAR(lhs.h, rhs.h, 1e-3f);
+		EXPECT_NEAR(lhs.s, rhs.s, 1e-5f);
+		EXPECT_NEAR(lhs.v, rhs.v, 1e-5f);
+		EXPECT_FLOAT_EQ(lhs.a, rhs.a);
+	}
+
+	void ExpectNear(const HSLColor& lhs, const HSLColor& rhs)
+	{
+		EXPECT_NEAR(lhs.h, rhs.h, 1e-3f);
+		EXPECT_NEAR(lhs.s, rhs.s, 1e-5f);
+		EXPECT_NEAR(lhs.l, rhs.l, 1e-5f);
+		EXPECT_FLOAT_EQ(lhs.a, rhs.a);
+	}
+
+	double Hue(double r, double g, double b)
+	{
+		const double max = std::max({ r, g, b }), delta = max - std::min({ r, g, b });
+		if (delta == 0.0) return 0.0;
+
+		double hue = max == r ? (g - b) / delta : max == g ? (b - r) / delta + 2.0 : (r - g) / delta + 4.0;
+		return hue < 0.0 ? hue * 60.0 + 360.0 : hue * 60.0;
+	}
+}
+
+TEST(ColorSpaceTest, YCbCr)
+{
+	for (const auto format : Formats)
+	{
+		const YCbCrReference reference{ format };
+		for (size_t size = 0; size < 37; ++size)
+		{
+			const auto colors = MakeColors(size, 1u);
+			std::vector<YCbCrColor> yCbCr(size);
+			RGBToYCbCr(colors.data(), format, size, yCbCr.data());
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				EXPECT_NEAR(yCbCr[i].y, reference.Y(colors[i]), 1);
+				EXPECT_NEAR(yCbCr[i].cb, reference.Cb(colors[i]), 1);
+				EXPECT_NEAR(yCbCr[i].cr, reference.Cr(colors[i]), 1);
+				EXPECT_EQ(yCbCr[i].a, colors[i].a);
+			}
+
+			std::vector<YCbCrColor> inputs(size);
+			for (size_t i = 0; i < size; ++i)
+				inputs[i] = YCbCrColor{ colors[i].r, colors[i].g, colors[i].b, colors[i].a };
+
+			std::vector<Color> decoded(size);
+			YCbCrToRGB(inputs.data(), format, size, decoded.data());
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				const auto expected = reference.ToRGB(inputs[i]);
+				EXPECT_NEAR(decoded[i].r, expected.r, 1);
+				EXPECT_NEAR(decoded[i].g, expected.g, 1);
+				EXPECT_NEAR(decoded[i].b, expected.b, 1);
+				EXPECT_EQ(decoded[i].a, expected.a);
+			}
+		}
+	}
+
+	// Grays have no chroma and the range ends map exactly.
+	const YCbCrReference reference{ YCbCrFormat::BT709 };
+	for (int level = 0; level < 256; ++level)
+	{
+		const Color gray{ static_cast<uint8>(level), static_cast<uint8>(level), static_cast<uint8>(level) };
+		YCbCrColor yCbCr;
+		RGBToYCbCr(&gray, YCbCrFormat::BT709, 1, &yCbCr);
+		EXPECT_EQ(yCbCr, (YCbCrColor{ static_cast<uint8>(reference.Y(gray)), 128, 128 }));
+	}
+
+	const YCbCrColor black{ 16, 128, 128 }, white{ 235, 128, 128 };
+	Color color;
+	YCbCrToRGB(&black, YCbCrFormat::BT601, 1, &color);
+	EXPECT_EQ(color, Color::Black);
+	YCbCrToRGB(&white, YCbCrFormat::BT601, 1, &color);
+	EXPECT_EQ(color, Color::White);
+}
+
+TEST(ColorSpaceTest, YCbCrPlanar)
+{
+	for (const auto format : Formats)
+	{
+		for (size_t size = 0; size < 53; ++size)
+		{
+			const auto colors = MakeColors(size, 2u);
+			std::vector<YCbCrColor> interleaved(size);
+			std::vector<uint8> y(size), cb(size), cr(size);
+			RGBToYCbCr(colors.data(), format, size, interleaved.data());
+			RGBToYCbCr(colors.data(), format, size, y.data(), cb.data(), cr.data());
+
+			for (size_t i = 0; i < size; ++i)
+				EXPECT_EQ(interleaved[i], (YCbCrColor{ y[i], cb[i], cr[i], colors[i].a }));
+
+			for (auto& yCbCr : interleaved)
+				yCbCr.a = 255;
+
+			std::vector<Color> fromInterleaved(size), fromPlanar(size);
+			YCbCrToRGB(interleaved.data(), format, size, fromInterleaved.data());
+			YCbCrToRGB(y.data(), cb.data(), cr.data(), format, size, fromPlanar.data());
+			EXPECT_EQ(fromInterleaved, fromPlanar);
+		}
+	}
+}
+
+TEST(ColorSpaceTest, HSV)
+{
+	const Color colors[]{ Color{ 255, 0, 0 }, Color{ 0, 255, 0 }, Color::Blue, Color{ 255, 0, 255, 7 }, Color{ 51, 51, 51 }, Color::Black };
+	const HSVColor expected[]{ HSVColor{ 0.0f, 1.0f, 1.0f }, HSVColor{ 120.0f, 1.0f, 1.0f }, HSVColor{ 240.0f, 1.0f, 1.0f },
+		HSVColor{ 300.0f, 1.0f, 1.0f, 7.0f / 255.0f }, HSVColor{ 0.0f, 0.0f, 0.2f }, HSVColor{ 0.0f, 0.0f, 0.0f } };
+
+	HSVColor hsv[6];
+	RGBToHSV(colors, 6, hsv);
+	for (size_t i = 0; i < 6; ++i)
+		ExpectNear(hsv[i], expected[i]);
+
+	Color back[6];
+	HSVToRGB(hsv, 6, back);
+	for (size_t i = 0; i < 6; ++i)
+		EXPECT_EQ(back[i], colors[i]);
+
+	for (size_t size = 0; size < 37; ++size)
+	{
+		const auto randoms = MakeColors(size, 3u);
+		std::vector<HSVColor> out(size);
+		RGBToHSV(randoms.data(), size, out.data());
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			const double r = randoms[i].r / 255.0, g = randoms[i].g / 255.0, b = randoms[i].b / 255.0;
+			const double max = std::max({ r, g, b }), delta = max - std::min({ r, g, b });
+			const HSVColor reference{ static_cast<float>(Hue(r, g, b)), static_cast<float>(max == 0.0 ? 0.0 : delta / max),
+				static_cast<float>(max), randoms[i].a / 255.0f };
+			ExpectNear(out[i], reference);
+		}
+
+		std::vector<Color> roundTrip(size);
+		HSVToRGB(out.data(), size, roundTrip.data());
+		EXPECT_EQ(roundTrip, randoms);
+	}
+
+	// Hues wrap around and linear colors keep their values.
+	const HSVColor wrapped[]{ HSVColor{ 480.0f, 1.0f, 0.5f }, HSVColor{ -240.0f, 1.0f, 0.5f } };
+	LinearColor linears[2];
+	HSVToRGB(wrapped, 2, linears);
+	EXPECT_EQ(linears[0], (LinearColor{ 0.0f, 0.5f, 0.0f }));
+	EXPECT_EQ(linears[1], (LinearColor{ 0.0f, 0.5f, 0.0f }));
+
+	RGBToHSV(linears, 2, hsv);
+	ExpectNear(hsv[0], HSVColor{ 120.0f, 1.0f, 0.5f });
+}
+
+TEST(ColorSpaceTest, HSL)
+{
+	const Color colors[]{ Color{ 255, 0, 0 }, Color{ 0, 255, 0 }, Color::Blue, Color{ 255, 128, 128, 7 }, Color{ 51, 51, 51 }, Color::White };
+	const HSLColor expected[]{ HSLColor{ 0.0f, 1.0f, 0.5f }, HSLColor{ 120.0f, 1.0f, 0.5f }, HSLColor{ 240.0f, 1.0f, 0.5f },
+		HSLColor{ 0.0f, 1.0f, 383.0f / 510.0f, 7.0f / 255.0f }, HSLColor{ 0.0f, 0.0f, 0.2f }, HSLColor{ 0.0f, 0.0f, 1.0f } };
+
+	HSLColor hsl[6];
+	RGBToHSL(colors, 6, hsl);
+	for (size_t i = 0; i < 6; ++i)
+		ExpectNear(hsl[i], expected[i]);
+
+	Color back[6];
+	HSLToRGB(hsl, 6, back);
+	for (size_t i = 0; i < 6; ++i)
+		EXPECT_EQ(back[i], colors[i]);
+
+	for (size_t size = 0; size < 37; ++size)
+	{
+		const auto randoms = MakeColors(size, 4u);
+		std::vector<HSLColor> out(size);
+		RGBToHSL(randoms.data(), size, out.data());
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			const double r = randoms[i].r / 255.0, g = randoms[i].g / 255.0, b = randoms[i].b / 255.0;
+			const double max = std::max({ r, g, b }), min = std::min({ r, g, b });
+			const double lightness = (max + min) / 2.0;
+			const double saturation = max == min ? 0.0 : (max - min) / (1.0 - std::abs(2.0 * lightness - 1.0));
+			ExpectNear(out[i], HSLColor{ static_cast<float>(Hue(r, g, b)), static_cast<float>(saturation),
+				static_cast<float>(lightness), randoms[i].a / 255.0f });
+		}
+
+		std::vector<Color> roundTrip(size);
+		HSLToRGB(out.data(), size, roundTrip.data());
+		EXPECT_EQ(roundTrip, randoms);
+	}
+
+	const LinearColor linear{ 0.25f, 0.5f, 0.75f, 0.5f };
+	LinearColor back2;
+	RGBToHSL(&linear, 1, hsl);
+	HSLToRGB(hsl, 1, &back2);
+	EXPECT_NEAR(back2.r, linear.r, 1e-6f);
+	EXPECT_NEAR(back2.g, linear.g, 1e-6f);
+	EXPECT_NEAR(back2.b, linear.b, 1e-6f);
+	EXPECT_EQ(back2.a, linear.a);
+}
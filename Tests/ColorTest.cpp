@@ -1,7 +1,28 @@
+#include <vector>
 #include "gtest/gtest.h"
 #include "BSMath/Color.h"
+#include "TestUtility.h"
 
 using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	// Checks a batch function against its per pixel reference on every tail length.
+	template <class Batch, class Reference>
+	void CheckBatch(Batch&& batch, Reference&& reference)
+	{
+		for (size_t size = 0; size < 37; ++size)
+		{
+			const auto lhs = MakeColors(size, 1u), rhs = MakeColors(size, 2u);
+			std::vector<Color> out(size);
+			batch(lhs.data(), rhs.data(), size, out.data());
+
+			for (size_t i = 0; i < size; ++i)
+				EXPECT_EQ(out[i], reference(lhs[i], rhs[i]));
+		}
+	}
+}
 
 TEST(ColorTest, Operator)
 {
@@ -13,3 +34,69 @@ TEST(ColorTest, Operator)
 	const auto target = Color{ 0, 0, 0, 0 };
 	EXPECT_EQ(lhs - rhs, target);
 }
+
+TEST(ColorTest, Saturate)
+{
+	CheckBatch(AddSaturate, [](const Color& lhs, const Color& rhs) { return lhs + rhs; });
+	CheckBatch(SubSaturate, [](const Color& lhs, const Color& rhs) { return lhs - rhs; });
+
+	// In place.
+	auto colors = MakeColors(9, 3u);
+	const auto expected = colors[8] + colors[8];
+	AddSaturate(colors.data(), colors.data(), colors.size(), colors.data());
+	EXPECT_EQ(colors[8], expected);
+}
+
+TEST(ColorTest, Multiply)
+{
+	CheckBatch(Multiply, [](const Color& lhs, const Color& rhs)
+	{
+		return Color{ Divide255(lhs.r * rhs.r), Divide255(lhs.g * rhs.g), Divide255(lhs.b * rhs.b), Divide255(lhs.a * rhs.a) };
+	});
+
+	// Exact rounding over every pair of channels.
+	std::vector<Color> lhs(65536), rhs(65536), out(65536);
+	for (int i = 0; i < 65536; ++i)
+	{
+		lhs[i] = Color{ static_cast<uint8>(i), 0, 0, static_cast<uint8>(i) };
+		rhs[i] = Color{ static_cast<uint8>(i >> 8), 0, 0, 255 };
+	}
+
+	Multiply(lhs.data(), rhs.data(), lhs.size(), out.data());
+	for (int i = 0; i < 65536; ++i)
+	{
+		ASSERT_EQ(out[i].r, Divide255((i & 255) * (i >> 8)));
+		ASSERT_EQ(out[i].a, i & 255);
+	}
+}
+
+TEST(ColorTest, Lerp)
+{
+	for (const float t : { 0.0f, 0.3f, 1.0f })
+	{
+		const int weight = static_cast<int>(t * 255.0f + 0.5f);
+		CheckBatch([t](const Color* lhs, const Color* rhs, size_t size, Color* out) { Lerp(lhs, rhs, t, size, out); },
+			[weight](const Color& lhs, const Color& rhs)
+		{
+			const auto lerp = [weight](uint8 l, uint8 r) { return Divide255(l * (255 - weight) + r * weight); };
+			return Color{ lerp(lhs.r, rhs.r), lerp(lhs.g, rhs.g), lerp(lhs.b, rhs.b), lerp(lhs.a, rhs.a) };
+		});
+	}
+}
+
+TEST(ColorTest, AlphaBlend)
+{
+	CheckBatch(AlphaBlend, [](const Color& src, const Color& dst)
+	{
+		const int inv = 255 - src.a;
+		const auto blend = [&](uint8 s, uint8 d) { return Divide255(s * src.a + d * inv); };
+		return Color{ blend(src.r, dst.r), blend(src.g, dst.g), blend(src.b, dst.b), static_cast<uint8>(src.a + Divide255(dst.a * inv)) };
+	});
+
+	const Color opaque{ 10, 20, 30, 255 }, clear{ 10, 20, 30, 0 }, dst{ 200, 100, 50, 255 };
+	Color out;
+	AlphaBlend(&opaque, &dst, 1, &out);
+	EXPECT_EQ(out, opaque);
+	AlphaBlend(&clear, &dst, 1, &out);
+	EXPECT_EQ(out, dst);
+}
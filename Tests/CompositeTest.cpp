@@ -0,0 +1,106 @@
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Composite.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	Color PremultiplyReference(const Color& color)
+	{
+		return Color{ Divide255(color.r * color.a), Divide255(color.g * color.a), Divide255(color.b * color.a), color.a };
+	}
+
+	std::vector<Color> MakePremultiplied(size_t size, uint32 seed)
+	{
+		auto colors = MakeColors(size, seed);
+		for (auto& color : colors)
+			color = PremultiplyReference(color);
+		return colors;
+	}
+
+	// Checks an operator against src * srcFactor + dst * dstFactor on every tail length,
+	// with the factors given in 1/255 steps.
+	template <class Batch, class Factors>
+	void CheckOperator(Batch&& batch, Factors&& factors)
+	{
+		for (size_t size = 0; size < 37; ++size)
+		{
+			const auto src = MakePremultiplied(size, 1u), dst = MakePremultiplied(size, 2u);
+			std::vector<Color> out(size);
+			batch(src.data(), dst.data(), size, out.data());
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				const auto [srcFactor, dstFactor] = factors(src[i].a, dst[i].a);
+				const auto blend = [=](uint8 s, uint8 d) { return Divide255(s * srcFactor + d * dstFactor); };
+				const Color expected{ blend(src[i].r, dst[i].r), blend(src[i].g, dst[i].g), blend(src[i].b, dst[i].b), blend(src[i].a, dst[i].a) };
+				EXPECT_EQ(out[i], expected);
+			}
+		}
+	}
+}
+
+TEST(CompositeTest, Premultiply)
+{
+	std::vector<Color> colors(65536), out(65536);
+	for (int i = 0; i < 65536; ++i)
+		colors[i] = Color{ static_cast<uint8>(i), static_cast<uint8>(255 - (i & 255)), 0, static_cast<uint8>(i >> 8) };
+
+	Premultiply(colors.data(), colors.size(), out.data());
+	for (int i = 0; i < 65536; ++i)
+		ASSERT_EQ(out[i], PremultiplyReference(colors[i]));
+}
+
+TEST(CompositeTest, Unpremultiply)
+{
+	std::vector<Color> colors(65536), out(65536);
+	for (int i = 0; i < 65536; ++i)
+		colors[i] = Color{ static_cast<uint8>(i), static_cast<uint8>(255 - (i & 255)), 0, static_cast<uint8>(i >> 8) };
+
+	Unpremultiply(colors.data(), colors.size(), out.data());
+	for (int i = 0; i < 65536; ++i)
+	{
+		const int alpha = i >> 8;
+		const auto divide = [=](int color) -> uint8
+		{
+			return alpha == 0 ? 0 : static_cast<uint8>(Min(static_cast<int>(std::floor(color * 255.0 / alpha + 0.5)), 255));
+		};
+
+		const Color expected{ divide(i & 255), divide(255 - (i & 255)), 0, static_cast<uint8>(alpha) };
+		ASSERT_EQ(out[i], expected);
+	}
+
+	// Premultiplying recovers the premultiplied colors.
+	const auto premultiplied = MakePremultiplied(37, 3u);
+	std::vector<Color> straight(37), back(37);
+	Unpremultiply(premultiplied.data(), premultiplied.size(), straight.data());
+	Premultiply(straight.data(), straight.size(), back.data());
+	EXPECT_EQ(back, premultiplied);
+}
+
+TEST(CompositeTest, Operator)
+{
+	CheckOperator(CompositeOver, [](int sa, int) { return std::pair{ 255, 255 - sa }; });
+	CheckOperator(CompositeIn, [](int, int da) { return std::pair{ da, 0 }; });
+	CheckOperator(CompositeOut, [](int, int da) { return std::pair{ 255 - da, 0 }; });
+	CheckOperator(CompositeAtop, [](int sa, int da) { return std::pair{ da, 255 - sa }; });
+	CheckOperator(CompositeXor, [](int sa, int da) { return std::pair{ 255 - da, 255 - sa }; });
+
+	const Color opaque{ 10, 20, 30, 255 }, dst{ 100, 50, 25, 200 };
+	Color out;
+	CompositeOver(&opaque, &dst, 1, &out);
+	EXPECT_EQ(out, opaque);
+	CompositeOver(&Color::Transparent, &dst, 1, &out);
+	EXPECT_EQ(out, dst);
+	CompositeXor(&opaque, &opaque, 1, &out);
+	EXPECT_EQ(out, Color::Transparent);
+
+	// In place.
+	auto colors = MakePremultiplied(9, 4u);
+	CompositeIn(colors.data(), colors.data(), colors.size(), colors.data());
+	EXPECT_EQ(colors[0].a, Divide255(MakePremultiplied(1, 4u)[0].a * MakePremultiplied(1, 4u)[0].a));
+}
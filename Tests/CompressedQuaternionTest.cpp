@@ -0,0 +1,70 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/CompressedQuaternion.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	template <size_t ComponentBits>
+	void CheckBatch()
+	{
+		CheckRoundTrip<CompressedQuaternion<ComponentBits>, Quaternion>(11, MakeQuaternions,
+			[](const auto* in, size_t size, auto* out) { Compress(in, size, out); },
+			[](const auto* in, size_t size, auto* out) { Decompress(in, size, out); },
+			[](const Quaternion& quat, const auto& compressed, const Quaternion& decompressed)
+			{
+				EXPECT_EQ(compressed, CompressedQuaternion<ComponentBits>{ quat });
+
+				const auto expected = compressed.ToQuaternion();
+				for (size_t j = 0; j < 4; ++j)
+					EXPECT_NEAR(decompressed[j], expected[j], 1e-6f);
+			});
+	}
+}
+
+TEST(CompressedQuaternionTest, Compress)
+{
+	static_assert(sizeof(CompressedQuaternion32) == 4);
+	static_assert(sizeof(CompressedQuaternion48) == 6);
+	static_assert(sizeof(CompressedQuaternion64) == 8);
+
+	EXPECT_EQ(CompressedQuaternion32{}.ToQuaternion(), Quaternion::Identity);
+	EXPECT_EQ(CompressedQuaternion64{}.ToQuaternion(), Quaternion::Identity);
+
+	// The negated quaternion is the same rotation and compresses alike.
+	const Quaternion quat{ 0.5f, -0.5f, 0.5f, -0.5f };
+	const Quaternion negated{ -0.5f, 0.5f, -0.5f, 0.5f };
+	EXPECT_EQ(CompressedQuaternion48{ quat }, CompressedQuaternion48{ negated });
+
+	const auto decompressed = CompressedQuaternion48{ quat }.ToQuaternion();
+	EXPECT_NEAR(decompressed.x, 0.5f, 1e-4f);
+	EXPECT_NEAR(decompressed.y, -0.5f, 1e-4f);
+	EXPECT_NEAR(decompressed.z, 0.5f, 1e-4f);
+	EXPECT_NEAR(decompressed.w, -0.5f, 1e-4f);
+
+	CheckBatch<10>();
+	CheckBatch<15>();
+	CheckBatch<20>();
+	CheckBatch<7>();
+}
+
+TEST(CompressedQuaternionTest, Error)
+{
+	const auto quats = MakeQuaternions(10000);
+
+	const auto error32 = MeasureCompressionError<10>(quats.data(), quats.size());
+	const auto error48 = MeasureCompressionError<15>(quats.data(), quats.size());
+	const auto error64 = MeasureCompressionError<20>(quats.data(), quats.size());
+
+	EXPECT_LT(error32.maxAngle, Deg2Rad(0.25f));
+	EXPECT_LT(error48.maxAngle, Deg2Rad(0.01f));
+	EXPECT_LT(error64.maxAngle, Deg2Rad(0.001f));
+
+	EXPECT_LE(error32.meanAngle, error32.maxAngle);
+	EXPECT_LT(error48.meanAngle, error32.meanAngle);
+	EXPECT_LT(error64.meanAngle, error48.meanAngle);
+	EXPECT_EQ(MeasureCompressionError<10>(quats.data(), 0).maxAngle, 0.0f);
+}
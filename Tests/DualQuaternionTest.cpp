@@ -0,0 +1,136 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/DualQuaternion.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	std::vector<DualQuaternion> MakeDualQuaternions(size_t size)
+	{
+		std::vector<DualQuaternion> dqs(size);
+		Pcg32 engine{ static_cast<uint32>(size) };
+		std::uniform_real_distribution<float> dist{ -10.0f, 10.0f };
+		QuaternionDistribution rotationDist;
+		for (auto& dq : dqs)
+			dq = DualQuaternion{ rotationDist(engine), Vector3{ dist(engine), dist(engine), dist(engine) } };
+		return dqs;
+	}
+
+	// q and -q are the same rotation.
+	void ExpectNear(const DualQuaternion& lhs, const DualQuaternion& rhs, float tolerance = 1e-4f)
+	{
+		const float sign = (lhs.real | rhs.real) < 0.0f ? -1.0f : 1.0f;
+		for (size_t i = 0; i < 4; ++i)
+		{
+			EXPECT_NEAR(lhs.real[i], rhs.real[i] * sign, tolerance);
+			EXPECT_NEAR(lhs.dual[i], rhs.dual[i] * sign, tolerance);
+		}
+	}
+}
+
+TEST(DualQuaternionTest, Transform)
+{
+	const Vector3 point{ 1.0f, -2.0f, 3.0f };
+	EXPECT_EQ(DualQuaternion::Identity.TransformPoint(point), point);
+
+	// A quarter turn around z takes x to y.
+	const DualQuaternion quarter{ Quaternion{ 0.0f, 0.0f, 0.70710678f, 0.70710678f }, Vector3{ 1.0f, 2.0f, 3.0f } };
+	ExpectNear(quarter.TransformPoint(Vector3::Right), Vector3{ 1.0f, 3.0f, 3.0f });
+	ExpectNear(quarter.TransformDirection(Vector3::Right), Vector3{ 0.0f, 1.0f, 0.0f });
+	ExpectNear(quarter.GetTranslation(), Vector3{ 1.0f, 2.0f, 3.0f });
+
+	const auto lhs = MakeDualQuaternions(100);
+	const auto rhs = MakeDualQuaternions(101);
+	for (size_t i = 0; i < lhs.size(); ++i)
+	{
+		const Transform transform{ lhs[i].GetTranslation(), lhs[i].real, Vector3::One };
+		ExpectNear(lhs[i].TransformPoint(point), transform.TransformPoint(point), 1e-3f);
+		ExpectNear((lhs[i] * rhs[i]).TransformPoint(point), lhs[i].TransformPoint(rhs[i].TransformPoint(point)), 1e-3f);
+
+		// Both compose in the same order.
+		const Transform rhsTransform{ rhs[i].GetTranslation(), rhs[i].real, Vector3::One };
+		ExpectNear((lhs[i] * rhs[i]).TransformPoint(point), (transform * rhsTransform).TransformPoint(point), 1e-3f);
+		ExpectNear(lhs[i] * lhs[i].GetInvert(), DualQuaternion::Identity);
+	}
+}
+
+TEST(DualQuaternionTest, Normalize)
+{
+	for (const auto& dq : MakeDualQuaternions(20))
+	{
+		// Scaling both parts and adding some of the real part to the dual part are undone.
+		DualQuaternion scaled{ dq.real, dq.dual };
+		for (size_t i = 0; i < 4; ++i)
+		{
+			scaled.real[i] *= 3.0f;
+			scaled.dual[i] = scaled.dual[i] * 3.0f + scaled.real[i] * 0.1f;
+		}
+
+		EXPECT_TRUE(scaled.Normalize());
+		ExpectNear(scaled, dq);
+	}
+
+	DualQuaternion zero{ Quaternion{ 0.0f, 0.0f, 0.0f, 0.0f }, Quaternion{ 1.0f, 0.0f, 0.0f, 0.0f } };
+	EXPECT_FALSE(zero.Normalize());
+	EXPECT_EQ(DualQuaternion::GetNormal(zero), DualQuaternion::Identity);
+}
+
+TEST(DualQuaternionTest, Blend)
+{
+	const auto dqs = MakeDualQuaternions(2);
+	const float single[]{ 1.0f };
+	ExpectNear(Blend(dqs.data(), single, 1), dqs[0]);
+
+	// The halfway blend of no turn and a quarter turn is an eighth turn.
+	const DualQuaternion turns[]{ DualQuaternion{ Quaternion::Identity, Vector3{ 2.0f, 0.0f, 0.0f } },
+		DualQuaternion{ Quaternion{ 0.0f, 0.0f, 0.70710678f, 0.70710678f }, Vector3{ 2.0f, 0.0f, 0.0f } } };
+	const float halves[]{ 0.5f, 0.5f };
+	const auto blended = Blend(turns, halves, 2);
+	EXPECT_NEAR(blended.real.z, 0.38268343f, 1e-5f);
+	EXPECT_NEAR(blended.real.w, 0.92387953f, 1e-5f);
+	ExpectNear(blended.GetTranslation(), Vector3{ 2.0f, 0.0f, 0.0f });
+
+	// Flipping the sign of a bone doesn't change the blend.
+	const DualQuaternion flipped[]{ turns[0], DualQuaternion{ Quaternion{ 0.0f, 0.0f, -0.70710678f, -0.70710678f }, Quaternion{ -turns[1].dual.x, -turns[1].dual.y, -turns[1].dual.z, -turns[1].dual.w } } };
+	ExpectNear(Blend(flipped, halves, 2), blended);
+}
+
+TEST(DualQuaternionTest, SkinVertices)
+{
+	const auto bones = MakeDualQuaternions(8);
+	Pcg32 engine{ 3u };
+	std::uniform_int_distribution<int> indexDist{ 0, 7 };
+	std::uniform_real_distribution<float> dist{ 0.0f, 1.0f };
+
+	constexpr size_t VertexNum = 37;
+	std::vector<uint16> indices(VertexNum * 4);
+	std::vector<Vector4> weights(VertexNum);
+	std::vector<Vector3> positions(VertexNum), normals(VertexNum);
+	for (size_t i = 0; i < VertexNum; ++i)
+	{
+		for (size_t j = 0; j < 4; ++j)
+			indices[i * 4 + j] = static_cast<uint16>(indexDist(engine));
+
+		// Some vertices use fewer than four bones.
+		weights[i] = Vector4{ dist(engine), i % 3 ? dist(engine) : 0.0f, dist(engine), i % 2 ? dist(engine) : 0.0f };
+		weights[i] /= weights[i].x + weights[i].y + weights[i].z + weights[i].w;
+		positions[i] = Vector3{ dist(engine), dist(engine), dist(engine) };
+		normals[i] = Vector3::GetNormal(positions[i] - Vector3{ 0.5f });
+	}
+
+	std::vector<Vector3> skinned(VertexNum), skinnedNormals(VertexNum), skinnedOnly(VertexNum);
+	SkinVertices(bones.data(), indices.data(), weights.data(), positions.data(), normals.data(), VertexNum, skinned.data(), skinnedNormals.data());
+	SkinVertices(bones.data(), indices.data(), weights.data(), positions.data(), VertexNum, skinnedOnly.data());
+
+	for (size_t i = 0; i < VertexNum; ++i)
+	{
+		const DualQuaternion influences[]{ bones[indices[i * 4]], bones[indices[i * 4 + 1]], bones[indices[i * 4 + 2]], bones[indices[i * 4 + 3]] };
+		const auto blended = Blend(influences, weights[i].data, 4);
+		ExpectNear(skinned[i], blended.TransformPoint(positions[i]), 1e-3f);
+		ExpectNear(skinnedNormals[i], blended.TransformDirection(normals[i]), 1e-4f);
+		EXPECT_EQ(skinnedOnly[i], skinned[i]);
+	}
+}
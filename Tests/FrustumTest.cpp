@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "BSMath/Creator.h"
+#include "BSMath/Frustum.h"
+
+using namespace BSMath;
+
+namespace
+{
+	Frustum MakeFrustum()
+	{
+		using namespace Creator::Matrix;
+		const auto view = FromLookAt(Vector3::Zero, Vector3::Forward, Vector3::Up);
+		const auto proj = FromPerspective(Vector2{ 1.0f, 1.0f }, 1.0f, 100.0f, Pi * 0.5f);
+		return Frustum{ view * proj };
+	}
+}
+
+TEST(FrustumTest, Constructor)
+{
+	const auto frustum = MakeFrustum();
+
+	const Vector4 nearPlane{ 0.0f, 0.0f, 1.0f, -1.0f };
+	const Vector4 farPlane{ 0.0f, 0.0f, -1.0f, 100.0f };
+
+	for (size_t i = 0; i < 4; ++i)
+	{
+		EXPECT_NEAR(frustum.planes[4][i], nearPlane[i], 0.001f);
+		EXPECT_NEAR(frustum.planes[5][i], farPlane[i], 0.01f);
+	}
+}
+
+TEST(FrustumTest, Intersect)
+{
+	const auto frustum = MakeFrustum();
+
+	EXPECT_TRUE(frustum.IsInside(Vector3{ 0.0f, 0.0f, 10.0f }));
+	EXPECT_FALSE(frustum.IsInside(Vector3{ 0.0f, 0.0f, -10.0f }));
+	EXPECT_FALSE(frustum.IsInside(Vector3{ 0.0f, 0.0f, 200.0f }));
+	EXPECT_FALSE(frustum.IsInside(Vector3{ 20.0f, 0.0f, 10.0f }));
+
+	EXPECT_TRUE(frustum.Intersect(Vector3{ 0.0f, 0.0f, -1.0f }, 3.0f));
+	EXPECT_FALSE(frustum.Intersect(Vector3{ 0.0f, 0.0f, -5.0f }, 1.0f));
+
+	EXPECT_TRUE(frustum.Intersect(AABB{ Vector3{ 9.0f, -1.0f, 9.0f }, Vector3{ 11.0f, 1.0f, 11.0f } }));
+	EXPECT_FALSE(frustum.Intersect(AABB{ Vector3{ 12.0f, -1.0f, 9.0f }, Vector3{ 14.0f, 1.0f, 11.0f } }));
+}
+
+TEST(FrustumTest, Batch)
+{
+	constexpr size_t Size = 11;
+	const auto frustum = MakeFrustum();
+
+	float x[Size], y[Size], z[Size], radii[Size];
+	float maxX[Size], maxY[Size], maxZ[Size];
+	for (size_t i = 0; i < Size; ++i)
+	{
+		x[i] = static_cast<float>(i) * 4.0f - 20.0f;
+		y[i] = 0.0f;
+		z[i] = static_cast<float>(i) * 3.0f - 5.0f;
+		radii[i] = 1.0f;
+
+		maxX[i] = x[i] + 2.0f;
+		maxY[i] = y[i] + 2.0f;
+		maxZ[i] = z[i] + 2.0f;
+	}
+
+	uint8 sphereMask[(Size + 7) / 8];
+	CullSpheres(frustum, VectorSoA<const float, 3>{ x, y, z }, radii, Size, sphereMask);
+
+	uint8 boxMask[(Size + 7) / 8];
+	CullBoxes(frustum, VectorSoA<const float, 3>{ x, y, z },
+		VectorSoA<const float, 3>{ maxX, maxY, maxZ }, Size, boxMask);
+
+	for (size_t i = 0; i < Size; ++i)
+	{
+		const bool sphere = (sphereMask[i / 8] >> (i % 8)) & 1;
+		EXPECT_EQ(sphere, frustum.Intersect(Vector3{ x[i], y[i], z[i] }, radii[i]));
+
+		const AABB box{ Vector3{ x[i], y[i], z[i] }, Vector3{ maxX[i], maxY[i], maxZ[i] } };
+		const bool boxVisible = (boxMask[i / 8] >> (i % 8)) & 1;
+		EXPECT_EQ(boxVisible, frustum.Intersect(box));
+	}
+}
@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <unordered_set>
+#include <vector>
 #include "gtest/gtest.h"
 #include "BSMath/Color.h"
 #include "BSMath/Hash.h"
@@ -39,3 +45,102 @@ TEST(HashTest, Vector)
 	EXPECT_EQ(Hash<Vector3>{}(Vector3::Zero), Hash<Vector3>{}(Vector3::Zero));
 	EXPECT_EQ(Hash<Vector4>{}(Vector4::Zero), Hash<Vector4>{}(Vector4::Zero));
 }
+
+TEST(HashTest, Fnv)
+{
+	const unsigned char bytes[]{ 'a' };
+	EXPECT_EQ(FnvHasher::Hash(bytes, 1), 0xAF63DC4C8601EC8Cull);
+	EXPECT_EQ(FnvHasher::Hash(bytes, 0), 14695981039346656037ull);
+
+	const HashRange<IntVector3, sizeof(int) * 3, FnvHasher> hash;
+	EXPECT_EQ(hash(IntVector3{ 1, 2, 3 }), hash(IntVector3{ 1, 2, 3 }));
+	EXPECT_NE(hash(IntVector3{ 1, 2, 3 }), hash(IntVector3{ 3, 2, 1 }));
+}
+
+TEST(HashTest, Length)
+{
+	unsigned char bytes[128]{};
+	for (size_t i = 0; i < 128; ++i)
+		bytes[i] = static_cast<unsigned char>(i * 7 + 1);
+
+	// Every length takes a different path, and none of them may ignore a byte.
+	std::unordered_set<uint64> hashes;
+	for (size_t size = 0; size <= 128; ++size)
+	{
+		const uint64 hash = WyHasher::Hash(bytes, size);
+		EXPECT_TRUE(hashes.insert(hash).second);
+		EXPECT_EQ(hash, WyHasher::Hash(bytes, size));
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			bytes[i] ^= 0x10;
+			EXPECT_NE(WyHasher::Hash(bytes, size), hash);
+			bytes[i] ^= 0x10;
+		}
+	}
+}
+
+TEST(HashTest, Collision)
+{
+	constexpr int Size = 64;
+	constexpr size_t BucketNum = 1 << 12;
+
+	std::unordered_set<size_t> intHashes, floatHashes;
+	std::vector<size_t> buckets(BucketNum);
+
+	for (int z = 0; z < Size; ++z)
+	{
+		for (int y = 0; y < Size; ++y)
+		{
+			for (int x = 0; x < Size; ++x)
+			{
+				const size_t intHash = Hash<IntVector3>{}(IntVector3{ x - Size / 2, y - Size / 2, z - Size / 2 });
+				intHashes.insert(intHash);
+				++buckets[intHash & (BucketNum - 1)];
+
+				floatHashes.insert(Hash<Vector3>{}(Vector3{ x * 0.25f, y * 0.25f, z * 0.25f }));
+			}
+		}
+	}
+
+	EXPECT_EQ(intHashes.size(), Size * Size * Size);
+	EXPECT_EQ(floatHashes.size(), Size * Size * Size);
+
+	// 64 points per bucket on average, so a good hash stays well inside twice that.
+	EXPECT_LT(*std::max_element(buckets.begin(), buckets.end()), 128);
+	EXPECT_GT(*std::min_element(buckets.begin(), buckets.end()), 16);
+}
+
+TEST(HashTest, FloatSemantics)
+{
+	const Hash<Vector3> hash;
+	EXPECT_EQ(hash(Vector3{ 0.0f, -0.0f, 1.0f }), hash(Vector3{ -0.0f, 0.0f, 1.0f }));
+	EXPECT_NE(hash(Vector3{ 0.0f, 0.0f, 1.0f }), hash(Vector3{ 0.0f, 0.0f, -1.0f }));
+
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	EXPECT_EQ(hash(Vector3{ nan, 1.0f, 2.0f }), hash(Vector3{ -nan, 1.0f, 2.0f }));
+
+	// Only the used lanes are hashed, whatever is left in the padding.
+	alignas(Vector3) unsigned char storage[sizeof(Vector3)];
+	const auto* dirty = new (storage) Vector3{ 1.0f, 2.0f, 3.0f };
+	std::memset(storage + sizeof(float) * 3, 0xCD, sizeof(storage) - sizeof(float) * 3);
+	EXPECT_EQ(hash(*dirty), hash(Vector3{ 1.0f, 2.0f, 3.0f }));
+
+	EXPECT_EQ(Hash<Quaternion>{}(Quaternion{ -0.0f, 0.0f, 0.0f, 1.0f }), Hash<Quaternion>{}(Quaternion::Identity));
+	EXPECT_EQ(Hash<Rotator>{}(Rotator{ -0.0f, 0.0f, -0.0f }), Hash<Rotator>{}(Rotator::Zero));
+
+	Matrix3 mat = Matrix3::Identity;
+	mat[0][1] = -0.0f;
+	EXPECT_EQ(Hash<Matrix3>{}(mat), Hash<Matrix3>{}(Matrix3::Identity));
+}
+
+TEST(HashTest, Quantized)
+{
+	const QuantizedHash<Vector3> hash{ 0.5f };
+	EXPECT_EQ(hash(Vector3{ 0.1f, 1.2f, -0.3f }), hash(Vector3{ 0.4f, 1.4f, -0.1f }));
+	EXPECT_NE(hash(Vector3{ 0.1f, 1.2f, -0.3f }), hash(Vector3{ 0.6f, 1.2f, -0.3f }));
+	EXPECT_EQ(hash(Vector3{ -0.0f, 0.0f, 0.0f }), hash(Vector3::Zero));
+
+	const QuantizedHash<Quaternion> quatHash{ 0.01f };
+	EXPECT_EQ(quatHash(Quaternion{ 0.0f, 0.0f, 0.0f, 1.0f }), quatHash(Quaternion{ 0.001f, 0.002f, 0.0f, 1.0f }));
+}
@@ -0,0 +1,97 @@
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/LinearColor.h"
+
+using namespace BSMath;
+
+namespace
+{
+	int EncodeReference(float linear)
+	{
+		const double n = Clamp(static_cast<double>(linear), 0.0, 1.0);
+		const double srgb = n <= 0.0031308 ? n * 12.92 : 1.055 * std::pow(n, 1.0 / 2.4) - 0.055;
+		return static_cast<int>(std::floor(srgb * 255.0 + 0.5));
+	}
+}
+
+TEST(LinearColorTest, Operator)
+{
+	const LinearColor lhs{ 0.25f, 0.5f, 1.0f, 1.0f };
+	const LinearColor rhs{ 0.5f, 0.25f, 0.0f, 0.5f };
+
+	EXPECT_EQ(lhs + rhs, (LinearColor{ 0.75f, 0.75f, 1.0f, 1.5f }));
+	EXPECT_EQ(lhs - rhs, (LinearColor{ -0.25f, 0.25f, 1.0f, 0.5f }));
+	EXPECT_EQ(lhs * rhs, (LinearColor{ 0.125f, 0.125f, 0.0f, 0.5f }));
+	EXPECT_EQ(lhs * 2.0f, (LinearColor{ 0.5f, 1.0f, 2.0f, 2.0f }));
+	EXPECT_EQ(lhs / 2.0f, (LinearColor{ 0.125f, 0.25f, 0.5f, 0.5f }));
+	EXPECT_EQ(Lerp(lhs, rhs, 0.5f), (LinearColor{ 0.375f, 0.375f, 0.5f, 0.75f }));
+	EXPECT_EQ(lhs.ToVector(), (Vector4{ 0.25f, 0.5f, 1.0f, 1.0f }));
+	EXPECT_FLOAT_EQ(LinearColor::White.GetLuminance(), 1.0f);
+}
+
+TEST(LinearColorTest, Decode)
+{
+	for (int i = 0; i < 256; ++i)
+	{
+		const auto level = static_cast<uint8>(i);
+		const LinearColor color{ Color{ level, level, level, level } };
+		EXPECT_EQ(EncodeReference(color.r), i);
+		EXPECT_FLOAT_EQ(color.a, i / 255.0f);
+	}
+
+	EXPECT_EQ(LinearColor{ Color::White }, LinearColor::White);
+	EXPECT_EQ(LinearColor{ Color::Transparent }, LinearColor::Transparent);
+}
+
+TEST(LinearColorTest, Encode)
+{
+	// Every level is off by at most one, and almost all are exact.
+	size_t missNum = 0;
+	constexpr int SampleNum = 1 << 20;
+	for (int i = 0; i <= SampleNum; ++i)
+	{
+		const float linear = static_cast<float>(i) / SampleNum;
+		const Color color = LinearColor{ linear, linear, linear, linear }.ToColor();
+		const int expected = EncodeReference(linear);
+
+		ASSERT_LE(std::abs(color.r - expected), 1);
+		if (color.r != expected) ++missNum;
+		EXPECT_EQ(color.r, color.g);
+		EXPECT_EQ(color.r, color.b);
+		EXPECT_EQ(color.a, static_cast<int>(linear * 255.0f + 0.5f));
+	}
+	EXPECT_LT(missNum, SampleNum / 100);
+
+	EXPECT_EQ((LinearColor{ -1.0f, 2.0f, NAN, 3.0f }.ToColor()), (Color{ 0, 255, 0, 255 }));
+
+	// Decoding and encoding every level round trips.
+	for (int i = 0; i < 256; ++i)
+	{
+		const Color color{ static_cast<uint8>(i), static_cast<uint8>(255 - i), static_cast<uint8>(i / 2), static_cast<uint8>(i) };
+		EXPECT_EQ(LinearColor{ color }.ToColor(), color);
+	}
+}
+
+TEST(LinearColorTest, Batch)
+{
+	for (size_t size = 0; size < 11; ++size)
+	{
+		std::vector<Color> colors(size);
+		for (size_t i = 0; i < size; ++i)
+			colors[i] = Color{ static_cast<uint8>(i * 23), static_cast<uint8>(i * 7), static_cast<uint8>(i * 91), static_cast<uint8>(i * 13) };
+
+		std::vector<LinearColor> linears(size);
+		DecodeSRGB(colors.data(), size, linears.data());
+		for (size_t i = 0; i < size; ++i)
+			EXPECT_EQ(linears[i], LinearColor{ colors[i] });
+
+		for (auto& linear : linears)
+			linear *= 0.7f;
+
+		std::vector<Color> encoded(size);
+		EncodeSRGB(linears.data(), size, encoded.data());
+		for (size_t i = 0; i < size; ++i)
+			EXPECT_EQ(encoded[i], linears[i].ToColor());
+	}
+}
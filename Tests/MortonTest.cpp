@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Morton.h"
+
+using namespace BSMath;
+
+TEST(MortonTest, Morton)
+{
+	EXPECT_EQ(EncodeMorton(IntVector3{ 1, 0, 0 }), 1u);
+	EXPECT_EQ(EncodeMorton(IntVector3{ 0, 1, 0 }), 2u);
+	EXPECT_EQ(EncodeMorton(IntVector3{ 0, 0, 1 }), 4u);
+	EXPECT_EQ(EncodeMorton(IntVector3{ 3, 0, 1 }), 13u);
+	EXPECT_EQ(EncodeMorton(IntVector3{ 1023, 1023, 1023 }), 0x3FFFFFFFu);
+	EXPECT_EQ(EncodeMorton<uint64>(IntVector3{ 0x1FFFFF, 0x1FFFFF, 0x1FFFFF }), static_cast<uint64>(0x7FFFFFFFFFFFFFFFull));
+	EXPECT_EQ(EncodeMorton(IntVector2{ 0xFFFF, 0 }), 0x55555555u);
+	EXPECT_EQ(EncodeMorton<uint64>(IntVector2{ 0, -1 }), static_cast<uint64>(0xAAAAAAAAAAAAAAAAull));
+
+	std::mt19937 engine{ 0 };
+	std::uniform_int_distribution<int> dist10{ 0, 1023 }, dist16{ 0, 0xFFFF }, dist21{ 0, 0x1FFFFF };
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		const IntVector3 small{ dist10(engine), dist10(engine), dist10(engine) };
+		EXPECT_EQ(DecodeMorton<3>(EncodeMorton(small)), small);
+
+		const IntVector3 large{ dist21(engine), dist21(engine), dist21(engine) };
+		EXPECT_EQ(DecodeMorton<3>(EncodeMorton<uint64>(large)), large);
+
+		const IntVector2 plane{ dist16(engine), dist16(engine) };
+		EXPECT_EQ(DecodeMorton<2>(EncodeMorton(plane)), plane);
+		EXPECT_EQ(DecodeMorton<2>(EncodeMorton<uint64>(plane)), plane);
+	}
+}
+
+TEST(MortonTest, Hilbert)
+{
+	// The first 16^3 codes fill a 16^3 cube one adjacent cell at a time.
+	constexpr uint32 CellNum = 16 * 16 * 16;
+	std::unordered_set<uint32> visited;
+
+	IntVector3 prev = DecodeHilbert<3>(0u);
+	EXPECT_EQ(prev, IntVector3::Zero);
+
+	for (uint32 code = 0; code < CellNum; ++code)
+	{
+		const auto cell = DecodeHilbert<3>(code);
+		EXPECT_EQ(EncodeHilbert(cell), code);
+		EXPECT_TRUE(visited.insert(static_cast<uint32>(EncodeMorton(cell))).second);
+
+		const auto diff = cell - prev;
+		EXPECT_EQ(Abs(diff.x) + Abs(diff.y) + Abs(diff.z), code == 0 ? 0 : 1);
+		EXPECT_LT(Max(cell.x, Max(cell.y, cell.z)), 16);
+		prev = cell;
+	}
+
+	for (uint32 code = 0; code < 1024; ++code)
+	{
+		const auto cell = DecodeHilbert<2>(code);
+		EXPECT_EQ(EncodeHilbert(cell), code);
+
+		const auto wideCode = static_cast<uint64>(code) << 40 | code;
+		EXPECT_EQ(EncodeHilbert<uint64>(DecodeHilbert<2>(wideCode)), wideCode);
+	}
+
+	const IntVector3 large{ 0x1ABCDE, 0x012345, 0x1FFFFF };
+	EXPECT_EQ(DecodeHilbert<3>(EncodeHilbert<uint64>(large)), large);
+}
+
+TEST(MortonTest, Quantize)
+{
+	const AABB bounds{ Vector3{ -1.0f, -2.0f, -4.0f }, Vector3{ 1.0f, 2.0f, 4.0f } };
+
+	EXPECT_EQ(EncodeMorton(bounds.min, bounds), 0u);
+	EXPECT_EQ(EncodeMorton(bounds.max, bounds), 0x3FFFFFFFu);
+	EXPECT_EQ(EncodeMorton(bounds.max * 2.0f, bounds), 0x3FFFFFFFu);
+
+	const Vector3 point{ 0.3f, -1.1f, 2.5f };
+	EXPECT_TRUE(IsNearlyEqual(DecodeMorton(EncodeMorton(point, bounds), bounds), point, 0.01f));
+	EXPECT_TRUE(IsNearlyEqual(DecodeMorton(EncodeMorton<uint64>(point, bounds), bounds), point, 0.0001f));
+	EXPECT_TRUE(IsNearlyEqual(DecodeHilbert(EncodeHilbert(point, bounds), bounds), point, 0.01f));
+
+	// Cell centers of the max corner stay inside the bounds.
+	EXPECT_TRUE(bounds.IsInside(DecodeMorton(EncodeMorton(bounds.max, bounds), bounds)));
+	EXPECT_TRUE(bounds.IsInside(DecodeMorton(EncodeMorton<uint64>(bounds.max, bounds), bounds)));
+	EXPECT_TRUE(bounds.IsInside(DecodeHilbert(EncodeHilbert(bounds.max, bounds), bounds)));
+
+	// A flat box keeps its degenerate axis at the minimum.
+	const AABB flat{ Vector3{ 0.0f, 0.0f, 1.0f }, Vector3{ 1.0f, 1.0f, 1.0f } };
+	EXPECT_EQ(DecodeMorton(EncodeMorton(Vector3{ 0.5f, 0.5f, 1.0f }, flat), flat).z, 1.0f);
+}
+
+TEST(MortonTest, Batch)
+{
+	constexpr size_t Size = 1003;
+	std::mt19937 engine{ 1 };
+	std::uniform_real_distribution<float> dist{ -20.0f, 20.0f };
+
+	std::vector<float> xs(Size), ys(Size), zs(Size);
+	for (size_t i = 0; i < Size; ++i)
+	{
+		xs[i] = dist(engine);
+		ys[i] = dist(engine);
+		zs[i] = dist(engine);
+	}
+
+	const VectorSoA<const float, 3> points{ xs.data(), ys.data(), zs.data() };
+	const AABB bounds{ Vector3{ -10.0f }, Vector3{ 10.0f } };
+
+	std::vector<uint32> keys(Size);
+	std::vector<uint64> wideKeys(Size);
+	EncodeMortons(bounds, points, Size, keys.data());
+	EncodeMortons(bounds, points, Size, wideKeys.data());
+
+	for (size_t i = 0; i < Size; ++i)
+	{
+		EXPECT_EQ(keys[i], EncodeMorton(points.Get(i), bounds));
+		EXPECT_EQ(wideKeys[i], EncodeMorton<uint64>(points.Get(i), bounds));
+	}
+
+	std::vector<uint32> indices(Size);
+	SortByMorton(bounds, points, Size, indices.data());
+
+	std::vector<uint32> sorted = indices;
+	std::sort(sorted.begin(), sorted.end());
+	for (uint32 i = 0; i < Size; ++i)
+		EXPECT_EQ(sorted[i], i);
+
+	for (size_t i = 1; i < Size; ++i)
+		EXPECT_LE(keys[indices[i - 1]], keys[indices[i]]);
+}
+
+TEST(MortonTest, RadixSort)
+{
+	constexpr size_t Size = 5000;
+	std::mt19937_64 engine{ 2 };
+
+	std::vector<uint64> keys(Size);
+	std::vector<uint32> values(Size);
+	for (size_t i = 0; i < Size; ++i)
+	{
+		// Equal high bytes exercise the skipped passes, and the narrow range exercises stability.
+		keys[i] = engine() % 300;
+		values[i] = static_cast<uint32>(i);
+	}
+
+	std::vector<std::pair<uint64, uint32>> expected(Size);
+	for (size_t i = 0; i < Size; ++i)
+		expected[i] = { keys[i], values[i] };
+	std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+	RadixSort(keys.data(), values.data(), Size);
+	for (size_t i = 0; i < Size; ++i)
+	{
+		EXPECT_EQ(keys[i], expected[i].first);
+		EXPECT_EQ(values[i], expected[i].second);
+	}
+}
@@ -0,0 +1,181 @@
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/PackedVector.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	uint32 GetBits(float n)
+	{
+		uint32 bits;
+		std::memcpy(&bits, &n, sizeof(bits));
+		return bits;
+	}
+
+	bool IsNaN(uint16 half)
+	{
+		return (half & 0x7FFF) > 0x7C00;
+	}
+
+	template <size_t L>
+	void CheckHalfVectors()
+	{
+		CheckRoundTrip<Vector<Half, L>, Vector<float, L>>(13,
+			[](size_t size) { return MakeVectors<L>(size, -100.0f, 100.0f); },
+			[](const auto* in, size_t size, auto* out) { ConvertToHalf(in, size, out); },
+			[](const auto* in, size_t size, auto* out) { ConvertFromHalf(in, size, out); },
+			[](const auto& vector, const auto& half, const auto& decoded)
+			{
+				EXPECT_EQ(half, (Vector<Half, L>{ vector }));
+				EXPECT_EQ(decoded, half.ToVector());
+			});
+	}
+
+	template <class T, size_t L>
+	void CheckNormalizedVectors()
+	{
+		CheckRoundTrip<NormalizedVector<T, L>, Vector<float, L>>(13,
+			[](size_t size) { return MakeVectors<L>(size, -1.5f, 1.5f); },
+			[](const auto* in, size_t size, auto* out) { ConvertToNormalized(in, size, out); },
+			[](const auto* in, size_t size, auto* out) { ConvertFromNormalized(in, size, out); },
+			[](const auto& vector, const auto& packed, const auto& decoded)
+			{
+				EXPECT_EQ(packed, (NormalizedVector<T, L>{ vector }));
+				EXPECT_EQ(decoded, packed.ToVector());
+			});
+	}
+}
+
+TEST(PackedVectorTest, Half)
+{
+	EXPECT_EQ(static_cast<float>(Half::One), 1.0f);
+	EXPECT_EQ(static_cast<float>(Half::Max), 65504.0f);
+	EXPECT_EQ(static_cast<float>(Half::Infinity), Infinity);
+	EXPECT_EQ(Half{ -2.0f }.bits, 0xC000);
+	EXPECT_EQ(Half{ -0.0f }.bits, 0x8000);
+	EXPECT_EQ(Half{ 1e-8f }.bits, 0x0000);
+	EXPECT_EQ(Half{ 65519.0f }.bits, Half::Max.bits);
+	EXPECT_EQ(Half{ 65520.0f }.bits, Half::Infinity.bits);
+	EXPECT_EQ(Half{ -Infinity }.bits, 0xFC00);
+	EXPECT_TRUE(IsNaN(Half{ std::numeric_limits<float>::quiet_NaN() }.bits));
+	EXPECT_TRUE(std::isnan(static_cast<float>(Half::FromBits(0x7E00))));
+
+	// Every half survives the round trip, and the midpoint to the next one rounds to even.
+	for (uint32 bits = 0; bits < 0x7C00; ++bits)
+	{
+		const auto half = static_cast<uint16>(bits);
+		const float value = Half::FromBits(half);
+		ASSERT_EQ(Half{ value }.bits, half);
+		ASSERT_EQ(Half{ -value }.bits, half | 0x8000);
+		if (half == Half::Max.bits) continue;
+
+		const float next = Half::FromBits(static_cast<uint16>(half + 1));
+		const float middle = (value + next) * 0.5f;
+		const auto even = static_cast<uint16>((half & 1) ? half + 1 : half);
+		ASSERT_EQ(Half{ middle }.bits, even);
+		ASSERT_EQ(Half{ std::nextafter(middle, 0.0f) }.bits, half);
+		ASSERT_EQ(Half{ std::nextafter(middle, Infinity) }.bits, half + 1);
+	}
+}
+
+TEST(PackedVectorTest, ConvertHalf)
+{
+	// Every bit pattern decodes like the scalar conversion.
+	std::vector<Half> halves(1 << 16);
+	for (size_t i = 0; i < halves.size(); ++i)
+		halves[i] = Half::FromBits(static_cast<uint16>(i));
+
+	std::vector<float> values(halves.size());
+	ConvertFromHalf(halves.data(), halves.size(), values.data());
+	for (size_t i = 0; i < halves.size(); ++i)
+	{
+		if (IsNaN(halves[i].bits))
+			ASSERT_TRUE(std::isnan(values[i]));
+		else
+			ASSERT_EQ(GetBits(values[i]), GetBits(halves[i]));
+	}
+
+	std::vector<Half> encoded(halves.size());
+	ConvertToHalf(values.data(), values.size(), encoded.data());
+	for (size_t i = 0; i < halves.size(); ++i)
+	{
+		if (IsNaN(halves[i].bits))
+			ASSERT_TRUE(IsNaN(encoded[i].bits));
+		else
+			ASSERT_EQ(encoded[i].bits, halves[i].bits);
+	}
+
+	// NaN payloads are dropped on every build, F16C or not.
+	const uint32 nanBits[]{ 0x7FC01234u, 0xFFC00000u, 0x7F800001u, 0xFF812345u, 0x7FFFFFFFu };
+	float nans[5];
+	std::memcpy(nans, nanBits, sizeof(nans));
+	Half nanHalves[5];
+	ConvertToHalf(nans, 5, nanHalves);
+	for (size_t i = 0; i < 5; ++i)
+	{
+		EXPECT_EQ(nanHalves[i].bits, Half{ nans[i] }.bits);
+		EXPECT_EQ(nanHalves[i].bits, ((nanBits[i] >> 16) & 0x8000u) | 0x7E00u);
+	}
+
+	for (size_t size = 0; size < 13; ++size)
+	{
+		auto inputs = MakeValues(size, -70000.0f, 70000.0f);
+		for (size_t i = 0; i < size; i += 3)
+			inputs[i] *= 1e-9f;
+
+		std::vector<Half> outputs(size);
+		ConvertToHalf(inputs.data(), size, outputs.data());
+		for (size_t i = 0; i < size; ++i)
+			EXPECT_EQ(outputs[i].bits, Half{ inputs[i] }.bits);
+	}
+
+	CheckHalfVectors<2>();
+	CheckHalfVectors<3>();
+	CheckHalfVectors<4>();
+}
+
+TEST(PackedVectorTest, Normalized)
+{
+	EXPECT_EQ((SNorm16Vector3{ Vector3{ 1.0f, -1.0f, 0.0f } }[0]), 32767);
+	EXPECT_EQ((SNorm16Vector3{ Vector3{ 2.0f, -2.0f, 0.0f } }[1]), -32767);
+	EXPECT_EQ((UNorm8Vector4{ Vector4{ 0.5f, -1.0f, 2.0f, 1.0f } }[0]), 128);
+	EXPECT_EQ((UNorm8Vector4{ Vector4{ 0.5f, -1.0f, 2.0f, 1.0f } }[1]), 0);
+	EXPECT_EQ((UNorm8Vector4{ Vector4{ 0.5f, -1.0f, 2.0f, 1.0f } }[2]), 255);
+
+	SNorm16Vector2 snorm;
+	snorm[0] = -32768;
+	snorm[1] = 16384;
+	EXPECT_EQ(snorm.ToVector()[0], -1.0f);
+	EXPECT_FLOAT_EQ(snorm.ToVector()[1], 16384.0f / 32767.0f);
+
+	// Every level survives the round trip, except -32768 which decodes to -1.
+	std::vector<int16> levels(1 << 16);
+	for (size_t i = 0; i < levels.size(); ++i)
+		levels[i] = static_cast<int16>(static_cast<int>(i) - 32768);
+
+	std::vector<float> values(levels.size());
+	ConvertFromNormalized(levels.data(), levels.size(), values.data());
+
+	std::vector<int16> encoded(levels.size());
+	ConvertToNormalized(values.data(), values.size(), encoded.data());
+	for (size_t i = 0; i < levels.size(); ++i)
+	{
+		ASSERT_EQ(values[i], Detail::DecodeNormalized(levels[i]));
+		ASSERT_EQ(encoded[i], Max(levels[i], static_cast<int16>(-32767)));
+	}
+
+	for (int i = 0; i < 256; ++i)
+		EXPECT_EQ(Detail::EncodeNormalized<uint8>(Detail::DecodeNormalized(static_cast<uint8>(i))), i);
+
+	CheckNormalizedVectors<int16, 2>();
+	CheckNormalizedVectors<int16, 3>();
+	CheckNormalizedVectors<int16, 4>();
+	CheckNormalizedVectors<uint8, 2>();
+	CheckNormalizedVectors<uint8, 3>();
+	CheckNormalizedVectors<uint8, 4>();
+}
@@ -0,0 +1,176 @@
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Palette.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	int SquaredDistance(const Color& lhs, const Color& rhs)
+	{
+		const int r = lhs.r - rhs.r, g = lhs.g - rhs.g, b = lhs.b - rhs.b;
+		return r * r + g * g + b * b;
+	}
+
+	uint8 FindNearestReference(const std::vector<Color>& palette, const Color& color)
+	{
+		size_t best = 0;
+		for (size_t i = 1; i < palette.size(); ++i)
+		{
+			if (SquaredDistance(palette[i], color) < SquaredDistance(palette[best], color))
+				best = i;
+		}
+		return static_cast<uint8>(best);
+	}
+
+	Color Gray(uint8 level)
+	{
+		return Color{ level, level, level };
+	}
+}
+
+TEST(PaletteTest, FindNearest)
+{
+	for (const size_t paletteSize : { 1, 3, 5, 16, 256 })
+	{
+		const auto entries = MakeColors(paletteSize, static_cast<uint32>(paletteSize));
+		const Palette palette = [&] { Palette ret; ret.SetColors(entries.data(), entries.size()); return ret; }();
+		EXPECT_EQ(palette.GetColors(), entries);
+
+		for (size_t size = 0; size < 37; ++size)
+		{
+			const auto pixels = MakeColors(size, 100u);
+			std::vector<uint8> indices(size);
+			palette.Map(pixels.data(), size, indices.data());
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				const auto expected = FindNearestReference(entries, pixels[i]);
+				EXPECT_EQ(indices[i], expected);
+				EXPECT_EQ(palette.FindNearest(pixels[i]), expected);
+			}
+		}
+	}
+
+	// Ties go to the lowest index and alpha is ignored.
+	const Color entries[]{ Gray(10), Gray(30), Gray(10), Gray(30) };
+	Palette palette;
+	palette.SetColors(entries, 4);
+	EXPECT_EQ(palette.FindNearest(Gray(20)), 0);
+	EXPECT_EQ(palette.FindNearest(Color{ 30, 30, 30, 0 }), 1);
+}
+
+TEST(PaletteTest, Empty)
+{
+	// No index is valid, so nothing is written.
+	const auto pixels = MakeColors(16, 1u);
+	const Palette palette;
+	std::vector<uint8> indices(16, 0xAB);
+	palette.Map(pixels.data(), pixels.size(), indices.data());
+	palette.MapOrdered(pixels.data(), 4, 4, indices.data());
+	palette.MapDiffused(pixels.data(), 4, 4, indices.data());
+	EXPECT_EQ(indices, std::vector<uint8>(16, 0xAB));
+}
+
+TEST(PaletteTest, Build)
+{
+	// Fewer distinct colors than entries are reproduced exactly.
+	const Color distinct[]{ Color{ 255, 0, 0 }, Color{ 0, 255, 0 }, Color{ 0, 0, 255 }, Gray(0), Gray(255), Gray(128) };
+	std::vector<Color> pixels;
+	for (size_t i = 0; i < 600; ++i)
+		pixels.push_back(distinct[(i * 7) % 6]);
+
+	const Palette exact{ pixels.data(), pixels.size(), 16 };
+	EXPECT_EQ(exact.GetSize(), 6u);
+
+	std::vector<uint8> indices(pixels.size());
+	exact.Map(pixels.data(), pixels.size(), indices.data());
+	for (size_t i = 0; i < pixels.size(); ++i)
+		EXPECT_EQ(exact[indices[i]], pixels[i]);
+
+	// Refinement never increases the total error.
+	pixels = MakeColors(4096, 7u);
+	indices.resize(pixels.size());
+	int64 lastError = std::numeric_limits<int64>::max();
+	for (const size_t iterationNum : { 0, 1, 4 })
+	{
+		const Palette palette{ pixels.data(), pixels.size(), 32, iterationNum };
+		EXPECT_EQ(palette.GetSize(), 32u);
+
+		palette.Map(pixels.data(), pixels.size(), indices.data());
+		int64 error = 0;
+		for (size_t i = 0; i < pixels.size(); ++i)
+			error += SquaredDistance(palette[indices[i]], pixels[i]);
+
+		EXPECT_LE(error, lastError);
+		lastError = error;
+	}
+
+	EXPECT_EQ(Palette{}.GetSize(), 0u);
+	EXPECT_EQ((Palette{ pixels.data(), 0, 32 }.GetSize()), 0u);
+}
+
+TEST(PaletteTest, Cache)
+{
+	const auto entries = MakeColors(64, 8u);
+	Palette palette;
+	palette.SetColors(entries.data(), entries.size());
+	palette.EnableCache();
+	EXPECT_TRUE(palette.IsCacheEnabled());
+
+	// The cached entry is at most a cell diagonal, twice over, farther than the nearest one.
+	const auto pixels = MakeColors(1000, 9u);
+	std::vector<uint8> indices(pixels.size());
+	palette.Map(pixels.data(), pixels.size(), indices.data());
+	for (size_t i = 0; i < pixels.size(); ++i)
+	{
+		EXPECT_EQ(indices[i], palette.FindNearest(pixels[i]));
+		const double best = std::sqrt(SquaredDistance(entries[FindNearestReference(entries, pixels[i])], pixels[i]));
+		EXPECT_LE(std::sqrt(SquaredDistance(entries[indices[i]], pixels[i])), best + 2.0 * std::sqrt(48.0) + 1e-9);
+	}
+
+	// Cell centers map exactly and new colors refresh the cache.
+	const Color center{ 4, 132, 252 };
+	EXPECT_EQ(palette.FindNearest(center), FindNearestReference(entries, center));
+
+	const Color grays[]{ Gray(0), Gray(255) };
+	palette.SetColors(grays, 2);
+	EXPECT_EQ(palette.FindNearest(Gray(200)), 1);
+
+	palette.DisableCache();
+	EXPECT_FALSE(palette.IsCacheEnabled());
+}
+
+TEST(PaletteTest, Dither)
+{
+	constexpr size_t Width = 64, Height = 64;
+	const Color grays[]{ Gray(0), Gray(255) };
+	Palette palette;
+	palette.SetColors(grays, 2);
+
+	const std::vector<Color> image(Width * Height, Gray(64));
+	std::vector<uint8> indices(image.size());
+
+	// Without dithering everything snaps to black.
+	palette.MapOrdered(image.data(), Width, Height, indices.data(), 0);
+	EXPECT_EQ(std::count(indices.begin(), indices.end(), 1), 0);
+
+	// Both dithers keep the mean level.
+	palette.MapOrdered(image.data(), Width, Height, indices.data(), 255);
+	EXPECT_NEAR(std::count(indices.begin(), indices.end(), 1) / static_cast<double>(image.size()), 64.0 / 255.0, 0.03);
+
+	palette.MapDiffused(image.data(), Width, Height, indices.data());
+	EXPECT_NEAR(std::count(indices.begin(), indices.end(), 1) / static_cast<double>(image.size()), 64.0 / 255.0, 0.01);
+
+	// Colors of the palette carry no error.
+	std::vector<Color> exact(Width * Height);
+	for (size_t i = 0; i < exact.size(); ++i)
+		exact[i] = grays[(i * 13 / 7) & 1];
+
+	palette.MapDiffused(exact.data(), Width, Height, indices.data());
+	for (size_t i = 0; i < exact.size(); ++i)
+		EXPECT_EQ(palette[indices[i]], exact[i]);
+}
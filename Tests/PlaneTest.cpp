@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+#include "BSMath/Plane.h"
+
+using namespace BSMath;
+
+TEST(PlaneTest, Constructor)
+{
+	const Plane plane{ Vector3::Up, Vector3{ 3.0f, 2.0f, 1.0f } };
+	EXPECT_EQ(plane.GetNormal(), Vector3::Up);
+	EXPECT_EQ(plane.GetDistance(), -(Vector3::Up | Vector3{ 3.0f, 2.0f, 1.0f }));
+
+	const Plane fromPoints{ Vector3{ 0.0f, 0.0f, 1.0f }, Vector3{ 1.0f, 0.0f, 1.0f }, Vector3{ 0.0f, 1.0f, 1.0f } };
+	EXPECT_TRUE(IsNearlyEqual(fromPoints.GetNormal(), Vector3{ 0.0f, 0.0f, 1.0f }));
+	EXPECT_NEAR(fromPoints.GetDistance(), -1.0f, Epsilon);
+
+	Plane scaled{ 0.0f, 0.0f, 2.0f, -4.0f };
+	EXPECT_TRUE(scaled.Normalize());
+	EXPECT_NEAR(scaled[2], 1.0f, 0.0001f);
+	EXPECT_NEAR(scaled[3], -2.0f, 0.0001f);
+
+	Plane degenerate{ 0.0f, 0.0f, 0.0f, 1.0f };
+	EXPECT_FALSE(degenerate.Normalize());
+}
+
+TEST(PlaneTest, Distance)
+{
+	const Plane plane{ Vector3{ 1.0f, 0.0f, 0.0f }, -2.0f };
+
+	EXPECT_NEAR(plane.SignedDistance(Vector3{ 5.0f, 1.0f, 1.0f }), 3.0f, Epsilon);
+	EXPECT_NEAR(plane.SignedDistance(Vector3{ 0.0f, 1.0f, 1.0f }), -2.0f, Epsilon);
+	EXPECT_TRUE(IsNearlyEqual(plane.Project(Vector3{ 5.0f, 1.0f, 1.0f }), Vector3{ 2.0f, 1.0f, 1.0f }));
+	EXPECT_NEAR((-plane).SignedDistance(Vector3{ 5.0f, 1.0f, 1.0f }), -3.0f, Epsilon);
+}
+
+TEST(PlaneTest, Classify)
+{
+	const Plane plane{ Vector3{ 0.0f, 1.0f, 0.0f }, 0.0f };
+
+	EXPECT_EQ(plane.Classify(Vector3{ 0.0f, 1.0f, 0.0f }), PlaneSide::Front);
+	EXPECT_EQ(plane.Classify(Vector3{ 0.0f, -1.0f, 0.0f }), PlaneSide::Back);
+	EXPECT_EQ(plane.Classify(Vector3{ 5.0f, 0.0f, 5.0f }), PlaneSide::On);
+
+	EXPECT_EQ(plane.Classify(Sphere{ Vector3{ 0.0f, 2.0f, 0.0f }, 1.0f }), PlaneSide::Front);
+	EXPECT_EQ(plane.Classify(Sphere{ Vector3{ 0.0f, 0.5f, 0.0f }, 1.0f }), PlaneSide::On);
+
+	EXPECT_EQ(plane.Classify(AABB{ Vector3{ -1.0f, -3.0f, -1.0f }, Vector3{ 1.0f, -1.0f, 1.0f } }), PlaneSide::Back);
+	EXPECT_EQ(plane.Classify(AABB{ -Vector3::One, Vector3::One }), PlaneSide::On);
+}
+
+TEST(PlaneTest, Batch)
+{
+	constexpr size_t Size = 6;
+	const float xs[Size]{ 0.0f, 2.0f, -2.0f, 0.5f, 3.0f, 0.0f };
+	const float ys[Size]{ 0.0f, 0.0f, 0.0f, -0.5f, 3.0f, -2.0f };
+	const float zs[Size]{ 0.0f, 1.0f, 0.0f, 0.5f, 0.0f, 0.0f };
+	const VectorSoA<const float, 3> points{ xs, ys, zs };
+
+	// Unit box slab along x and y.
+	const Plane planes[4]
+	{
+		Plane{ Vector3{ 1.0f, 0.0f, 0.0f }, 1.0f },
+		Plane{ Vector3{ -1.0f, 0.0f, 0.0f }, 1.0f },
+		Plane{ Vector3{ 0.0f, 1.0f, 0.0f }, 1.0f },
+		Plane{ Vector3{ 0.0f, -1.0f, 0.0f }, 1.0f }
+	};
+
+	float distances[Size];
+	SignedDistances(planes[1], points, Size, distances);
+	for (size_t i = 0; i < Size; ++i)
+		EXPECT_NEAR(distances[i], planes[1].SignedDistance(Vector3{ xs[i], ys[i], zs[i] }), Epsilon);
+
+	uint32 codes[Size];
+	ClassifyPoints(planes, 4, points, Size, codes);
+
+	const uint32 expected[Size]{ 0b0000, 0b0010, 0b0001, 0b0000, 0b1010, 0b0100 };
+	for (size_t i = 0; i < Size; ++i)
+		EXPECT_EQ(codes[i], expected[i]);
+}
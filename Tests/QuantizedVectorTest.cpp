@@ -0,0 +1,129 @@
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/QuantizedVector.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	const AABB Bounds{ Vector3{ -10.0f, 0.0f, 5.0f }, Vector3{ 10.0f, 4.0f, 5.0f } };
+
+	std::vector<Vector3> MakePoints(size_t size)
+	{
+		auto points = MakeVectors<3>(size, 0.0f, 1.0f);
+		for (auto& point : points)
+			point = Bounds.min + point * Bounds.GetSize();
+		return points;
+	}
+
+	// Every point decodes within the error bound of the grid.
+	template <size_t ComponentBits>
+	void CheckError()
+	{
+		const QuantizationGrid grid{ Bounds, ComponentBits };
+		const auto maxError = grid.GetMaxError() * 1.001f + Vector3{ 1e-6f, 1e-6f, 1e-6f };
+		for (const auto& point : MakePoints(10000))
+		{
+			const auto decoded = grid.Dequantize(grid.Quantize<ComponentBits>(point));
+			for (size_t i = 0; i < 3; ++i)
+				ASSERT_LE(Abs(decoded[i] - point[i]), maxError[i]);
+		}
+	}
+
+	template <size_t ComponentBits>
+	void CheckBatch()
+	{
+		const QuantizationGrid grid{ Bounds, ComponentBits };
+		CheckRoundTrip<QuantizedVector3<ComponentBits>, Vector3>(11, MakePoints,
+			[&](const auto* in, size_t size, auto* out) { grid.Quantize(in, size, out); },
+			[&](const auto* in, size_t size, auto* out) { grid.Dequantize(in, size, out); },
+			[&](const Vector3& point, const auto& quantized, const Vector3& dequantized)
+			{
+				EXPECT_EQ(quantized, grid.Quantize<ComponentBits>(point));
+				// Only a fused multiply-add may round differently, by a few ULPs of the axis range.
+				const auto expected = grid.Dequantize(quantized);
+				for (size_t j = 0; j < 3; ++j)
+					EXPECT_NEAR(dequantized[j], expected[j], 4.0f * std::numeric_limits<float>::epsilon() * Max(Max(Abs(Bounds.min[j]), Abs(Bounds.max[j])), 1.0f));
+			});
+	}
+
+	template <size_t ComponentBits>
+	void CheckDelta(int move)
+	{
+		constexpr int MaxLevel = QuantizedVector3<ComponentBits>::MaxLevel;
+		Pcg32 engine{ static_cast<uint32>(move) };
+		std::uniform_int_distribution<int> levelDist{ 0, MaxLevel };
+		std::uniform_int_distribution<int> moveDist{ -move, move };
+
+		for (size_t size = 0; size < 11; ++size)
+		{
+			std::vector<QuantizedVector3<ComponentBits>> previous(size), current(size);
+			for (size_t i = 0; i < size; ++i)
+			{
+				const IntVector3 levels{ levelDist(engine), levelDist(engine), levelDist(engine) };
+				previous[i] = QuantizedVector3<ComponentBits>{ levels };
+				current[i] = QuantizedVector3<ComponentBits>{ levels + IntVector3{ moveDist(engine), moveDist(engine), moveDist(engine) } };
+			}
+
+			std::vector<QuantizedVector3<ComponentBits>> deltas(size), decoded(size);
+			EncodeDelta(current.data(), previous.data(), size, deltas.data());
+			DecodeDelta(deltas.data(), previous.data(), size, decoded.data());
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				EXPECT_EQ(decoded[i], current[i]);
+
+				const auto codes = deltas[i].GetLevels();
+				for (size_t j = 0; j < 3; ++j)
+					EXPECT_LE(codes[j], Min(2 * move, MaxLevel));
+			}
+		}
+	}
+}
+
+TEST(QuantizedVectorTest, Levels)
+{
+	static_assert(sizeof(QuantizedVector32) == 4);
+	static_assert(sizeof(QuantizedVector48) == 6);
+	static_assert(sizeof(QuantizedVector64) == 8);
+
+	EXPECT_EQ(QuantizedVector32{}.GetLevels(), IntVector3::Zero);
+	EXPECT_EQ((QuantizedVector32{ IntVector3{ 1023, 0, 512 } }.GetLevels()), (IntVector3{ 1023, 0, 512 }));
+	EXPECT_EQ((QuantizedVector32{ IntVector3{ 1024, -1, 3 } }.GetLevels()), (IntVector3{ 0, 1023, 3 }));
+	EXPECT_EQ((QuantizedVector64{ IntVector3{ 0x1FFFFF, 0x100001, 0x0ABCDE } }.GetLevels()), (IntVector3{ 0x1FFFFF, 0x100001, 0x0ABCDE }));
+	EXPECT_NE((QuantizedVector48{ IntVector3{ 1, 0, 0 } }), QuantizedVector48{});
+}
+
+TEST(QuantizedVectorTest, Quantize)
+{
+	const QuantizationGrid grid{ Bounds, 16 };
+	EXPECT_EQ(grid.Quantize<16>(Bounds.min).GetLevels(), IntVector3::Zero);
+	EXPECT_EQ(grid.Quantize<16>(Bounds.max).GetLevels(), (IntVector3{ 65535, 65535, 0 }));
+	EXPECT_EQ(grid.Quantize<16>(Vector3{ -20.0f, 9.0f, 6.0f }).GetLevels(), (IntVector3{ 0, 65535, 0 }));
+	EXPECT_EQ(grid.GetMaxError()[2], 0.0f);
+
+	// Points of a grid given by its cells land on their levels.
+	const QuantizationGrid cells{ Vector3{ 1.0f, 2.0f, 3.0f }, Vector3{ 0.5f, 0.25f, 2.0f } };
+	EXPECT_EQ(cells.Quantize<10>(Vector3{ 2.0f, 2.5f, 3.0f }).GetLevels(), (IntVector3{ 2, 2, 0 }));
+	EXPECT_EQ(cells.Dequantize(QuantizedVector32{ IntVector3{ 3, 4, 5 } }), (Vector3{ 2.5f, 3.0f, 13.0f }));
+
+	CheckError<10>();
+	CheckError<16>();
+	CheckError<21>();
+
+	CheckBatch<10>();
+	CheckBatch<16>();
+	CheckBatch<21>();
+	CheckBatch<5>();
+}
+
+TEST(QuantizedVectorTest, Delta)
+{
+	CheckDelta<10>(3);
+	CheckDelta<16>(100);
+	CheckDelta<21>(1);
+	CheckDelta<4>(1000);
+}
@@ -1,5 +1,9 @@
+#include <limits>
+#include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 #include "BSMath/Color.h"
+#include "BSMath/Rand.h"
 #include "BSMath/Rotator.h"
 #include "BSMath/Vector.h"
 
@@ -44,3 +48,216 @@ TEST(Random, Vector)
 	(void)intVec4Rand();
 	(void)intVec4Rand(IntVector4Random::Parameter{ 0, 1 });
 }
+
+TEST(Random, Xoshiro128)
+{
+	Xoshiro128 lhs{ 42 }, rhs{ 42 }, other{ 43 };
+	for (size_t i = 0; i < 100; ++i)
+	{
+		const auto value = lhs();
+		EXPECT_EQ(value, rhs());
+		EXPECT_NE(value, other());
+	}
+
+	// Scalar calls hand out the lanes of the same stream that Fill writes.
+	Xoshiro128 scalar{ 7 }, bulk{ 7 };
+	uint32 bits[21];
+	bulk.Fill(bits, 21);
+	for (size_t i = 0; i < 21; ++i)
+		EXPECT_EQ(scalar(), bits[i]);
+
+	std::uniform_int_distribution<int> dist{ 1, 6 };
+	const int die = dist(scalar);
+	EXPECT_TRUE(die >= 1 && die <= 6);
+}
+
+TEST(Random, FillUniform)
+{
+	constexpr size_t Size = 100003;
+	Xoshiro128 engine{ 1 };
+
+	std::vector<float> floats(Size);
+	engine.FillUniform(floats.data(), Size, -2.0f, 2.0f);
+
+	double sum = 0.0;
+	for (const float n : floats)
+	{
+		EXPECT_TRUE(n >= -2.0f && n < 2.0f);
+		sum += n;
+	}
+	EXPECT_NEAR(sum / Size, 0.0, 0.02);
+
+	std::vector<int> ints(Size);
+	engine.FillUniform(ints.data(), Size, -3, 3);
+
+	int counts[7]{};
+	for (const int n : ints)
+	{
+		ASSERT_TRUE(n >= -3 && n <= 3);
+		++counts[n + 3];
+	}
+	for (const int count : counts)
+		EXPECT_NEAR(count, Size / 7.0, Size * 0.01);
+
+	engine.FillUniform(ints.data(), Size, std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+	EXPECT_NE(ints[0], ints[1]);
+}
+
+TEST(Random, UniformFloatConverter)
+{
+	// The top draw rounds up to max without the clamp.
+	const auto allOnes = SIMD::VectorLoad1(-1);
+	EXPECT_LT(SIMD::VectorStore1(Detail::UniformFloatConverter{ 1.0f, 2.0f }(allOnes)), 2.0f);
+	EXPECT_LT(SIMD::VectorStore1(Detail::UniformFloatConverter{ -2.0f, 2.0f }(allOnes)), 2.0f);
+	EXPECT_LT(SIMD::VectorStore1(Detail::UniformFloatConverter{ 0.0f, 1.0f }(allOnes)), 1.0f);
+	EXPECT_EQ(SIMD::VectorStore1(Detail::UniformFloatConverter{ 1.0f, 2.0f }(SIMD::VectorLoad1(0))), 1.0f);
+}
+
+TEST(Random, Fill)
+{
+	Vector3Random vec3Rand;
+	vec3Rand.SetSeed(3);
+
+	std::vector<Vector3> vecs(1001);
+	vec3Rand.Fill(vecs.data(), vecs.size(), Vector3Random::Parameter{ 1.0f, 2.0f });
+	for (const auto& vec : vecs)
+		for (size_t i = 0; i < 3; ++i)
+			EXPECT_TRUE(vec[i] >= 1.0f && vec[i] < 2.0f);
+
+	IntVector4Random intVec4Rand;
+	std::vector<IntVector4> intVecs(100);
+	intVec4Rand.Fill(intVecs.data(), intVecs.size(), IntVector4Random::Parameter{ 0, 9 });
+	for (const auto& vec : intVecs)
+		for (size_t i = 0; i < 4; ++i)
+			EXPECT_TRUE(vec[i] >= 0 && vec[i] <= 9);
+
+	RotatorRandom rotatorRand;
+	std::vector<Rotator> rotators(100);
+	rotatorRand.Fill(rotators.data(), rotators.size());
+	for (const auto& rot : rotators)
+		EXPECT_TRUE(rot.yaw >= 0.0f && rot.yaw < 360.0f);
+
+	ColorRandom colorRand;
+	std::vector<Color> colors(100);
+	colorRand.Fill(colors.data(), colors.size());
+	EXPECT_NE(colors[0], colors[1]);
+
+	UniformFloatRandom floatRand{ UniformFloatRandom::Parameter{ 5.0f, 6.0f } };
+	float floats[33];
+	floatRand.Fill(floats, 33);
+	for (const float n : floats)
+		EXPECT_TRUE(n >= 5.0f && n < 6.0f);
+
+	NormalFloatRandom normalRand;
+	normalRand.Fill(floats, 33);
+}
+
+TEST(Random, Philox)
+{
+	// Known answer of Philox4x32-10 from the Random123 distribution.
+	const uint32 zero[4]{ 0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u };
+	const Philox4x32 zeroEngine{ 0u, 0u };
+	for (size_t i = 0; i < 4; ++i)
+		EXPECT_EQ(zeroEngine.Get(i), zero[i]);
+
+	// Bulk generation from any position matches the pure function.
+	Philox4x32 engine{ 1234u, 5u };
+	engine.Seek(7u);
+
+	uint32 bits[53];
+	engine.Fill(bits, 53);
+	EXPECT_EQ(engine.Tell(), 60u);
+	for (size_t i = 0; i < 53; ++i)
+		EXPECT_EQ(bits[i], engine.Get(7u + i));
+
+	EXPECT_NE(engine.Get(0u), Philox4x32(1234u, 6u).Get(0u));
+	EXPECT_NE(engine.Get(0u), Philox4x32(1235u, 5u).Get(0u));
+}
+
+TEST(Random, ParallelFill)
+{
+	constexpr size_t Size = 10007;
+
+	Philox4x32 serial{ 99u, 3u };
+	serial.Seek(5u);
+
+	std::vector<float> expected(Size);
+	serial.FillUniform(expected.data(), Size, -1.0f, 1.0f);
+
+	for (const size_t taskNum : { 1u, 3u, 8u })
+	{
+		Philox4x32 engine{ 99u, 3u };
+		engine.Seek(5u);
+
+		std::vector<float> floats(Size);
+		ParallelFill(engine, Size, [&](Philox4x32& local, size_t begin, size_t count)
+		{
+			local.FillUniform(floats.data() + begin, count, -1.0f, 1.0f);
+		}, taskNum);
+
+		EXPECT_EQ(floats, expected);
+		EXPECT_EQ(engine.Tell(), serial.Tell());
+	}
+
+	Random<Vector3, Philox4x32, VectorDistribution<float, 3>> vecRand;
+	vecRand.SetSeed(1u);
+	std::vector<Vector3> vecs(10);
+	vecRand.Fill(vecs.data(), vecs.size());
+	EXPECT_NE(vecs[0], vecs[1]);
+}
+
+TEST(Random, Pcg32)
+{
+	// Known answer of pcg32_srandom(42, 54) from the PCG reference implementation.
+	const uint32 expected[6]{ 0xA15C02B7u, 0x7B47F409u, 0xBA1D3330u, 0x83D2F293u, 0xBFA4784Bu, 0xCBED606Eu };
+	Pcg32 engine{ 42u, 54u };
+	for (uint32 value : expected)
+		EXPECT_EQ(engine(), value);
+
+	Pcg32 skipped{ 42u, 54u };
+	skipped.discard(4u);
+	EXPECT_EQ(skipped(), expected[4]);
+
+	Random<float, Pcg32, std::uniform_real_distribution<float>> floatRand;
+	EXPECT_LE(sizeof(floatRand), 32u);
+
+	floatRand.SetSeed(3u);
+	const float value = floatRand();
+	EXPECT_TRUE(value >= 0.0f && value < 1.0f);
+}
+
+TEST(Random, Rand)
+{
+	for (size_t i = 0; i < 100; ++i)
+	{
+		const float n = Rand::Float(-2.0f, 3.0f);
+		EXPECT_TRUE(n >= -2.0f && n < 3.0f);
+
+		const int m = Rand::Int(-5, 5);
+		EXPECT_TRUE(m >= -5 && m <= 5);
+
+		const Vector3 vec = Rand::Vector3(1.0f, 2.0f);
+		EXPECT_TRUE(vec.x >= 1.0f && vec.y >= 1.0f && vec.z >= 1.0f);
+		EXPECT_TRUE(vec.x < 2.0f && vec.y < 2.0f && vec.z < 2.0f);
+
+		EXPECT_NEAR(Rand::UnitVector3().LengthSquared(), 1.0f, 1e-4f);
+	}
+
+	(void)Rand::Bool();
+	(void)Rand::Vector2();
+	(void)Rand::Vector4();
+	(void)Rand::Quaternion();
+	(void)Rand::Rotator();
+	(void)Rand::Color();
+
+	Rand::SetSeed(8u);
+	const float first = Rand::Float();
+	Rand::SetSeed(8u);
+	EXPECT_EQ(Rand::Float(), first);
+
+	// Each thread owns a differently seeded generator.
+	float floats[2][8];
+	Rand::Fill(floats[0], 8);
+	std::thread{ [&floats] { Rand::Fill(floats[1], 8); } }.join();
+	EXPECT_FALSE(std::equal(floats[0], floats[0] + 8, floats[1]));
+}
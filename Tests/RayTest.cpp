@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+#include "BSMath/Ray.h"
+
+using namespace BSMath;
+
+TEST(RayTest, Constructor)
+{
+	const Ray ray{ Vector3::Zero, Vector3{ 2.0f, 4.0f, -0.5f } };
+
+	EXPECT_EQ(ray.invDirection, (Vector3{ 0.5f, 0.25f, -2.0f }));
+	EXPECT_EQ(ray.GetPoint(2.0f), (Vector3{ 4.0f, 8.0f, -1.0f }));
+}
+
+TEST(RayTest, Intersect)
+{
+	const Ray ray{ Vector3{ 0.0f, 0.0f, -10.0f }, Vector3::Forward };
+
+	const AABB box{ -Vector3::One, Vector3::One };
+	EXPECT_NEAR(ray.Intersect(box), 9.0f, Epsilon);
+	EXPECT_EQ(ray.Intersect(AABB{ Vector3::One, Vector3::One * 2.0f }), Infinity);
+	EXPECT_NEAR(Ray(Vector3::Zero, Vector3::Forward).Intersect(box), 0.0f, Epsilon);
+
+	// Rays lying in a face plane touch the closed box, whatever the sign of the zero component.
+	for (const float x : { -1.0f, 1.0f })
+	{
+		for (const float zero : { 0.0f, -0.0f })
+		{
+			EXPECT_NEAR(Ray(Vector3{ x, 0.5f, -10.0f }, Vector3{ zero, 0.0f, 1.0f }).Intersect(box), 9.0f, Epsilon);
+			EXPECT_NEAR(Ray(Vector3{ x, x, -10.0f }, Vector3{ zero, zero, 1.0f }).Intersect(box), 9.0f, Epsilon);
+			EXPECT_EQ(Ray(Vector3{ x, 0.5f, -10.0f }, Vector3{ zero, 0.0f, -1.0f }).Intersect(box), Infinity);
+			EXPECT_EQ(Ray(Vector3{ x * 1.5f, 0.5f, -10.0f }, Vector3{ zero, 0.0f, 1.0f }).Intersect(box), Infinity);
+		}
+	}
+
+	EXPECT_NEAR(ray.Intersect(Vector3::Zero, 2.0f), 8.0f, Epsilon);
+	EXPECT_EQ(ray.Intersect(Vector3{ 5.0f, 0.0f, 0.0f }, 2.0f), Infinity);
+	EXPECT_EQ(ray.Intersect(Vector3{ 0.0f, 0.0f, -20.0f }, 2.0f), Infinity);
+
+	const Vector3 v0{ -1.0f, -1.0f, 0.0f }, v1{ 1.0f, -1.0f, 0.0f }, v2{ 0.0f, 1.0f, 0.0f };
+	EXPECT_NEAR(ray.Intersect(v0, v1, v2), 10.0f, Epsilon);
+	EXPECT_EQ(ray.Intersect(v0 + Vector3::Right * 5.0f, v1 + Vector3::Right * 5.0f, v2 + Vector3::Right * 5.0f), Infinity);
+}
+
+TEST(RayTest, SmallTriangle)
+{
+	// The parallel test scales with the triangle, so sub-millimetre triangles still hit.
+	const Ray ray{ Vector3{ 0.0f, 0.0f, -1.0f }, Vector3::Forward };
+	for (const float size : { 3e-4f, 1e-4f, 1e-5f })
+	{
+		const Vector3 v0{ -size, -size, 0.0f }, v1{ size, -size, 0.0f }, v2{ 0.0f, size, 0.0f };
+		EXPECT_NEAR(ray.Intersect(v0, v1, v2), 1.0f, Epsilon);
+
+		float x[]{ v0.x }, y[]{ v0.y }, z[]{ v0.z }, x1[]{ v1.x }, y1[]{ v1.y }, z1[]{ v1.z }, x2[]{ v2.x }, y2[]{ v2.y }, z2[]{ v2.z };
+		float dist;
+		IntersectTriangles(ray, VectorSoA<const float, 3>{ x, y, z }, VectorSoA<const float, 3>{ x1, y1, z1 },
+			VectorSoA<const float, 3>{ x2, y2, z2 }, 1, &dist);
+		EXPECT_NEAR(dist, 1.0f, Epsilon);
+
+		// A ray in the plane of the triangle is parallel to it.
+		EXPECT_EQ(Ray(Vector3{ -1.0f, 0.0f, 0.0f }, Vector3::Right).Intersect(v0, v1, v2), Infinity);
+	}
+}
+
+TEST(RayTest, Batch)
+{
+	constexpr size_t Size = 7;
+	const Ray ray{ Vector3{ 0.0f, 0.0f, -10.0f }, Vector3{ 0.1f, 0.0f, 1.0f } };
+
+	float x[Size], y[Size], z[Size], radii[Size];
+	float maxX[Size], maxY[Size], maxZ[Size];
+	float x1[Size], y1[Size], z1[Size], x2[Size], y2[Size], z2[Size];
+	for (size_t i = 0; i < Size; ++i)
+	{
+		x[i] = static_cast<float>(i) - 3.0f;
+		y[i] = -1.0f;
+		z[i] = static_cast<float>(i);
+		radii[i] = 0.5f + static_cast<float>(i) * 0.25f;
+
+		maxX[i] = x[i] + 1.5f; maxY[i] = 1.0f; maxZ[i] = z[i] + 1.0f;
+		x1[i] = x[i] + 3.0f; y1[i] = y[i]; z1[i] = z[i];
+		x2[i] = x[i]; y2[i] = y[i] + 3.0f; z2[i] = z[i];
+	}
+
+	float boxDist[Size], sphereDist[Size], triangleDist[Size];
+	IntersectBoxes(ray, VectorSoA<const float, 3>{ x, y, z }, VectorSoA<const float, 3>{ maxX, maxY, maxZ }, Size, boxDist);
+	IntersectSpheres(ray, VectorSoA<const float, 3>{ x, y, z }, radii, Size, sphereDist);
+	IntersectTriangles(ray, VectorSoA<const float, 3>{ x, y, z }, VectorSoA<const float, 3>{ x1, y1, z1 },
+		VectorSoA<const float, 3>{ x2, y2, z2 }, Size, triangleDist);
+
+	bool anyHit = false;
+	for (size_t i = 0; i < Size; ++i)
+	{
+		const Vector3 v0{ x[i], y[i], z[i] };
+		EXPECT_EQ(boxDist[i], ray.Intersect(AABB{ v0, Vector3{ maxX[i], maxY[i], maxZ[i] } }));
+		EXPECT_EQ(sphereDist[i], ray.Intersect(v0, radii[i]));
+		EXPECT_EQ(triangleDist[i], ray.Intersect(v0, Vector3{ x1[i], y1[i], z1[i] }, Vector3{ x2[i], y2[i], z2[i] }));
+		anyHit |= boxDist[i] != Infinity;
+	}
+
+	EXPECT_TRUE(anyHit);
+}
+
+TEST(RayTest, Packet)
+{
+	const Ray rays[4]
+	{
+		Ray{ Vector3{ 0.0f, 0.0f, -10.0f }, Vector3::Forward },
+		Ray{ Vector3{ 0.0f, 0.0f, -5.0f }, Vector3::Forward },
+		Ray{ Vector3{ 5.0f, 0.0f, -10.0f }, Vector3::Forward },
+		Ray{ Vector3{ 0.0f, 0.0f, 10.0f }, Vector3::Backward }
+	};
+
+	const RayPacket packet{ rays };
+	const AABB box{ -Vector3::One, Vector3::One };
+
+	alignas(16) float dist[4];
+	SIMD::VectorStorePtr(packet.Intersect(box), dist);
+	for (size_t i = 0; i < 4; ++i)
+		EXPECT_EQ(dist[i], rays[i].Intersect(box));
+
+	SIMD::VectorStorePtr(packet.Intersect(Vector3::Zero, 2.0f), dist);
+	for (size_t i = 0; i < 4; ++i)
+		EXPECT_EQ(dist[i], rays[i].Intersect(Vector3::Zero, 2.0f));
+
+	EXPECT_NEAR(dist[1], 3.0f, Epsilon);
+	EXPECT_EQ(dist[2], Infinity);
+}
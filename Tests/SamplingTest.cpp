@@ -0,0 +1,118 @@
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Sampling.h"
+
+using namespace BSMath;
+
+namespace
+{
+	constexpr size_t SampleNum = 4099;
+
+	template <class T, class Distributor>
+	std::vector<T> Sample(bool bulk)
+	{
+		Random<T, DefaultRandomEngine, Distributor> random;
+		random.SetSeed(7u);
+
+		std::vector<T> samples(SampleNum);
+		if (bulk)
+			random.Fill(samples.data(), samples.size());
+		else
+			for (auto& sample : samples)
+				sample = random();
+
+		return samples;
+	}
+}
+
+TEST(SamplingTest, SinCos)
+{
+	for (float angle = -Pi; angle <= Pi; angle += 0.01f)
+	{
+		SIMD::VectorRegister<float> sin, cos;
+		SIMD::VectorSinCos(SIMD::VectorLoad1(angle), sin, cos);
+		EXPECT_NEAR(SIMD::VectorStore1(sin), std::sin(angle), 1e-6f);
+		EXPECT_NEAR(SIMD::VectorStore1(cos), std::cos(angle), 1e-6f);
+	}
+}
+
+TEST(SamplingTest, UnitSphere)
+{
+	for (bool bulk : { false, true })
+	{
+		Vector3 mean;
+		for (const auto& vec : Sample<Vector3, UnitSphereDistribution>(bulk))
+		{
+			EXPECT_NEAR(vec.LengthSquared(), 1.0f, 1e-4f);
+			mean += vec;
+		}
+
+		mean /= static_cast<float>(SampleNum);
+		EXPECT_LT(mean.Length(), 0.05f);
+	}
+}
+
+TEST(SamplingTest, UnitBall)
+{
+	for (bool bulk : { false, true })
+	{
+		size_t inner = 0;
+		for (const auto& vec : Sample<Vector3, UnitBallDistribution>(bulk))
+		{
+			EXPECT_LE(vec.LengthSquared(), 1.0f + 1e-4f);
+			if (vec.LengthSquared() < 0.25f) ++inner;
+		}
+
+		// The inner ball of radius 0.5 holds an eighth of the volume.
+		EXPECT_NEAR(static_cast<float>(inner) / SampleNum, 0.125f, 0.02f);
+	}
+}
+
+TEST(SamplingTest, UnitDisk)
+{
+	for (bool bulk : { false, true })
+	{
+		size_t inner = 0;
+		for (const auto& vec : Sample<Vector2, UnitDiskDistribution>(bulk))
+		{
+			EXPECT_LE(vec.LengthSquared(), 1.0f + 1e-4f);
+			if (vec.LengthSquared() < 0.25f) ++inner;
+		}
+
+		EXPECT_NEAR(static_cast<float>(inner) / SampleNum, 0.25f, 0.03f);
+	}
+}
+
+TEST(SamplingTest, CosineHemisphere)
+{
+	for (bool bulk : { false, true })
+	{
+		float cosSum = 0.0f;
+		for (const auto& vec : Sample<Vector3, CosineHemisphereDistribution>(bulk))
+		{
+			EXPECT_NEAR(vec.LengthSquared(), 1.0f, 1e-4f);
+			EXPECT_GE(vec.y, 0.0f);
+			cosSum += vec | Vector3::Up;
+		}
+
+		// E[cos] of a cosine weighted hemisphere is 2/3.
+		EXPECT_NEAR(cosSum / SampleNum, 2.0f / 3.0f, 0.02f);
+	}
+}
+
+TEST(SamplingTest, Quaternion)
+{
+	for (bool bulk : { false, true })
+	{
+		float wSum = 0.0f;
+		for (const auto& quat : Sample<Quaternion, QuaternionDistribution>(bulk))
+		{
+			EXPECT_NEAR(quat.x * quat.x + quat.y * quat.y + quat.z * quat.z + quat.w * quat.w, 1.0f, 1e-4f);
+			wSum += std::abs(quat.w);
+		}
+
+		// |w| of a uniform rotation follows the density (4 / Pi) sqrt(1 - w^2), whose mean is 4 / (3 Pi).
+		EXPECT_NEAR(wSum / SampleNum, 4.0f / (3.0f * Pi), 0.02f);
+	}
+}
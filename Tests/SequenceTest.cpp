@@ -0,0 +1,106 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Sequence.h"
+
+using namespace BSMath;
+
+namespace
+{
+	template <template <size_t> class Sequence, size_t L>
+	void CheckRandomAccess(Sequence<L> sequence)
+	{
+		std::vector<Vector<float, L>> points(77);
+		sequence.Seek(5u);
+		sequence.Fill(points.data(), points.size());
+		EXPECT_EQ(sequence.Tell(), 82u);
+
+		for (uint32 i = 0; i < points.size(); ++i)
+			EXPECT_EQ(points[i], sequence.Get(i + 5u));
+
+		sequence.Seek(3000000000u);
+		for (uint32 i = 0; i < 9; ++i)
+			EXPECT_EQ(sequence(), sequence.Get(3000000000u + i));
+
+		for (const auto& point : points)
+			for (size_t i = 0; i < L; ++i)
+				EXPECT_TRUE(point[i] >= 0.0f && point[i] < 1.0f);
+	}
+
+	// Integrates f(x, y) = x * y, whose exact value is 1/4.
+	template <class Sequence>
+	float Integrate(Sequence sequence, size_t sampleNum)
+	{
+		std::vector<typename Sequence::result_type> points(sampleNum);
+		sequence.Fill(points.data(), points.size());
+
+		float sum = 0.0f;
+		for (const auto& point : points)
+			sum += point.x * point.y;
+		return sum / sampleNum;
+	}
+}
+
+TEST(SequenceTest, Halton)
+{
+	const Vector3HaltonSequence halton;
+	EXPECT_EQ(halton.Get(0), Vector3::Zero);
+	EXPECT_EQ(halton.Get(1), (Vector3{ 0.5f, 1.0f / 3.0f, 0.2f }));
+	EXPECT_EQ(halton.Get(2), (Vector3{ 0.25f, 2.0f / 3.0f, 0.4f }));
+	EXPECT_EQ(halton.Get(3), (Vector3{ 0.75f, 1.0f / 9.0f, 0.6f }));
+	EXPECT_FLOAT_EQ(halton.Get(1025).x, 0.5f + 1.0f / 2048.0f);
+	EXPECT_FLOAT_EQ(halton.Get(730).y, 1.0f / 3.0f + 1.0f / 2187.0f);
+
+	CheckRandomAccess(Vector2HaltonSequence{});
+	CheckRandomAccess(Vector3HaltonSequence{ 3u });
+}
+
+TEST(SequenceTest, Sobol)
+{
+	const Vector3SobolSequence sobol;
+	EXPECT_EQ(sobol.Get(0), Vector3::Zero);
+	EXPECT_EQ(sobol.Get(1), (Vector3{ 0.5f, 0.5f, 0.5f }));
+	EXPECT_EQ(sobol.Get(2), (Vector3{ 0.25f, 0.75f, 0.75f }));
+	EXPECT_EQ(sobol.Get(3), (Vector3{ 0.75f, 0.25f, 0.25f }));
+
+	CheckRandomAccess(Vector2SobolSequence{});
+	CheckRandomAccess(Vector3SobolSequence{ 3u });
+}
+
+TEST(SequenceTest, SobolStratification)
+{
+	// Owen scrambling keeps one point in every elementary interval of a power-of-two prefix.
+	constexpr size_t PointNum = 256;
+	Vector2SobolSequence sobol{ 42u };
+	std::vector<Vector2> points(PointNum);
+	sobol.Fill(points.data(), points.size());
+
+	for (size_t rows = 1; rows <= PointNum; rows *= 2)
+	{
+		std::vector<int> counts(PointNum, 0);
+		for (const auto& point : points)
+			++counts[static_cast<size_t>(point.x * rows) * (PointNum / rows) + static_cast<size_t>(point.y * (PointNum / rows))];
+
+		for (int count : counts)
+			EXPECT_EQ(count, 1);
+	}
+}
+
+TEST(SequenceTest, R)
+{
+	const R2Sequence r2;
+	EXPECT_EQ(r2.Get(0), (Vector2{ 0.5f, 0.5f }));
+	EXPECT_NEAR(r2.Get(1).x, 0.5f + 0.7548777f - 1.0f, 1e-6f);
+	EXPECT_NEAR(r2.Get(1).y, 0.5698403f + 0.5f - 1.0f, 1e-6f);
+
+	CheckRandomAccess(R2Sequence{});
+	CheckRandomAccess(R3Sequence{ 3u });
+}
+
+TEST(SequenceTest, Convergence)
+{
+	// Low-discrepancy error falls close to 1/N, well below the 1/sqrt(N) of random points.
+	constexpr size_t SampleNum = 4096;
+	EXPECT_NEAR(Integrate(Vector2HaltonSequence{}, SampleNum), 0.25f, 1e-3f);
+	EXPECT_NEAR(Integrate(Vector2SobolSequence{ 7u }, SampleNum), 0.25f, 1e-3f);
+	EXPECT_NEAR(Integrate(R2Sequence{}, SampleNum), 0.25f, 1e-3f);
+}
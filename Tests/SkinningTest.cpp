@@ -0,0 +1,123 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Skinning.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	struct Mesh final
+	{
+		std::vector<uint16> indices;
+		std::vector<Vector4> weights;
+		std::vector<Vector3> positions;
+		std::vector<Vector3> normals;
+	};
+
+	Mesh MakeMesh(size_t size, size_t boneNum)
+	{
+		Mesh mesh;
+		Pcg32 engine{ static_cast<uint32>(size) };
+		std::uniform_int_distribution<int> indexDist{ 0, static_cast<int>(boneNum) - 1 };
+		std::uniform_real_distribution<float> dist{ 0.0f, 1.0f };
+
+		mesh.indices.resize(size * 4);
+		for (auto& index : mesh.indices)
+			index = static_cast<uint16>(indexDist(engine));
+
+		mesh.weights.resize(size);
+		mesh.positions.resize(size);
+		mesh.normals.resize(size);
+		for (size_t i = 0; i < size; ++i)
+		{
+			// Some vertices use fewer than four bones.
+			mesh.weights[i] = Vector4{ dist(engine), i % 3 ? dist(engine) : 0.0f, dist(engine), i % 2 ? dist(engine) : 0.0f };
+			mesh.weights[i] /= mesh.weights[i].x + mesh.weights[i].y + mesh.weights[i].z + mesh.weights[i].w;
+			mesh.positions[i] = Vector3{ dist(engine), dist(engine), dist(engine) };
+			mesh.normals[i] = Vector3::GetNormal(mesh.positions[i] - Vector3{ 0.5f });
+		}
+
+		return mesh;
+	}
+
+	std::vector<Transform> MakeBones(size_t size)
+	{
+		std::vector<Transform> bones(size);
+		Pcg32 engine{ static_cast<uint32>(size) };
+		std::uniform_real_distribution<float> dist{ -10.0f, 10.0f };
+		QuaternionDistribution rotationDist;
+		for (auto& bone : bones)
+			bone = Transform{ Vector3{ dist(engine), dist(engine), dist(engine) }, rotationDist(engine), Vector3{ 1.5f } };
+		return bones;
+	}
+}
+
+TEST(SkinningTest, Matrix)
+{
+	const auto transforms = MakeBones(8);
+	std::vector<Matrix4> bones(transforms.size());
+	ToMatrices(transforms.data(), transforms.size(), bones.data());
+
+	constexpr size_t VertexNum = 37;
+	const auto mesh = MakeMesh(VertexNum, bones.size());
+	std::vector<Vector3> skinned(VertexNum), skinnedNormals(VertexNum), skinnedOnly(VertexNum);
+	SkinVertices(bones.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), mesh.normals.data(), VertexNum, skinned.data(), skinnedNormals.data());
+	SkinVertices(bones.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), VertexNum, skinnedOnly.data());
+
+	for (size_t i = 0; i < VertexNum; ++i)
+	{
+		Matrix4 blended;
+		for (size_t j = 0; j < 4; ++j)
+		{
+			const auto& bone = bones[mesh.indices[i * 4 + j]];
+			for (size_t row = 0; row < 4; ++row)
+				for (size_t column = 0; column < 4; ++column)
+					blended[row][column] += bone[row][column] * mesh.weights[i][j];
+		}
+
+		ExpectNear(skinned[i], MultiplyRow(mesh.positions[i], 1.0f, blended), 1e-3f);
+		ExpectNear(skinnedNormals[i], Vector3::GetNormal(MultiplyRow(mesh.normals[i], 0.0f, blended)), 1e-3f);
+		EXPECT_EQ(skinnedOnly[i], skinned[i]);
+	}
+
+	// A vertex on a single bone follows it exactly, like its dual quaternion.
+	const Mesh single{ { 5, 0, 0, 0 }, { Vector4{ 1.0f, 0.0f, 0.0f, 0.0f } }, { Vector3{ 1.0f, -2.0f, 3.0f } }, { Vector3::Right } };
+	Vector3 position, normal;
+	SkinVertices(bones.data(), single.indices.data(), single.weights.data(), single.positions.data(), single.normals.data(), 1, &position, &normal);
+	ExpectNear(position, transforms[5].TransformPoint(single.positions[0]), 1e-3f);
+	ExpectNear(normal, Vector3::GetNormal(transforms[5].TransformDirection(Vector3::Right)));
+}
+
+TEST(SkinningTest, Parallel)
+{
+	const auto transforms = MakeBones(16);
+	std::vector<Matrix4> matrices(transforms.size());
+	ToMatrices(transforms.data(), transforms.size(), matrices.data());
+
+	std::vector<DualQuaternion> dqs(transforms.size());
+	for (size_t i = 0; i < transforms.size(); ++i)
+		dqs[i] = DualQuaternion{ transforms[i].rotation, transforms[i].translation };
+
+	// Enough vertices for several chunks with a ragged end.
+	constexpr size_t VertexNum = 20001;
+	const auto mesh = MakeMesh(VertexNum, transforms.size());
+	std::vector<Vector3> expected(VertexNum), expectedNormals(VertexNum), skinned(VertexNum), skinnedNormals(VertexNum);
+
+	SkinVertices(matrices.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), mesh.normals.data(), VertexNum, expected.data(), expectedNormals.data());
+	for (size_t taskNum : { 0, 1, 3, 64 })
+	{
+		ParallelSkinVertices(matrices.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), mesh.normals.data(), VertexNum, skinned.data(), skinnedNormals.data(), taskNum);
+		EXPECT_EQ(skinned, expected);
+		EXPECT_EQ(skinnedNormals, expectedNormals);
+	}
+
+	SkinVertices(dqs.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), VertexNum, expected.data());
+	ParallelSkinVertices(dqs.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), VertexNum, skinned.data(), 3);
+	EXPECT_EQ(skinned, expected);
+
+	Vector3 untouched = Vector3::One;
+	ParallelSkinVertices(matrices.data(), mesh.indices.data(), mesh.weights.data(), mesh.positions.data(), 0, &untouched, 4);
+	EXPECT_EQ(untouched, Vector3::One);
+}
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/SpatialHashGrid.h"
+
+using namespace BSMath;
+
+namespace
+{
+	std::vector<Vector3> MakePoints(size_t size)
+	{
+		std::mt19937 engine{ 0 };
+		std::uniform_real_distribution<float> pos{ -50.0f, 50.0f };
+
+		std::vector<Vector3> points(size);
+		for (auto& point : points)
+			point = Vector3{ pos(engine), pos(engine), pos(engine) };
+		return points;
+	}
+}
+
+TEST(SpatialHashGridTest, Build)
+{
+	const auto points = MakePoints(10000);
+	const SpatialHashGrid grid{ 4.0f, points.data(), points.size() };
+
+	EXPECT_EQ(grid.GetSize(), points.size());
+	EXPECT_EQ(grid.GetCell(Vector3{ -0.5f, 3.9f, 4.0f }), (IntVector3{ -1, 0, 1 }));
+
+	std::vector<uint32> found;
+	const IntVector3 cell = grid.GetCell(points[0]);
+	grid.QueryCell(cell, [&](uint32 idx) { found.push_back(idx); });
+
+	std::vector<uint32> expected;
+	for (uint32 i = 0; i < points.size(); ++i)
+		if (grid.GetCell(points[i]) == cell)
+			expected.push_back(i);
+
+	EXPECT_EQ(found, expected);
+
+	size_t total = 0;
+	SpatialHashGrid empty{ 1.0f };
+	empty.Query(Vector3::Zero, 10.0f, [&](uint32) { ++total; });
+	empty.Build(points.data(), 0);
+	empty.Query(Vector3::Zero, 10.0f, [&](uint32) { ++total; });
+	EXPECT_EQ(total, 0);
+}
+
+TEST(SpatialHashGridTest, Query)
+{
+	const auto points = MakePoints(10000);
+	const SpatialHashGrid grid{ 3.0f, points.data(), points.size() };
+
+	const auto queries = MakePoints(64);
+	const float radii[]{ 0.0f, 1.5f, 3.0f, 7.0f, 200.0f };
+
+	for (const float radius : radii)
+	{
+		for (const auto& center : queries)
+		{
+			std::vector<uint32> found;
+			grid.Query(center, radius, [&](uint32 idx) { found.push_back(idx); });
+			std::sort(found.begin(), found.end());
+
+			std::vector<uint32> expected;
+			for (uint32 i = 0; i < points.size(); ++i)
+				if (Vector3::DistanceSquared(points[i], center) <= radius * radius)
+					expected.push_back(i);
+
+			EXPECT_EQ(found, expected);
+		}
+	}
+
+	// Radii past the int range of cells still find every point.
+	for (const float radius : { 1e10f, 1e30f, Infinity })
+	{
+		size_t total = 0;
+		grid.Query(queries[0], radius, [&](uint32) { ++total; });
+		EXPECT_EQ(total, points.size());
+	}
+}
@@ -0,0 +1,53 @@
+#include "gtest/gtest.h"
+#include "BSMath/Sphere.h"
+
+using namespace BSMath;
+
+TEST(SphereTest, Constructor)
+{
+	const Sphere sphere{ Vector3{ 1.0f, 2.0f, 3.0f }, 4.0f };
+	EXPECT_EQ(sphere.GetCenter(), (Vector3{ 1.0f, 2.0f, 3.0f }));
+	EXPECT_EQ(sphere.GetRadius(), 4.0f);
+
+	const Sphere bound{ AABB{ -Vector3::One, Vector3::One } };
+	EXPECT_EQ(bound.GetCenter(), Vector3::Zero);
+	EXPECT_NEAR(bound.GetRadius(), Sqrt(3.0f), Epsilon);
+}
+
+TEST(SphereTest, Distance)
+{
+	const Sphere sphere{ Vector3{ 1.0f, 0.0f, 0.0f }, 2.0f };
+
+	EXPECT_NEAR(sphere.SignedDistance(Vector3{ 5.0f, 0.0f, 0.0f }), 2.0f, Epsilon);
+	EXPECT_NEAR(sphere.SignedDistance(Vector3{ 1.0f, 0.0f, 0.0f }), -2.0f, Epsilon);
+	EXPECT_TRUE(IsNearlyEqual(sphere.Project(Vector3{ 1.0f, 5.0f, 0.0f }), Vector3{ 1.0f, 2.0f, 0.0f }));
+}
+
+TEST(SphereTest, Intersect)
+{
+	const Sphere sphere{ Vector3::Zero, 1.0f };
+
+	EXPECT_TRUE(sphere.IsInside(Vector3{ 0.5f, 0.5f, 0.5f }));
+	EXPECT_FALSE(sphere.IsInside(Vector3{ 1.0f, 1.0f, 0.0f }));
+
+	EXPECT_TRUE(sphere.Intersect(Sphere{ Vector3{ 1.5f, 0.0f, 0.0f }, 1.0f }));
+	EXPECT_FALSE(sphere.Intersect(Sphere{ Vector3{ 2.5f, 0.0f, 0.0f }, 1.0f }));
+
+	EXPECT_TRUE(sphere.Intersect(AABB{ Vector3{ 0.5f, -1.0f, -1.0f }, Vector3{ 2.0f, 1.0f, 1.0f } }));
+	EXPECT_FALSE(sphere.Intersect(AABB{ Vector3{ 0.8f, 0.8f, 0.8f }, Vector3{ 2.0f, 2.0f, 2.0f } }));
+}
+
+TEST(SphereTest, SignedDistances)
+{
+	constexpr size_t Size = 7;
+	const float xs[Size]{ 0.0f, 1.0f, 2.0f, 3.0f, -4.0f, 5.0f, 0.5f };
+	const float ys[Size]{ 0.0f, 1.0f, -2.0f, 0.0f, 1.0f, 2.0f, 0.5f };
+	const float zs[Size]{ 0.0f, 0.0f, 1.0f, -3.0f, 0.0f, 1.0f, 0.5f };
+
+	const Sphere sphere{ Vector3{ 1.0f, 0.0f, 0.0f }, 1.5f };
+	float distances[Size];
+	SignedDistances(sphere, VectorSoA<const float, 3>{ xs, ys, zs }, Size, distances);
+
+	for (size_t i = 0; i < Size; ++i)
+		EXPECT_NEAR(distances[i], sphere.SignedDistance(Vector3{ xs[i], ys[i], zs[i] }), 0.0001f);
+}
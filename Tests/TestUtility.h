@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Color.h"
+#include "BSMath/Matrix.h"
+#include "BSMath/Sampling.h"
+
+// Generators and checks shared by the tests. Every generator is seeded, so each size
+// always gets the same values.
+namespace BSMath
+{
+	namespace Test
+	{
+		inline std::vector<Color> MakeColors(size_t size, uint32 seed)
+		{
+			std::vector<Color> colors(size);
+			Pcg32 engine{ seed };
+			for (auto& color : colors)
+			{
+				const uint32 bits = engine();
+				color = Color{ static_cast<uint8>(bits >> 8), static_cast<uint8>(bits >> 16), static_cast<uint8>(bits >> 24), static_cast<uint8>(bits) };
+			}
+			return colors;
+		}
+
+		inline std::vector<float> MakeValues(size_t size, float min, float max)
+		{
+			std::vector<float> values(size);
+			Pcg32 engine{ static_cast<uint32>(size) };
+			std::uniform_real_distribution<float> dist{ min, max };
+			for (auto& value : values)
+				value = dist(engine);
+			return values;
+		}
+
+		template <size_t L>
+		std::vector<Vector<float, L>> MakeVectors(size_t size, float min, float max)
+		{
+			const auto values = MakeValues(size * L, min, max);
+			std::vector<Vector<float, L>> vectors(size);
+			for (size_t i = 0; i < size; ++i)
+				vectors[i] = Vector<float, L>{ values.data() + i * L };
+			return vectors;
+		}
+
+		inline std::vector<Quaternion> MakeQuaternions(size_t size)
+		{
+			std::vector<Quaternion> quats(size);
+			Pcg32 engine{ static_cast<uint32>(size) };
+			QuaternionDistribution dist;
+			for (auto& quat : quats)
+				quat = dist(engine);
+			return quats;
+		}
+
+		// n / 255 rounded to nearest, the reference for fixed point color arithmetic.
+		inline uint8 Divide255(int n)
+		{
+			return static_cast<uint8>(std::lround(n / 255.0));
+		}
+
+		// vec * mat with vec extended by w, computed one dot product at a time.
+		inline Vector3 MultiplyRow(const Vector3& vec, float w, const Matrix4& mat)
+		{
+			Vector3 ret;
+			for (size_t j = 0; j < 3; ++j)
+				ret[j] = vec.x * mat[0][j] + vec.y * mat[1][j] + vec.z * mat[2][j] + w * mat[3][j];
+			return ret;
+		}
+
+		inline void ExpectNear(const Vector3& lhs, const Vector3& rhs, float tolerance = 1e-4f)
+		{
+			for (size_t i = 0; i < 3; ++i)
+				EXPECT_NEAR(lhs[i], rhs[i], tolerance);
+		}
+
+		// q and -q are the same rotation.
+		inline void ExpectNear(const Quaternion& lhs, const Quaternion& rhs, float tolerance = 1e-4f)
+		{
+			const float sign = (lhs | rhs) < 0.0f ? -1.0f : 1.0f;
+			for (size_t i = 0; i < 4; ++i)
+				EXPECT_NEAR(lhs[i], rhs[i] * sign, tolerance);
+		}
+
+		// Runs a batch encode and decode on every size below sizeNum, so each tail length is
+		// covered, and calls check(input, encoded, decoded) on every element.
+		template <class Encoded, class Decoded, class Make, class Encode, class Decode, class Check>
+		void CheckRoundTrip(size_t sizeNum, Make&& make, Encode&& encode, Decode&& decode, Check&& check)
+		{
+			for (size_t size = 0; size < sizeNum; ++size)
+			{
+				const auto inputs = make(size);
+				std::vector<Encoded> encoded(size);
+				encode(inputs.data(), size, encoded.data());
+
+				std::vector<Decoded> decoded(size);
+				decode(encoded.data(), size, decoded.data());
+
+				for (size_t i = 0; i < size; ++i)
+					check(inputs[i], encoded[i], decoded[i]);
+			}
+		}
+	}
+}
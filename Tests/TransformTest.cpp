@@ -0,0 +1,134 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "BSMath/Transform.h"
+#include "TestUtility.h"
+
+using namespace BSMath;
+using namespace BSMath::Test;
+
+namespace
+{
+	std::vector<Transform> MakeTransforms(size_t size, bool isUniform)
+	{
+		std::vector<Transform> transforms(size);
+		Pcg32 engine{ static_cast<uint32>(size) };
+		std::uniform_real_distribution<float> translationDist{ -10.0f, 10.0f };
+		std::uniform_real_distribution<float> scaleDist{ 0.5f, 2.0f };
+		QuaternionDistribution rotationDist;
+		for (auto& transform : transforms)
+		{
+			transform.translation = Vector3{ translationDist(engine), translationDist(engine), translationDist(engine) };
+			transform.rotation = rotationDist(engine);
+			const float scale = scaleDist(engine);
+			transform.scale = isUniform ? Vector3{ scale } : Vector3{ scale, scaleDist(engine), scaleDist(engine) };
+		}
+		return transforms;
+	}
+
+	void ExpectNear(const Transform& lhs, const Transform& rhs, float tolerance = 1e-4f)
+	{
+		Test::ExpectNear(lhs.translation, rhs.translation, tolerance);
+		Test::ExpectNear(lhs.rotation, rhs.rotation, tolerance);
+		Test::ExpectNear(lhs.scale, rhs.scale, tolerance);
+	}
+}
+
+TEST(TransformTest, TransformPoint)
+{
+	const Vector3 point{ 1.0f, -2.0f, 3.0f };
+	EXPECT_EQ(Transform::Identity.TransformPoint(point), point);
+	EXPECT_EQ(Transform::Identity.ToMatrix4(), Matrix4::Identity);
+
+	// A quarter turn around z takes x to y.
+	const Transform transform{ Vector3{ 1.0f, 2.0f, 3.0f }, Quaternion{ 0.0f, 0.0f, 0.70710678f, 0.70710678f }, Vector3{ 2.0f } };
+	ExpectNear(transform.TransformPoint(Vector3::Right), Vector3{ 1.0f, 4.0f, 3.0f });
+	ExpectNear(transform.TransformDirection(Vector3::Right), Vector3{ 0.0f, 2.0f, 0.0f });
+
+	for (const auto& random : MakeTransforms(100, false))
+	{
+		const auto matrix = random.ToMatrix4();
+		ExpectNear(random.TransformPoint(point), MultiplyRow(point, 1.0f, matrix));
+		ExpectNear(random.TransformDirection(point), MultiplyRow(point, 0.0f, matrix));
+		ExpectNear(random.InverseTransformPoint(random.TransformPoint(point)), point);
+		ExpectNear(random.InverseTransformDirection(random.TransformDirection(point)), point);
+	}
+}
+
+TEST(TransformTest, Compose)
+{
+	const Vector3 point{ 1.0f, -2.0f, 3.0f };
+	const auto lhs = MakeTransforms(100, true);
+	const auto rhs = MakeTransforms(101, true);
+	for (size_t i = 0; i < lhs.size(); ++i)
+	{
+		const auto composed = lhs[i] * rhs[i];
+		ExpectNear(composed.TransformPoint(point), lhs[i].TransformPoint(rhs[i].TransformPoint(point)), 1e-3f);
+		EXPECT_TRUE(IsNearlyEqual(composed.ToMatrix4(), rhs[i].ToMatrix4() * lhs[i].ToMatrix4(), 1e-3f));
+
+		const auto invert = lhs[i].GetInvert();
+		ExpectNear(lhs[i] * invert, Transform::Identity);
+		ExpectNear(invert.TransformPoint(point), lhs[i].InverseTransformPoint(point));
+	}
+
+	std::vector<Transform> composed(lhs.size());
+	Compose(lhs.data(), rhs.data(), lhs.size(), composed.data());
+	for (size_t i = 0; i < lhs.size(); ++i)
+		EXPECT_EQ(composed[i], lhs[i] * rhs[i]);
+
+	const auto locals = MakeTransforms(5, false);
+	const int32 parents[]{ -1, 0, 1, 0, -1 };
+	Transform worlds[5];
+	ToWorld(locals.data(), parents, 5, worlds);
+	EXPECT_EQ(worlds[0], locals[0]);
+	EXPECT_EQ(worlds[1], locals[0] * locals[1]);
+	EXPECT_EQ(worlds[2], (locals[0] * locals[1]) * locals[2]);
+	EXPECT_EQ(worlds[3], locals[0] * locals[3]);
+	EXPECT_EQ(worlds[4], locals[4]);
+}
+
+TEST(TransformTest, Lerp)
+{
+	const auto from = MakeTransforms(50, false);
+	const auto to = MakeTransforms(51, false);
+	for (size_t i = 0; i < from.size(); ++i)
+	{
+		ExpectNear(Lerp(from[i], to[i], 0.0f), from[i]);
+		ExpectNear(Lerp(from[i], to[i], 1.0f), to[i]);
+
+		auto negated = to[i];
+		negated.rotation = Quaternion{ -negated.rotation.x, -negated.rotation.y, -negated.rotation.z, -negated.rotation.w };
+		EXPECT_EQ(Lerp(from[i], negated, 0.3f), Lerp(from[i], to[i], 0.3f));
+
+		const auto middle = Lerp(from[i], to[i], 0.5f);
+		ExpectNear(middle.translation, (from[i].translation + to[i].translation) * 0.5f);
+		EXPECT_NEAR(middle.rotation | middle.rotation, 1.0f, 1e-5f);
+	}
+
+	std::vector<Transform> blended(from.size());
+	Lerp(from.data(), to.data(), 0.25f, from.size(), blended.data());
+	for (size_t i = 0; i < from.size(); ++i)
+		EXPECT_EQ(blended[i], Lerp(from[i], to[i], 0.25f));
+}
+
+TEST(TransformTest, Batch)
+{
+	const auto transform = MakeTransforms(1, false)[0];
+	std::vector<Vector3> points(13);
+	for (size_t i = 0; i < points.size(); ++i)
+		points[i] = Vector3{ static_cast<float>(i), 1.0f - static_cast<float>(i), 0.5f * static_cast<float>(i) };
+
+	std::vector<Vector3> transformed(points.size()), directions(points.size());
+	TransformPoints(transform, points.data(), points.size(), transformed.data());
+	TransformDirections(transform, points.data(), points.size(), directions.data());
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		ExpectNear(transformed[i], transform.TransformPoint(points[i]), 1e-3f);
+		ExpectNear(directions[i], transform.TransformDirection(points[i]), 1e-3f);
+	}
+
+	const auto transforms = MakeTransforms(7, false);
+	std::vector<Matrix4> matrices(transforms.size());
+	ToMatrices(transforms.data(), transforms.size(), matrices.data());
+	for (size_t i = 0; i < transforms.size(); ++i)
+		EXPECT_EQ(matrices[i], transforms[i].ToMatrix4());
+}